@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <cmath>
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_F double, float
+#define MIPP_BENCH_TYPES_ALL double, float, int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#else
+#define MIPP_BENCH_TYPES_F float
+#define MIPP_BENCH_TYPES_ALL float, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#endif
+
+//         id      name         x0    c0    MIPP                        scalar                        types
+MIPP_BENCH(add,    "add",       1,    1,    x + c,                      x + c,                        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(sub,    "sub",       1,    1,    x - c,                      x - c,                        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(mul,    "mul",       1,    1,    x * c,                      x * c,                        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(div,    "div",       1,    1,    x / c,                      x / c,                        MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(fmadd,  "fmadd",     1,    0.5,  mipp::fmadd(x, c, c),       x * c + c,                    MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(fnmadd, "fnmadd",    1,    0.5,  mipp::fnmadd(x, c, c),      c - x * c,                    MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(fmsub,  "fmsub",     1,    0.5,  mipp::fmsub(x, c, c),       x * c - c,                    MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(fnmsub, "fnmsub",    1,    0.5,  mipp::fnmsub(x, c, c),      -(x * c) - c,                 MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(min,    "min",       1,    2,    mipp::min(x, c),            std::min(x, c),               MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(max,    "max",       2,    1,    mipp::max(x, c),            std::max(x, c),               MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(div2,   "div2+add",  1,    1,    mipp::div2(x) + c,          x / 2 + c,                    MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(div4,   "div4+add",  1,    1,    mipp::div4(x) + c,          x / 4 + c,                    MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(abs,    "abs",       -1,   0,    mipp::abs(x),               (T)std::abs(x),               MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(sqrt,   "sqrt",      2,    0,    mipp::sqrt(x),              std::sqrt(x),                 MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(rsqrt,  "rsqrt",     2,    0,    mipp::rsqrt(x),             (T)1 / std::sqrt(x),          MIPP_BENCH_TYPES_F  )
+MIPP_BENCH(sat,    "sat",       1,    0,    mipp::sat(x, (T)-4, (T)4),  std::min(std::max(x, (T)-4), (T)4), MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(neg,    "neg",       1,    -1,   mipp::neg(x, c),            c < 0 ? (T)-x : x,            MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(neg_m,  "neg(msk)",  1,    -1,   mipp::neg(x, mipp::sign(c)), c < 0 ? (T)-x : x,           MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(sign,   "sign+blend", 1,   -1,   mipp::blend(c, x, mipp::sign(x)), x < 0 ? c : x,          MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH(round,  "round",     1.5,  0,    mipp::round(x),             std::nearbyint(x),            MIPP_BENCH_TYPES_F  )
+
+// the complex operations (real and imaginary parts in two registers), the chain goes through one of the parts: 'c' is 0
+//              id        name        x0  c0  MIPP                                                            types
+MIPP_BENCH_SIMD(cadd,     "cadd",     1,  0,  mipp::cadd(mipp::Regx2<T>(x, c), mipp::Regx2<T>(c, c)).val[0],  MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(csub,     "csub",     1,  0,  mipp::csub(mipp::Regx2<T>(x, c), mipp::Regx2<T>(c, c)).val[0],  MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(cmul,     "cmul",     1,  0,  mipp::cmul(mipp::Regx2<T>(x, c), mipp::Regx2<T>(x, c)).val[0],  MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(cmulconj, "cmulconj", 1,  0,  mipp::cmulconj(mipp::Regx2<T>(x, c), mipp::Regx2<T>(x, c)).val[0], MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(cdiv,     "cdiv",     1,  0,  mipp::cdiv(mipp::Regx2<T>(x, c), mipp::Regx2<T>(x, c)).val[0],  MIPP_BENCH_TYPES_F  )
+MIPP_BENCH_SIMD(conj,     "conj",     1,  0,  mipp::conj(mipp::Regx2<T>(c, x)).val[1],                        MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(norm,     "norm",     1,  0,  mipp::norm(mipp::Regx2<T>(x, c)),                               MIPP_BENCH_TYPES_ALL)
@@ -0,0 +1,599 @@
+#ifndef MIPP_BENCH_HPP_
+#define MIPP_BENCH_HPP_
+
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include <type_traits>
+#include <functional>
+#include <atomic>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <mipp.h>
+
+namespace bench
+{
+// ----------------------------------------------------------------------------------------------------------- options
+
+struct options
+{
+	std::string filter   = "";   // run only the benchmarks whose name contains this string
+	double      min_time = 20.0; // minimum duration (in ms) of one measure
+	int         n_reps   = 5;    // number of measures, the fastest one is kept
+	size_t      n_elmts  = 2048; // number of elements in the arrays (small enough to stay in the L1 cache)
+};
+
+// ----------------------------------------------------------------------------------------------------------- results
+
+// all the times are in nanoseconds, a negative value means "not measured"
+struct result
+{
+	std::string name;
+	std::string type;
+	int         lanes     = 1;
+	bool        supported = true;
+	std::string error     = "";
+
+	double mipp_latency       = -1.; // one register operation in a dependency chain
+	double mipp_throughput    = -1.; // one register operation, many independent chains
+	double mipp_array         = -1.; // one element of an array processed with MIPP
+	double scalar_latency     = -1.; // one scalar operation in a dependency chain
+	double scalar_throughput  = -1.; // one scalar operation, many independent chains
+	double autovec_array      = -1.; // one element of an array processed by a scalar loop (auto-vectorized or not)
+};
+
+struct entry
+{
+	std::string name;
+	std::string type;
+	std::function<result(const options&)> run;
+};
+
+inline std::vector<entry>& registry()
+{
+	static std::vector<entry> entries;
+	return entries;
+}
+
+template <typename T> inline std::string type_name();
+template <> inline std::string type_name<double  >() { return "double";   }
+template <> inline std::string type_name<float   >() { return "float";    }
+template <> inline std::string type_name<int64_t >() { return "int64_t";  }
+template <> inline std::string type_name<int32_t >() { return "int32_t";  }
+template <> inline std::string type_name<int16_t >() { return "int16_t";  }
+template <> inline std::string type_name<int8_t  >() { return "int8_t";   }
+template <> inline std::string type_name<uint64_t>() { return "uint64_t"; }
+template <> inline std::string type_name<uint32_t>() { return "uint32_t"; }
+template <> inline std::string type_name<uint16_t>() { return "uint16_t"; }
+template <> inline std::string type_name<uint8_t >() { return "uint8_t";  }
+
+// type of the indexes of the gathers and of the scatters (signed integer of the same size as 'T')
+template <typename T>
+using index_t = typename std::conditional<sizeof(T) == 8, int64_t,
+                typename std::conditional<sizeof(T) == 4, int32_t,
+                typename std::conditional<sizeof(T) == 2, int16_t, int8_t>::type>::type>::type;
+
+// ------------------------------------------------------------------------------------------------ compiler barriers
+
+// 'opaque(v)' makes the compiler forget everything it knows about 'v' without generating any instruction: the value
+// stays in a register but it can't be constant-folded, hoisted out of a loop or re-associated with the next
+// operations. With the other compilers, 'v' makes a round-trip through the memory (slower but still correct).
+#if defined(__GNUC__)
+template <typename V>
+inline void _opaque(V &v, std::true_type /* integral */)
+{
+	__asm__ __volatile__("" : "+r"(v));
+}
+
+template <typename V>
+inline void _opaque(V &v, std::false_type /* integral */)
+{
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+	__asm__ __volatile__("" : "+v"(v));
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	__asm__ __volatile__("" : "+w"(v));
+#else
+	__asm__ __volatile__("" : "+m"(v));
+#endif
+}
+
+template <typename V>
+inline void opaque(V &v)
+{
+	_opaque(v, std::is_integral<V>());
+}
+
+// forces the compiler to assume that the memory has been read and written
+inline void clobber()
+{
+	__asm__ __volatile__("" : : : "memory");
+}
+#else
+template <typename V>
+inline void opaque(V &v)
+{
+	volatile V tmp = v;
+	v = tmp;
+}
+
+inline void clobber()
+{
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+#endif
+
+template <typename T>
+inline void opaque(mipp::Reg<T> &r)
+{
+	// works on a copy, otherwise GCC keeps the whole 'Reg' object in the memory
+	auto v = r.r;
+	opaque(v);
+	r.r = v;
+}
+
+// ------------------------------------------------------------------------------------------------------------ timers
+
+// returns the time (in ns) of one call to 'kernel(n)' divided by 'n', 'n' is increased until one call lasts at least
+// 'opt.min_time' ms and the fastest of 'opt.n_reps' calls is kept
+template <class K>
+double measure(const options &opt, K kernel)
+{
+	using clock = std::chrono::steady_clock;
+
+	size_t n = 16;
+	double best = 0.;
+	for (;;)
+	{
+		auto t0 = clock::now();
+		kernel(n);
+		auto t1 = clock::now();
+		best = std::chrono::duration<double,std::milli>(t1 - t0).count();
+		if (best >= opt.min_time || n >= ((size_t)1 << 40))
+			break;
+		n *= (best > 0.) ? std::max((size_t)2, std::min((size_t)100, (size_t)(1.2 * opt.min_time / best))) : 100;
+	}
+
+	for (auto r = 1; r < opt.n_reps; r++)
+	{
+		auto t0 = clock::now();
+		kernel(n);
+		auto t1 = clock::now();
+		best = std::min(best, std::chrono::duration<double,std::milli>(t1 - t0).count());
+	}
+
+	return best * 1e6 / (double)n;
+}
+
+// estimation of the core frequency (in GHz): a chain of dependent integer additions runs at one addition per cycle
+// on all the targeted CPUs (turbo and frequency scaling make this value approximate)
+inline double ghz_estimate(const options &opt)
+{
+	constexpr int U = 16;
+	auto ns = measure(opt, [](const size_t n)
+	{
+		uint64_t x = 0, c = 1;
+		opaque(c);
+		for (size_t i = 0; i < n; i++)
+			mipp::_unroll<U>::apply([&](const int) { x += c; opaque(x); });
+		opaque(x);
+	});
+	return (double)U / ns;
+}
+
+// ----------------------------------------------------------------------------------------------------------- kernels
+
+// number of independent chains used to measure the throughput (must not exceed the number of architectural registers)
+#if defined(MIPP_AVX512) || (defined(MIPP_NEON) && defined(__aarch64__))
+constexpr int n_chains = 16;
+#else
+constexpr int n_chains = 8;
+#endif
+
+// number of operations per iteration in the latency loop, amortizes the loop overhead
+constexpr int n_unroll = 8;
+
+template <class OP, typename R>
+double latency(const options &opt, const R x0, const R c0)
+{
+	const OP op;
+	return measure(opt, [&](const size_t n)
+	{
+		R x = x0, c = c0;
+		for (size_t i = 0; i < n; i++)
+		{
+			opaque(c);
+			mipp::_unroll<n_unroll>::apply([&](const int) { x = op(x, c); opaque(x); });
+		}
+	}) / n_unroll;
+}
+
+template <class OP, typename R>
+double throughput(const options &opt, const R x0, const R c0)
+{
+	const OP op;
+	return measure(opt, [&](const size_t n)
+	{
+		R x[n_chains], c = c0;
+		for (auto k = 0; k < n_chains; k++)
+			x[k] = x0;
+		for (size_t i = 0; i < n; i++)
+		{
+			opaque(c);
+			mipp::_unroll<n_chains>::apply([&](const int k) { x[k] = op(x[k], c); opaque(x[k]); });
+		}
+	}) / n_chains;
+}
+
+template <class OP, typename T>
+double array_mipp(const options &opt, const mipp::vector<T> &in, mipp::vector<T> &out, const T c0)
+{
+	const OP op;
+	return measure(opt, [&](const size_t n)
+	{
+		const mipp::Reg<T> c = c0;
+		for (size_t i = 0; i < n; i++)
+		{
+			for (size_t j = 0; j < in.size(); j += mipp::N<T>())
+			{
+				mipp::Reg<T> x = &in[j];
+				op(x, c).store(&out[j]);
+			}
+			clobber();
+		}
+	}) / (double)in.size();
+}
+
+template <class OP, typename T>
+double array_scalar(const options &opt, const mipp::vector<T> &in, mipp::vector<T> &out, const T c0)
+{
+	const OP op;
+	return measure(opt, [&](const size_t n)
+	{
+		const T c = c0;
+		const T* __restrict pin  = in.data();
+		      T* __restrict pout = out.data();
+		for (size_t i = 0; i < n; i++)
+		{
+			for (size_t j = 0; j < in.size(); j++)
+				pout[j] = op(pin[j], c);
+			clobber();
+		}
+	}) / (double)in.size();
+}
+
+// ----------------------------------------------------------------------------------------------------------- runners
+
+template <class OP, typename T>
+void run_scalar(const options &opt, result &res, const T x0, const T c0, std::true_type /* has_scalar */)
+{
+	res.scalar_latency    = latency   <OP,T>(opt, x0, c0);
+	res.scalar_throughput = throughput<OP,T>(opt, x0, c0);
+}
+
+template <class OP, typename T>
+void run_scalar(const options&, result&, const T, const T, std::false_type /* has_scalar */)
+{
+}
+
+template <class OP, typename T>
+void run_array_scalar(const options &opt, result &res, const mipp::vector<T> &in, mipp::vector<T> &out, const T c0,
+                      std::true_type /* has_scalar */)
+{
+	res.autovec_array = array_scalar<OP,T>(opt, in, out, c0);
+}
+
+template <class OP, typename T>
+void run_array_scalar(const options&, result&, const mipp::vector<T>&, mipp::vector<T>&, const T, std::false_type)
+{
+}
+
+// 'OP' is a functor with a 'Reg<T> operator()(Reg<T> x, Reg<T> c)' method (and a 'T operator()(T x, T c)' method if
+// 'OP::scalar' is true), the latency is measured on the chain 'x = op(x, c)'
+template <class OP, typename T>
+result run_op(const options &opt, const std::string &name, const double x0, const double c0, const bool chains)
+{
+	using has_scalar = std::integral_constant<bool,OP::scalar>;
+
+	result res;
+	res.name  = name;
+	res.type  = type_name<T>();
+	res.lanes = mipp::N<T>();
+
+	mipp::vector<T> in(opt.n_elmts), out(opt.n_elmts);
+	for (size_t i = 0; i < in.size(); i++)
+		in[i] = (T)(x0 + (double)(i % 8));
+
+	// the MIPP functions which are not available for this ISA and this type are throwing an exception
+	try
+	{
+		mipp::Reg<T> x = (T)x0;
+		x = OP()(x, mipp::Reg<T>((T)c0));
+		opaque(x);
+	}
+	catch (std::exception &e)
+	{
+		res.supported = false;
+		res.error     = e.what();
+		res.error     = res.error.substr(0, res.error.find('\n'));
+		return res;
+	}
+
+	if (chains)
+	{
+		res.mipp_latency    = latency   <OP,mipp::Reg<T>>(opt, mipp::Reg<T>((T)x0), mipp::Reg<T>((T)c0));
+		res.mipp_throughput = throughput<OP,mipp::Reg<T>>(opt, mipp::Reg<T>((T)x0), mipp::Reg<T>((T)c0));
+		run_scalar<OP,T>(opt, res, (T)x0, (T)c0, has_scalar());
+	}
+	res.mipp_array = array_mipp<OP,T>(opt, in, out, (T)c0);
+	run_array_scalar<OP,T>(opt, res, in, out, (T)c0, has_scalar());
+
+	return res;
+}
+
+// 'RED' is a functor with a 'T operator()(const T* data, size_t n)' method (MIPP version) and a 'T operator()(T a, T
+// b)' method (scalar loop)
+template <class RED, typename T>
+result run_reduction(const options &opt, const std::string &name, const double x0)
+{
+	const RED red;
+
+	result res;
+	res.name  = name;
+	res.type  = type_name<T>();
+	res.lanes = mipp::N<T>();
+
+	mipp::vector<T> in(opt.n_elmts);
+	for (size_t i = 0; i < in.size(); i++)
+		in[i] = (T)(x0 + (double)(i % 8));
+
+	try
+	{
+		T r = red(in.data(), in.size());
+		opaque(r);
+	}
+	catch (std::exception &e)
+	{
+		res.supported = false;
+		res.error     = e.what();
+		res.error     = res.error.substr(0, res.error.find('\n'));
+		return res;
+	}
+
+	res.mipp_array = measure(opt, [&](const size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			T r = red(in.data(), in.size());
+			opaque(r);
+			clobber();
+		}
+	}) / (double)in.size();
+
+	res.autovec_array = measure(opt, [&](const size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			T r = in[0];
+			for (size_t j = 1; j < in.size(); j++)
+				r = red(r, in[j]);
+			opaque(r);
+			clobber();
+		}
+	}) / (double)in.size();
+
+	return res;
+}
+
+// 'MEM' is a functor with the 'mipp_loop(in, out, idx, n)' and 'scalar_loop(in, out, idx, n)' methods which process
+// the 'n' first elements of 'in' into 'out' (the arrays have 'mipp::N<T>()' more elements for the unaligned accesses,
+// 'idx' is a permutation of [0, n[)
+template <class MEM, typename T>
+result run_mem(const options &opt, const std::string &name, const double x0)
+{
+	using I = index_t<T>;
+	const MEM mem;
+	const size_t n = opt.n_elmts;
+
+	result res;
+	res.name  = name;
+	res.type  = type_name<T>();
+	res.lanes = mipp::N<T>();
+
+	// 7 and 'n' are coprime when 'n' is a power of two
+	const size_t n_idx = std::min(n, (size_t)std::numeric_limits<I>::max());
+	mipp::vector<T> in(n + mipp::N<T>()), out(n + mipp::N<T>());
+	mipp::vector<I> idx(n + mipp::N<T>());
+	for (size_t i = 0; i < in.size(); i++)
+	{
+		in [i] = (T)(x0 + (double)(i % 8));
+		idx[i] = (I)((i * 7) % n_idx);
+	}
+
+	try
+	{
+		mem.mipp_loop(in.data(), out.data(), idx.data(), (size_t)mipp::N<T>());
+	}
+	catch (std::exception &e)
+	{
+		res.supported = false;
+		res.error     = e.what();
+		res.error     = res.error.substr(0, res.error.find('\n'));
+		return res;
+	}
+
+	res.mipp_array = measure(opt, [&](const size_t n_calls)
+	{
+		for (size_t i = 0; i < n_calls; i++)
+		{
+			mem.mipp_loop(in.data(), out.data(), idx.data(), n);
+			clobber();
+		}
+	}) / (double)n;
+
+	res.autovec_array = measure(opt, [&](const size_t n_calls)
+	{
+		for (size_t i = 0; i < n_calls; i++)
+		{
+			mem.scalar_loop(in.data(), out.data(), idx.data(), n);
+			clobber();
+		}
+	}) / (double)n;
+
+	return res;
+}
+
+// -------------------------------------------------------------------------------------------------------- registrars
+
+template <typename... Ts>
+struct registrar;
+
+template <>
+struct registrar<>
+{
+	template <class OP>
+	static void add_op(const std::string&, const double, const double, const bool) {}
+	template <class RED>
+	static void add_reduction(const std::string&, const double) {}
+	template <class MEM>
+	static void add_mem(const std::string&, const double) {}
+};
+
+template <typename T, typename... Ts>
+struct registrar<T,Ts...>
+{
+	template <class OP>
+	static void add_op(const std::string &name, const double x0, const double c0, const bool chains)
+	{
+		registry().push_back({name, type_name<T>(), [=](const options &opt)
+		{
+			return run_op<OP,T>(opt, name, x0, c0, chains);
+		}});
+		registrar<Ts...>::template add_op<OP>(name, x0, c0, chains);
+	}
+
+	template <class RED>
+	static void add_reduction(const std::string &name, const double x0)
+	{
+		registry().push_back({name, type_name<T>(), [=](const options &opt)
+		{
+			return run_reduction<RED,T>(opt, name, x0);
+		}});
+		registrar<Ts...>::template add_reduction<RED>(name, x0);
+	}
+
+	template <class MEM>
+	static void add_mem(const std::string &name, const double x0)
+	{
+		registry().push_back({name, type_name<T>(), [=](const options &opt)
+		{
+			return run_mem<MEM,T>(opt, name, x0);
+		}});
+		registrar<Ts...>::template add_mem<MEM>(name, x0);
+	}
+};
+
+struct auto_register
+{
+	explicit auto_register(void (*f)()) { f(); }
+};
+}
+
+#define MIPP_BENCH_CAT_(a, b) a##b
+#define MIPP_BENCH_CAT(a, b) MIPP_BENCH_CAT_(a, b)
+
+// 'MIPP_BENCH(id, name, x0, c0, reg_expr, scalar_expr, types...)' registers the benchmark of an operation for each type
+// of the list: 'reg_expr' (with 'x' and 'c' of type 'Reg<T>') is the MIPP version and 'scalar_expr' (with 'x' and 'c'
+// of type 'T') is the scalar baseline. The latency is measured on the 'x = expr' chain starting from 'x = x0' and
+// 'c = c0', so the expression has to keep 'x' in a range where the operation runs at its nominal speed (no overflow,
+// no denormals).
+#define MIPP_BENCH(ID, NAME, X0, C0, REG_EXPR, SCA_EXPR, ...)                                                         \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		static constexpr bool scalar = true;                                                                           \
+		template <typename T> mipp::Reg<T> operator()(const mipp::Reg<T> x, const mipp::Reg<T> c) const             \
+		{ (void)c; return REG_EXPR; }                                                                                  \
+		template <typename T> T operator()(const T x, const T c) const { (void)c; return SCA_EXPR; }                 \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_op<bench_##ID>(NAME, X0, C0, true); }        \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+// same as 'MIPP_BENCH' for the operations without scalar equivalent (shuffles, horizontal operations...)
+#define MIPP_BENCH_SIMD(ID, NAME, X0, C0, REG_EXPR, ...)                                                              \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		static constexpr bool scalar = false;                                                                          \
+		template <typename T> mipp::Reg<T> operator()(const mipp::Reg<T> x, const mipp::Reg<T> c) const             \
+		{ (void)c; return REG_EXPR; }                                                                                  \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_op<bench_##ID>(NAME, X0, C0, true); }        \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+// array only benchmark (no latency/throughput chains): memory operations
+#define MIPP_BENCH_ARRAY(ID, NAME, REG_EXPR, SCA_EXPR, ...)                                                           \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		static constexpr bool scalar = true;                                                                           \
+		template <typename T> mipp::Reg<T> operator()(const mipp::Reg<T> x, const mipp::Reg<T> c) const             \
+		{ (void)c; return REG_EXPR; }                                                                                  \
+		template <typename T> T operator()(const T x, const T c) const { (void)c; return SCA_EXPR; }                 \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_op<bench_##ID>(NAME, 1, 1, false); }         \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+// 'MIPP_BENCH_REDUCTION(id, name, x0, red_expr, scalar_expr, types...)': 'red_expr' reduces the 'data' array of 'n'
+// elements with MIPP and 'scalar_expr' is the scalar combination of 'a' and 'b' used by the baseline loop
+#define MIPP_BENCH_REDUCTION(ID, NAME, X0, RED_EXPR, SCA_EXPR, ...)                                                   \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		template <typename T> T operator()(const T* data, const size_t n) const { return RED_EXPR; }                  \
+		template <typename T> T operator()(const T a, const T b) const { return SCA_EXPR; }                           \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_reduction<bench_##ID>(NAME, X0); }           \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+// 'MIPP_BENCH_MEM(id, name, x0, reg_stmt, scalar_stmt, types...)' registers a memory benchmark on the 'in' and 'out'
+// arrays (filled from 'x0'): 'reg_stmt' processes the 'mipp::N<T>()' elements starting at 'i' with MIPP and
+// 'scalar_stmt' is the scalar baseline for the element 'i' ('idx' holds the indexes of the gathers and of the scatters)
+#define MIPP_BENCH_MEM(ID, NAME, X0, REG_STMT, SCA_STMT, ...)                                                         \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		template <typename T>                                                                                          \
+		void mipp_loop(const T* in, T* out, const bench::index_t<T>* idx, const size_t n) const                       \
+		{ (void)in; (void)out; (void)idx; for (size_t i = 0; i < n; i += mipp::N<T>()) { REG_STMT; } }               \
+		template <typename T>                                                                                          \
+		void scalar_loop(const T* __restrict in, T* __restrict out, const bench::index_t<T>* idx, const size_t n) const\
+		{ (void)in; (void)out; (void)idx; for (size_t i = 0; i < n; i++) { SCA_STMT; } }                              \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_mem<bench_##ID>(NAME, X0); }                  \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+// same as 'MIPP_BENCH_MEM' for the functions which process the whole array at once: the statements compute the 'n'
+// elements of 'in' (or write their result in 'out[0]')
+#define MIPP_BENCH_ALGO(ID, NAME, X0, REG_STMT, SCA_STMT, ...)                                                        \
+	namespace {                                                                                                        \
+	struct bench_##ID                                                                                                  \
+	{                                                                                                                  \
+		template <typename T>                                                                                          \
+		void mipp_loop(const T* in, T* out, const bench::index_t<T>*, const size_t n) const                          \
+		{ REG_STMT; }                                                                                                  \
+		template <typename T>                                                                                          \
+		void scalar_loop(const T* __restrict in, T* __restrict out, const bench::index_t<T>*, const size_t n) const   \
+		{ SCA_STMT; }                                                                                                  \
+		static void reg() { bench::registrar<__VA_ARGS__>::template add_mem<bench_##ID>(NAME, X0); }                  \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(bench_reg_, ID)(&bench_##ID::reg);                                       \
+	}
+
+#endif /* MIPP_BENCH_HPP_ */
@@ -0,0 +1,35 @@
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_F double, float
+#define MIPP_BENCH_TYPES_I int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#else
+#define MIPP_BENCH_TYPES_F float
+#define MIPP_BENCH_TYPES_I int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#endif
+
+//         id       name       x0    c0    MIPP                        scalar                        types
+MIPP_BENCH(andb,    "andb",    1,    -1,   x & c,                      (T)(x & c),                   MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(andnb,   "andnb",   1,    0,    mipp::andnb(c, x),          (T)(~c & x),                  MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(orb,     "orb",     1,    0,    x | c,                      (T)(x | c),                   MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(xorb,    "xorb",    1,    0,    x ^ c,                      (T)(x ^ c),                   MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(notb,    "notb",    1,    0,    mipp::notb(x),              (T)~x,                        MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(lshift,  "lshift",  1,    0,    mipp::lshift(x, 1),         (T)(x << 1),                  MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(rshift,  "rshift",  1,    0,    mipp::rshift(x, 1),         (T)(x >> 1),                  MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(lshiftr, "lshiftr", 1,    1,    mipp::lshiftr(x, c),        (T)(x << c),                  MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(rshiftr, "rshiftr", 1,    1,    mipp::rshiftr(x, c),        (T)(x >> c),                  MIPP_BENCH_TYPES_I, MIPP_BENCH_TYPES_U)
+
+// the bitwise operations on the floating-point registers (the bits of 'x', no scalar equivalent and no sequential
+// implementation)
+#ifndef MIPP_NO_INTRINSICS
+//              id        name       x0    c0    MIPP                   types
+MIPP_BENCH_SIMD(andb_f,   "andb",    1,    -1,   x & c,                 MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(andnb_f,  "andnb",   1,    0,    mipp::andnb(c, x),     MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(orb_f,    "orb",     1,    0,    x | c,                 MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(xorb_f,   "xorb",    1,    0,    x ^ c,                 MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(notb_f,   "notb",    1,    0,    mipp::notb(x),         MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(lshift_f, "lshift",  1,    0,    mipp::lshift(x, 1),    MIPP_BENCH_TYPES_F)
+MIPP_BENCH_SIMD(rshift_f, "rshift",  1,    0,    mipp::rshift(x, 1),    MIPP_BENCH_TYPES_F)
+#endif
@@ -0,0 +1,21 @@
+#include <cmath>
+#include "bench.hpp"
+
+// the conversions are measured on round trips which keep the type of the chain: 'cvt' to the integers of the same size
+// and back, 'cvt' of the two halves to the elements of twice the size and 'pack' back
+//         id       name                        x0   c0  MIPP                                                  scalar                          types
+MIPP_BENCH(cvt_f32, "cvt<float,int32_t>+cvt",   1.5, 0,  (mipp::cvt<int32_t,float>(mipp::cvt<float,int32_t>(x))), (T)(int32_t)std::nearbyint(x), float)
+#if defined(MIPP_64BIT)
+MIPP_BENCH(cvt_f64, "cvt<double,int64_t>+cvt",  1.5, 0,  (mipp::cvt<int64_t,double>(mipp::cvt<double,int64_t>(x))), (T)(int64_t)std::nearbyint(x), double)
+#endif
+
+#define MIPP_BENCH_CVT_PACK(T1, T2) (mipp::pack<T2,T1>(mipp::cvt<T1,T2>(x.low()), mipp::cvt<T1,T2>(x.high())))
+//              id       name                        x0  c0  MIPP                                    types
+MIPP_BENCH_SIMD(cvt_i8,  "cvt<int8_t,int16_t>+pack",   1,  0,  MIPP_BENCH_CVT_PACK(int8_t,   int16_t ), int8_t  )
+MIPP_BENCH_SIMD(cvt_i16, "cvt<int16_t,int32_t>+pack",  1,  0,  MIPP_BENCH_CVT_PACK(int16_t,  int32_t ), int16_t )
+MIPP_BENCH_SIMD(cvt_u8,  "cvt<uint8_t,uint16_t>+pack", 1,  0,  MIPP_BENCH_CVT_PACK(uint8_t,  uint16_t), uint8_t )
+MIPP_BENCH_SIMD(cvt_u16, "cvt<uint16_t,uint32_t>+pack",1,  0,  MIPP_BENCH_CVT_PACK(uint16_t, uint32_t), uint16_t)
+#if defined(MIPP_64BIT)
+MIPP_BENCH_SIMD(cvt_i32, "cvt<int32_t,int64_t>+pack",  1,  0,  MIPP_BENCH_CVT_PACK(int32_t,  int64_t ), int32_t )
+MIPP_BENCH_SIMD(cvt_u32, "cvt<uint32_t,uint64_t>+pack",1,  0,  MIPP_BENCH_CVT_PACK(uint32_t, uint64_t), uint32_t)
+#endif
@@ -0,0 +1,21 @@
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_ALL double, float, int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#else
+#define MIPP_BENCH_TYPES_ALL float, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#endif
+
+// the comparisons are returning masks, they are measured with the 'blend' which consumes the mask
+//         id      name           x0  c0  MIPP                              scalar              types
+MIPP_BENCH(cmpeq,  "cmpeq+blend", 1,  2,  mipp::blend(c, x, x == c),        x == c ? c : x,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(cmpneq, "cmpneq+blend",1,  2,  mipp::blend(c, x, x != c),        x != c ? c : x,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(cmplt,  "cmplt+blend", 1,  2,  mipp::blend(x, c, x <  c),        x <  c ? x : c,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(cmple,  "cmple+blend", 1,  2,  mipp::blend(x, c, x <= c),        x <= c ? x : c,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(cmpgt,  "cmpgt+blend", 1,  2,  mipp::blend(c, x, x >  c),        x >  c ? c : x,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH(cmpge,  "cmpge+blend", 1,  2,  mipp::blend(x, c, x >= c),        x >= c ? x : c,     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// 'toReg' converts the mask into a register of all ones or of zeros
+MIPP_BENCH(toReg,  "cmplt+toReg", 1,  2,  mipp::toReg<T>(x < c) & c,        x < c ? c : (T)0,   MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
@@ -0,0 +1,205 @@
+// MIPP microbenchmarks: latency and throughput of the MIPP functions against scalar and auto-vectorized baselines.
+//   usage: run_bench [--filter <str>] [--json <file>] [--min-time <ms>] [--reps <n>] [--elmts <n>]
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+#ifndef MIPP_BENCH_CXX_FLAGS
+#define MIPP_BENCH_CXX_FLAGS ""
+#endif
+
+static std::string compiler_name()
+{
+	std::stringstream ss;
+#if defined(__clang__)
+	ss << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__INTEL_COMPILER)
+	ss << "icc " << __INTEL_COMPILER;
+#elif defined(__GNUC__)
+	ss << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+	ss << "msvc " << _MSC_VER;
+#else
+	ss << "unknown";
+#endif
+	return ss.str();
+}
+
+static std::string json_string(const std::string &s)
+{
+	std::string res = "\"";
+	for (auto ch : s)
+	{
+		switch (ch)
+		{
+			case '"':  res += "\\\""; break;
+			case '\\': res += "\\\\"; break;
+			case '\n': res += "\\n";  break;
+			case '\t': res += "\\t";  break;
+			default:   res += ch;     break;
+		}
+	}
+	return res + "\"";
+}
+
+static std::string json_number(const double v)
+{
+	if (v < 0.)
+		return "null";
+	std::stringstream ss;
+	ss << std::setprecision(4) << v;
+	return ss.str();
+}
+
+static void write_json(std::ostream &os, const bench::options &opt, const double ghz,
+                       const std::vector<bench::result> &results)
+{
+	os << "{" << std::endl;
+	os << "  \"context\": {" << std::endl;
+	os << "    \"mipp_isa\": "          << json_string(mipp::InstructionFullType) << "," << std::endl;
+	os << "    \"mipp_register_bits\": " << mipp::RegisterSizeBit << "," << std::endl;
+	os << "    \"mipp_extensions\": [";
+	auto ext = mipp::InstructionExtensions();
+	for (size_t e = 0; e < ext.size(); e++)
+		os << (e ? ", " : "") << json_string(ext[e]);
+	os << "]," << std::endl;
+	os << "    \"compiler\": "  << json_string(compiler_name())      << "," << std::endl;
+	os << "    \"cxx_flags\": " << json_string(MIPP_BENCH_CXX_FLAGS) << "," << std::endl;
+	os << "    \"ghz_estimate\": " << json_number(ghz) << "," << std::endl;
+	os << "    \"min_time_ms\": "  << opt.min_time     << "," << std::endl;
+	os << "    \"n_reps\": "       << opt.n_reps       << "," << std::endl;
+	os << "    \"n_elmts\": "      << opt.n_elmts      << std::endl;
+	os << "  }," << std::endl;
+	os << "  \"unit\": \"ns\"," << std::endl;
+	os << "  \"results\": [" << std::endl;
+	for (size_t r = 0; r < results.size(); r++)
+	{
+		auto &res = results[r];
+		os << "    {\"name\": " << json_string(res.name) << ", \"type\": " << json_string(res.type)
+		   << ", \"lanes\": " << res.lanes << ", \"supported\": " << (res.supported ? "true" : "false");
+		if (res.supported)
+		{
+			os << ", \"mipp\": {\"latency\": "     << json_number(res.mipp_latency)
+			   << ", \"throughput\": "             << json_number(res.mipp_throughput)
+			   << ", \"array_per_elmt\": "         << json_number(res.mipp_array) << "}"
+			   << ", \"scalar\": {\"latency\": "   << json_number(res.scalar_latency)
+			   << ", \"throughput\": "             << json_number(res.scalar_throughput) << "}"
+			   << ", \"autovec\": {\"array_per_elmt\": " << json_number(res.autovec_array) << "}";
+		}
+		else
+			os << ", \"error\": " << json_string(res.error);
+		os << "}" << (r + 1 < results.size() ? "," : "") << std::endl;
+	}
+	os << "  ]" << std::endl;
+	os << "}" << std::endl;
+}
+
+// the table is in cycles (estimated from the frequency), JSON stays in ns
+static std::string cell(const double ns, const double ghz)
+{
+	if (ns < 0.)
+		return "-";
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(2) << ns * ghz;
+	return ss.str();
+}
+
+int main(int argc, char** argv)
+{
+	bench::options opt;
+	std::string json_file = "";
+
+	for (auto a = 1; a < argc; a++)
+	{
+		std::string arg = argv[a];
+		if (a + 1 >= argc && arg != "--help")
+		{
+			std::cerr << "Missing value for '" << arg << "'." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if      (arg == "--filter"  ) opt.filter   = argv[++a];
+		else if (arg == "--json"    ) json_file    = argv[++a];
+		else if (arg == "--min-time") opt.min_time = std::atof(argv[++a]);
+		else if (arg == "--reps"    ) opt.n_reps   = std::max(1, std::atoi(argv[++a]));
+		else if (arg == "--elmts"   ) opt.n_elmts  = (size_t)std::max(1, std::atoi(argv[++a]));
+		else
+		{
+			std::cerr << "usage: " << argv[0] << " [--filter <str>] [--json <file>] [--min-time <ms>] [--reps <n>] "
+			          << "[--elmts <n>]" << std::endl;
+			return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	// the MIPP array kernels are processing full registers only
+	constexpr size_t max_lanes = (size_t)mipp::N<int8_t>();
+	opt.n_elmts = ((opt.n_elmts + max_lanes -1) / max_lanes) * max_lanes;
+
+	const double ghz = bench::ghz_estimate(opt);
+
+	std::cout << "# MIPP ISA:   " << mipp::InstructionFullType << " (" << mipp::RegisterSizeBit << "-bit)" << std::endl;
+	std::cout << "# Compiler:   " << compiler_name() << " " << MIPP_BENCH_CXX_FLAGS << std::endl;
+	std::cout << "# Frequency:  " << std::setprecision(3) << ghz << " GHz (estimated, all the values are in cycles)"
+	          << std::endl;
+	std::cout << "# lat = latency, tput = reciprocal throughput (per call), elmt = per array element" << std::endl;
+	std::cout << "#" << std::endl;
+
+	const int w = 10;
+	std::cout << std::left << std::setw(32) << "# function" << std::setw(10) << "type" << std::right
+	          << std::setw(6) << "lanes"
+	          << std::setw(w) << "mipp lat" << std::setw(w) << "mipp tput" << std::setw(w) << "mipp elmt"
+	          << std::setw(w) << "sca lat"  << std::setw(w) << "sca tput"  << std::setw(w) << "auto elmt"
+	          << std::setw(w) << "speedup"  << std::endl;
+
+	std::vector<bench::result> results;
+	for (auto &e : bench::registry())
+	{
+		if (!opt.filter.empty() && e.name.find(opt.filter) == std::string::npos)
+			continue;
+
+		auto res = e.run(opt);
+		results.push_back(res);
+
+		std::cout << std::left << std::setw(32) << ("  " + res.name) << std::setw(10) << res.type << std::right
+		          << std::setw(6) << res.lanes;
+		if (!res.supported)
+		{
+			std::cout << "  (unsupported)" << std::endl;
+			continue;
+		}
+		std::string speedup = "-";
+		if (res.mipp_array > 0. && res.autovec_array > 0.)
+		{
+			std::stringstream ss;
+			ss << std::fixed << std::setprecision(2) << res.autovec_array / res.mipp_array << "x";
+			speedup = ss.str();
+		}
+		std::cout << std::setw(w) << cell(res.mipp_latency,      ghz)
+		          << std::setw(w) << cell(res.mipp_throughput,   ghz)
+		          << std::setw(w) << cell(res.mipp_array,        ghz)
+		          << std::setw(w) << cell(res.scalar_latency,    ghz)
+		          << std::setw(w) << cell(res.scalar_throughput, ghz)
+		          << std::setw(w) << cell(res.autovec_array,     ghz)
+		          << std::setw(w) << speedup << std::endl;
+	}
+
+	if (!json_file.empty())
+	{
+		std::ofstream file(json_file);
+		if (!file.is_open())
+		{
+			std::cerr << "Can't open '" << json_file << "'." << std::endl;
+			return EXIT_FAILURE;
+		}
+		write_json(file, opt, ghz, results);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cmath>
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_F double, float
+#else
+#define MIPP_BENCH_TYPES_F float
+#endif
+
+// the chains are converging to a fixed point in the normal range: 'exp(0 - x)' -> 0.567, 'log(x) + 2' -> 3.146, 'cos(x)'
+// -> 0.739 and 'sin(x)', 'tanh(x)' are slowly decreasing
+//         id      name      x0    c0    MIPP                        scalar                        types
+MIPP_BENCH(exp,    "exp",    0,    0,    mipp::exp(c - x),           std::exp(c - x),              MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log,    "log",    2,    2,    mipp::log(x) + c,           std::log(x) + c,              MIPP_BENCH_TYPES_F)
+MIPP_BENCH(sin,    "sin",    1,    0,    mipp::sin(x),               std::sin(x),                  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cos,    "cos",    1,    0,    mipp::cos(x),               std::cos(x),                  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(tanh,   "tanh",   1,    0,    mipp::tanh(x),              std::tanh(x),                 MIPP_BENCH_TYPES_F)
+
+// the other accuracy tiers of the same functions
+//         id        name               x0  c0  MIPP                                   scalar            types
+MIPP_BENCH(exp_f,    "exp<fast>",       0,  0,  (mipp::exp<T,mipp::fast   >(c - x)),   std::exp(c - x),  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(exp_p,    "exp<precise>",    0,  0,  (mipp::exp<T,mipp::precise>(c - x)),   std::exp(c - x),  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log_f,    "log<fast>",       2,  2,  (mipp::log<T,mipp::fast   >(x)) + c,   std::log(x) + c,  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log_p,    "log<precise>",    2,  2,  (mipp::log<T,mipp::precise>(x)) + c,   std::log(x) + c,  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(sin_f,    "sin<fast>",       1,  0,  (mipp::sin<T,mipp::fast   >(x)),       std::sin(x),      MIPP_BENCH_TYPES_F)
+MIPP_BENCH(sin_p,    "sin<precise>",    1,  0,  (mipp::sin<T,mipp::precise>(x)),       std::sin(x),      MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cos_f,    "cos<fast>",       1,  0,  (mipp::cos<T,mipp::fast   >(x)),       std::cos(x),      MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cos_p,    "cos<precise>",    1,  0,  (mipp::cos<T,mipp::precise>(x)),       std::cos(x),      MIPP_BENCH_TYPES_F)
+
+// 'sincos' and 'cossin' return two registers: the chain is 'sin(x) + cos(x)' -> 1.259
+#define MIPP_BENCH_SUM2(R) [](const mipp::Regx2<T> r) { return r.val[0] + r.val[1]; }(R)
+MIPP_BENCH(sincos,   "sincos",          1,  0,  MIPP_BENCH_SUM2(mipp::sincos(x)),      std::sin(x) + std::cos(x), MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cossin,   "cossin",          1,  0,  MIPP_BENCH_SUM2(mipp::cossin(x)),      std::cos(x) + std::sin(x), MIPP_BENCH_TYPES_F)
+
+// 'exp2(0 - x)' -> 0.641, 'expm1(0 - x)' slowly going to 0, 'log2(x) + 2' -> 4, 'log10(x) + 1' -> 1, 'log1p(x) + 1'
+// -> 2.146, 'cbrt(x)' -> 1, 'pow(x, 0.5)' -> 1, 'powi(x, 3)' stays at 1, 'tan(x) * 0.25 + 0.25' -> 0.338
+MIPP_BENCH(exp2,     "exp2",            0,  0,  mipp::exp2(c - x),                     std::exp2(c - x),  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(expm1,    "expm1",           1,  0,  mipp::expm1(c - x),                    std::expm1(c - x), MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log2,     "log2",            2,  2,  mipp::log2(x) + c,                     std::log2(x) + c,  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log10,    "log10",           2,  1,  mipp::log10(x) + c,                    std::log10(x) + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(log1p,    "log1p",           2,  1,  mipp::log1p(x) + c,                    std::log1p(x) + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cbrt,     "cbrt",            2,  0,  mipp::cbrt(x),                         std::cbrt(x),      MIPP_BENCH_TYPES_F)
+MIPP_BENCH(pow,      "pow",             2,  0.5,mipp::pow(x, c),                       std::pow(x, c),    MIPP_BENCH_TYPES_F)
+MIPP_BENCH(powi,     "powi",            1,  0,  mipp::powi(x, 3),                      x * x * x,         MIPP_BENCH_TYPES_F)
+MIPP_BENCH(tan,      "tan",             1,  0.25, mipp::fmadd(mipp::tan(x), c, c),     std::tan(x) * c + c, MIPP_BENCH_TYPES_F)
+
+// 'atan(x) + 1' -> 2.132, 'atan2(1, x)' -> 0.860, 'asin(x) * 0.25 + 0.25' -> 0.335, 'acos(x) * 0.5' -> 0.515
+MIPP_BENCH(atan,     "atan",            1,  1,  mipp::atan(x) + c,                     std::atan(x) + c,  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(atan2,    "atan2",           1,  1,  mipp::atan2(c, x),                     std::atan2(c, x),  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(asin,     "asin",            0.5, 0.25, mipp::fmadd(mipp::asin(x), c, c),   std::asin(x) * c + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(acos,     "acos",            0.5, 0.5, mipp::acos(x) * c,                   std::acos(x) * c,  MIPP_BENCH_TYPES_F)
+
+// 'sinh(x) * 0.25 + 0.25' -> 0.335, 'cosh(x) * 0.5' -> 0.589, 'asinh(x) + 1' -> 2.729, 'acosh(x) + 2' -> 4.085,
+// 'atanh(x) * 0.25 + 0.25' -> 0.338
+MIPP_BENCH(sinh,     "sinh",            0.5, 0.25, mipp::fmadd(mipp::sinh(x), c, c),   std::sinh(x) * c + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(cosh,     "cosh",            0.5, 0.5, mipp::cosh(x) * c,                   std::cosh(x) * c,  MIPP_BENCH_TYPES_F)
+MIPP_BENCH(asinh,    "asinh",           1,  1,  mipp::asinh(x) + c,                    std::asinh(x) + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(acosh,    "acosh",           4,  2,  mipp::acosh(x) + c,                    std::acosh(x) + c, MIPP_BENCH_TYPES_F)
+MIPP_BENCH(atanh,    "atanh",           0.5, 0.25, mipp::fmadd(mipp::atanh(x), c, c),  std::atanh(x) * c + c, MIPP_BENCH_TYPES_F)
+
+// 'sigmoid(x)' -> 0.659, 'softplus(x) * 0.5' -> 0.48, 'logaddexp(x * 0.5, 0.5)' -> 1.26, 'erf(x)' -> 0.617,
+// 'erfc(x)' -> 0.489
+MIPP_BENCH(sigmoid,  "sigmoid",         0,  0,  mipp::sigmoid(x),                      1 / (1 + std::exp(-x)), MIPP_BENCH_TYPES_F)
+MIPP_BENCH(softplus, "softplus",        1,  0.5, mipp::softplus(x) * c,                (std::max(x, (T)0) + std::log1p(std::exp(-std::abs(x)))) * c,
+           MIPP_BENCH_TYPES_F)
+MIPP_BENCH(logaddexp,"logaddexp",       1,  0.5, mipp::logaddexp(x * c, c),            std::max(x * c, c) + std::log1p(std::exp(-std::abs(x * c - c))),
+           MIPP_BENCH_TYPES_F)
+MIPP_BENCH(erf,      "erf",             1,  0,  mipp::erf(x),                          std::erf(x),       MIPP_BENCH_TYPES_F)
+MIPP_BENCH(erfc,     "erfc",            1,  0,  mipp::erfc(x),                         std::erfc(x),      MIPP_BENCH_TYPES_F)
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_ALL double, float, int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#define MIPP_BENCH_TYPES_32_64 double, float, int64_t, int32_t, uint64_t, uint32_t
+#else
+#define MIPP_BENCH_TYPES_ALL float, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#define MIPP_BENCH_TYPES_32_64 float, int32_t, uint32_t
+#endif
+
+//               id      name          MIPP   scalar   types
+MIPP_BENCH_ARRAY(copy,   "load+store", x,     x,       MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// one register of the 'in' array at 'i' (the unaligned accesses are shifted by one element), the masked accesses
+// process 'N - 1' elements
+#define MIPP_BENCH_N (mipp::N<T>() - 1)
+//             id       name               x0  MIPP                                                                     scalar                          types
+MIPP_BENCH_MEM(loadu,   "loadu+storeu",    1,  mipp::Reg<T> r; r.loadu(in + i + 1); r.storeu(out + i + 1),            out[i + 1] = in[i + 1],          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(load_n,  "load_n+store_n",  1,  mipp::Reg<T> r; r.load_n(in + i, MIPP_BENCH_N); r.store_n(out + i, MIPP_BENCH_N), out[i] = in[i],        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(loadu_n, "loadu_n+storeu_n",1,  mipp::Reg<T> r; r.loadu_n(in + i + 1, MIPP_BENCH_N); r.storeu_n(out + i + 1, MIPP_BENCH_N), out[i + 1] = in[i + 1], MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(set,     "set+store",       1,  mipp::Reg<T> r; r.set(in + i); r.store(out + i),                       out[i] = in[i],                  MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(set1,    "set1+store",      1,  mipp::Reg<T> r; r.set1(in[i]); r.store(out + i),                       out[i] = in[i - i % mipp::N<T>()], MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(set0,    "set0+store",      1,  mipp::Reg<T> r; r.set0(); r.store(out + i),                            out[i] = (T)0,                   MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_MEM(gather,  "gather+store",    1,  (mipp::gather<T,bench::index_t<T>>(in, mipp::Reg<bench::index_t<T>>(idx + i))).store(out + i),
+                                                                                                                        out[i] = in[idx[i]],             MIPP_BENCH_TYPES_32_64)
+MIPP_BENCH_MEM(scatter, "load+scatter",    1,  (mipp::scatter<T,bench::index_t<T>>(out, mipp::Reg<bench::index_t<T>>(idx + i), mipp::Reg<T>(in + i))),
+                                                                                                                        out[idx[i]] = in[i],             MIPP_BENCH_TYPES_32_64)
+
+// the non-temporal stores are followed by a 'sfence', 'compress_store' and 'filter' keep the elements greater than 4
+// (half of them)
+//              id         name              x0  MIPP / scalar
+MIPP_BENCH_ALGO(stream,    "load+stream",    1,  for (size_t i = 0; i < n; i += mipp::N<T>()) mipp::Reg<T>(in + i).stream(out + i); mipp::sfence(),
+                                                 std::copy(in, in + n, out),
+                                                 MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(cstore,    "compress_store", 1,  size_t j = 0; for (size_t i = 0; i < n; i += mipp::N<T>()) { const mipp::Reg<T> r = in + i;
+                                                 j += mipp::compress_store(out + j, r, r > mipp::Reg<T>((T)4)); },
+                                                 size_t j = 0; for (size_t i = 0; i < n; i++) if (in[i] > (T)4) out[j++] = in[i],
+                                                 MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(filter,    "filter",         1,  mipp::filter(in, n, out, [](const mipp::Reg<T> r) { return r > mipp::Reg<T>((T)4); }),
+                                                 size_t j = 0; for (size_t i = 0; i < n; i++) if (in[i] > (T)4) out[j++] = in[i],
+                                                 MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(transform, "transform<mul>", 1,  mipp::transform(in, n, out, [](const mipp::Reg<T> r) { return r * r; }),
+                                                 for (size_t i = 0; i < n; i++) out[i] = in[i] * in[i],
+                                                 MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(copy_fn,   "copy",           1,  mipp::copy(in, n, out),
+                                                 std::copy(in, in + n, out),
+                                                 MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
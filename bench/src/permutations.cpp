@@ -0,0 +1,36 @@
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_ALL double, float, int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#else
+#define MIPP_BENCH_TYPES_ALL float, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#endif
+
+//              id             name            x0  c0  MIPP                                        types
+MIPP_BENCH_SIMD(rrot,          "rrot",         1,  2,  mipp::rrot(x),                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(lrot,          "lrot",         1,  2,  mipp::lrot(x),                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavelo,  "interleavelo", 1,  2,  mipp::interleavelo(x, c),                   MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavehi,  "interleavehi", 1,  2,  mipp::interleavehi(x, c),                   MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavelo2, "interleavelo2",1,  2,  mipp::interleavelo2(x, c),                  MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavehi2, "interleavehi2",1,  2,  mipp::interleavehi2(x, c),                  MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavelo4, "interleavelo4",1,  2,  mipp::interleavelo4(x, c),                  MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleavehi4, "interleavehi4",1,  2,  mipp::interleavehi4(x, c),                  MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(combine,       "high+low+combine", 1, 2, mipp::combine(x.high(), x.low()),        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(extract,       "extract+set1", 1,  2,  mipp::Reg<T>(mipp::extract(x, 1)),           MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// the functions returning two registers: the chain goes through the first one
+MIPP_BENCH_SIMD(interleave,    "interleave",   1,  2,  mipp::interleave(x, c).val[0],              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(deinterleave,  "deinterleave", 1,  2,  mipp::deinterleave(x, c).val[0],            MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleave2,   "interleave2",  1,  2,  mipp::interleave2(x, c).val[0],             MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(interleave4,   "interleave4",  1,  2,  mipp::interleave4(x, c).val[0],             MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// the shuffles take their control register from 'c' (all the elements from the first one, the cost does not depend on
+// the pattern), 'blend', 'compress' and 'expand' take their mask from the sign of 'c' (all the elements are selected)
+MIPP_BENCH_SIMD(shuff,         "shuff",        1,  0,  mipp::shuff(x, c),                          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(shuff2,        "shuff2",       1,  0,  mipp::shuff2(x, c),                         MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(shuff4,        "shuff4",       1,  0,  mipp::shuff4(x, c),                         MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(blend,         "blend",        1,  -1, mipp::blend(x, c, mipp::sign(c)),           MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(compress,      "compress",     1,  -1, mipp::compress(x, mipp::sign(c)),           MIPP_BENCH_TYPES_ALL)
+MIPP_BENCH_SIMD(expand,        "expand",       1,  -1, mipp::expand(x, mipp::sign(c)),             MIPP_BENCH_TYPES_ALL)
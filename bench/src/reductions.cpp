@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <numeric>
+#include "bench.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_BENCH_TYPES_F double, float
+#define MIPP_BENCH_TYPES_ALL double, float, int64_t, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint64_t, uint32_t, uint16_t, uint8_t
+#else
+#define MIPP_BENCH_TYPES_F float
+#define MIPP_BENCH_TYPES_ALL float, int32_t, int16_t, int8_t
+#define MIPP_BENCH_TYPES_U uint32_t, uint16_t, uint8_t
+#endif
+
+// horizontal operations, the result is broadcast to keep the dependency chain
+//              id      name         x0    c0    MIPP                                        types
+MIPP_BENCH_SIMD(hadd,   "hadd",      0,    0,    mipp::Reg<T>(x.hadd()),                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(hmul,   "hmul",      1,    0,    mipp::Reg<T>(x.hmul()),                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(hmin,   "hmin",      1,    0,    mipp::Reg<T>(x.hmin()),                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(hmax,   "hmax",      1,    0,    mipp::Reg<T>(x.hmax()),                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(argmin, "argmin",    0,    0,    mipp::Reg<T>((T)mipp::argmin(x).second),    MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(argmax, "argmax",    0,    0,    mipp::Reg<T>((T)mipp::argmax(x).second),    MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(scan,   "scan",      0,    0,    mipp::scan(x),                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(scan_e, "scan_excl", 0,    0,    mipp::scan_excl(x, (T)0),                   MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// the tests of the registers and of the masks ('x < c' alternates between all true and all false)
+MIPP_BENCH_SIMD(testz,  "testz",     0,    1,    mipp::Reg<T>((T)mipp::testz(x, c)),         MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(testz_m,"cmplt+testz", 0,  1,    mipp::Reg<T>((T)mipp::testz(x < c)),        MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(to_bits,"cmplt+to_bits", 0, 1,   mipp::Reg<T>((T)(mipp::to_bits(x < c) & 1)), MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(popcnt, "cmplt+popcnt", 0, 1,    mipp::Reg<T>((T)mipp::popcnt(x < c)),       MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(ctz,    "cmplt+ctz", 0,    1,    mipp::Reg<T>((T)mipp::ctz(x < c)),          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(clz,    "cmplt+clz", 0,    1,    mipp::Reg<T>((T)mipp::clz(x < c)),          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(any,    "cmplt+any", 0,    1,    mipp::Reg<T>((T)mipp::any(x < c)),          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_SIMD(all,    "cmplt+all", 0,    1,    mipp::Reg<T>((T)mipp::all(x < c)),          MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// whole array reductions against the scalar loop (auto-vectorized only for the integers or with '-ffast-math')
+//                   id         name                x0  MIPP                                               scalar
+MIPP_BENCH_REDUCTION(red_add,   "reduction<add>",   0,  (mipp::Reduction<T,mipp::add>::apply(data, n)),    a + b,
+                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_REDUCTION(red_min,   "reduction<min>",   0,  (mipp::Reduction<T,mipp::min>::apply(data, n)),    std::min(a, b),
+                     MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+
+// the other whole array functions, the scalar loops compute the same results
+//              id          name          x0  MIPP / scalar
+MIPP_BENCH_ALGO(argmin_a,   "argmin",     1,  out[0] = (T)mipp::argmin(in, n).second,
+                                              out[0] = (T)(std::min_element(in, in + n) - in),
+                                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(argmax_a,   "argmax",     1,  out[0] = (T)mipp::argmax(in, n).second,
+                                              out[0] = (T)(std::max_element(in, in + n) - in),
+                                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(scan_a,     "scan",       1,  mipp::scan(in, n, out),
+                                              std::partial_sum(in, in + n, out),
+                                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(scan_e_a,   "scan_excl",  1,  mipp::scan_excl(in, n, out, (T)0),
+                                              T s = 0; for (size_t i = 0; i < n; i++) { out[i] = s; s += in[i]; },
+                                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(dot,        "dot",        1,  out[0] = mipp::dot(in, in, n),
+                                              out[0] = std::inner_product(in, in + n, in, (T)0),
+                                              MIPP_BENCH_TYPES_ALL, MIPP_BENCH_TYPES_U)
+MIPP_BENCH_ALGO(dot_kahan,  "dot_kahan",  1,  out[0] = mipp::dot_kahan(in, in, n),
+                                              out[0] = std::inner_product(in, in + n, in, (T)0),
+                                              MIPP_BENCH_TYPES_F)
@@ -0,0 +1,76 @@
+#include <cmath>
+#include "ulp.hpp"
+
+#if defined(MIPP_64BIT)
+#define MIPP_ULP_TYPES_F double, float
+#else
+#define MIPP_ULP_TYPES_F float
+#endif
+
+// the domains exclude the overflows and the results in the denormal range, the 'sin' and 'cos' bounds are the ones of
+// the documentation of each tier (the Cephes reduction of 'balanced' is accurate up to 8192 in single precision)
+#define EXP_LO std::log(std::numeric_limits<T>::min())
+#define EXP_HI std::log(std::numeric_limits<T>::max())
+#define POS_LO std::numeric_limits<T>::min()
+#define POS_HI std::numeric_limits<T>::max()
+#define EXP2_LO std::log2(std::numeric_limits<T>::min())
+#define EXP2_HI std::log2(std::numeric_limits<T>::max())
+#define POW_LO  std::pow(std::numeric_limits<T>::min(), (T)0.4)
+#define POW_HI  std::pow(std::numeric_limits<T>::max(), (T)0.4)
+#define POWI_LO (T)1e-12
+#define POWI_HI (T)1e12
+#define TRIG(F, D) (T)(sizeof(T) == sizeof(float) ? (F) : (D))
+#define ERFC_HI TRIG(9.1, 26.5)
+#define LOGADDEXP(A, B) (std::max(A, B) + std::log1p(std::exp(-std::abs((A) - (B)))))
+
+//       id                 name         tier        lo                hi               MIPP                                                         exact                    types
+MIPP_ULP(exp_fast,          "exp",       "fast",     EXP_LO,           EXP_HI,          (mipp::exp<T,mipp::fast>(x)),                                std::exp(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(exp,               "exp",       "balanced", EXP_LO,           EXP_HI,          mipp::exp(x),                                                std::exp(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(exp_precise,       "exp",       "precise",  EXP_LO,           EXP_HI,          (mipp::exp<T,mipp::precise>(x)),                             std::exp(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(log_fast,          "log",       "fast",     POS_LO,           POS_HI,          (mipp::log<T,mipp::fast>(x)),                                std::log(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(log,               "log",       "balanced", POS_LO,           POS_HI,          mipp::log(x),                                                std::log(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(log_precise,       "log",       "precise",  POS_LO,           POS_HI,          (mipp::log<T,mipp::precise>(x)),                             std::log(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(exp2,              "exp2",      "",         EXP2_LO,          EXP2_HI,         mipp::exp2(x),                                               std::exp2(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(expm1,             "expm1",     "",         EXP_LO,           EXP_HI,          mipp::expm1(x),                                              std::expm1(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(log2,              "log2",      "",         POS_LO,           POS_HI,          mipp::log2(x),                                               std::log2(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(log10,             "log10",     "",         POS_LO,           POS_HI,          mipp::log10(x),                                              std::log10(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(log1p,             "log1p",     "",         (T)-1,            POS_HI,          mipp::log1p(x),                                              std::log1p(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(cbrt,              "cbrt",      "",         -POS_HI,          POS_HI,          mipp::cbrt(x),                                               std::cbrt(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(pow_x,             "pow",       "x^2.5",    POW_LO,           POW_HI,          mipp::pow(x, mipp::Reg<T>((T)2.5)),                          std::pow(x, 2.5L),       MIPP_ULP_TYPES_F)
+MIPP_ULP(pow_y,             "pow",       "0.75^y",   -TRIG(300, 2400), TRIG(300, 2400), mipp::pow(mipp::Reg<T>((T)0.75), x),                         std::pow(0.75L, x),      MIPP_ULP_TYPES_F)
+MIPP_ULP(powi,              "powi",      "x^-3",     POWI_LO,          POWI_HI,         mipp::powi(x, -3),                                           std::pow(x, -3),         MIPP_ULP_TYPES_F)
+MIPP_ULP(sin_fast,          "sin",       "fast",     -TRIG(1e3, 1e6),  TRIG(1e3, 1e6),  (mipp::sin<T,mipp::fast>(x)),                                std::sin(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(sin,               "sin",       "balanced", -TRIG(8192, 1e6), TRIG(8192, 1e6), mipp::sin(x),                                                std::sin(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(sin_precise,       "sin",       "precise",  -TRIG(1e4, 1e6),  TRIG(1e4, 1e6),  (mipp::sin<T,mipp::precise>(x)),                             std::sin(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(cos_fast,          "cos",       "fast",     -TRIG(1e3, 1e6),  TRIG(1e3, 1e6),  (mipp::cos<T,mipp::fast>(x)),                                std::cos(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(cos,               "cos",       "balanced", -TRIG(8192, 1e6), TRIG(8192, 1e6), mipp::cos(x),                                                std::cos(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(cos_precise,       "cos",       "precise",  -TRIG(1e4, 1e6),  TRIG(1e4, 1e6),  (mipp::cos<T,mipp::precise>(x)),                             std::cos(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(tan,               "tan",       "",         -TRIG(8192, 1e6), TRIG(8192, 1e6), mipp::tan(x),                                                std::tan(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(atan,              "atan",      "",         -POS_HI,          POS_HI,          mipp::atan(x),                                               std::atan(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(atan2,             "atan2",     "",         -POS_HI,          POS_HI,          mipp::atan2(x, mipp::Reg<T>((T)-1.5)),                       std::atan2(x, -1.5L),    MIPP_ULP_TYPES_F)
+MIPP_ULP(asin,              "asin",      "",         (T)-1,            (T)1,            mipp::asin(x),                                               std::asin(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(acos,              "acos",      "",         (T)-1,            (T)1,            mipp::acos(x),                                               std::acos(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(sinh,              "sinh",      "",         (T)-80,           (T)80,           mipp::sinh(x),                                               std::sinh(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(cosh,              "cosh",      "",         (T)-80,           (T)80,           mipp::cosh(x),                                               std::cosh(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(asinh,             "asinh",     "",         (T)-1e15,         (T)1e15,         mipp::asinh(x),                                              std::asinh(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(acosh,             "acosh",     "",         (T)1,             (T)1e15,         mipp::acosh(x),                                              std::acosh(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(atanh,             "atanh",     "",         (T)-1,            (T)1,            mipp::atanh(x),                                              std::atanh(x),           MIPP_ULP_TYPES_F)
+MIPP_ULP(sqrt,              "sqrt",      "",         (T)0,             POS_HI,          mipp::sqrt(x),                                               std::sqrt(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(tanh_fast,         "tanh",      "fast",     (T)-40,           (T)40,           (mipp::tanh<T,mipp::fast>(x)),                               std::tanh(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(tanh,              "tanh",      "balanced", (T)-40,           (T)40,           mipp::tanh(x),                                               std::tanh(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(tanh_precise,      "tanh",      "precise",  (T)-40,           (T)40,           (mipp::tanh<T,mipp::precise>(x)),                            std::tanh(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(sigmoid_fast,      "sigmoid",   "fast",     EXP_LO,           -EXP_LO,         (mipp::sigmoid<T,mipp::fast>(x)),                            1 / (1 + std::exp(-x)),  MIPP_ULP_TYPES_F)
+MIPP_ULP(sigmoid,           "sigmoid",   "balanced", EXP_LO,           -EXP_LO,         mipp::sigmoid(x),                                            1 / (1 + std::exp(-x)),  MIPP_ULP_TYPES_F)
+MIPP_ULP(sigmoid_precise,   "sigmoid",   "precise",  EXP_LO,           -EXP_LO,         (mipp::sigmoid<T,mipp::precise>(x)),                         1 / (1 + std::exp(-x)),  MIPP_ULP_TYPES_F)
+MIPP_ULP(softplus_fast,     "softplus",  "fast",     EXP_LO,           EXP_HI,          (mipp::softplus<T,mipp::fast>(x)),                           LOGADDEXP(x, 0.L),       MIPP_ULP_TYPES_F)
+MIPP_ULP(softplus,          "softplus",  "balanced", EXP_LO,           EXP_HI,          mipp::softplus(x),                                           LOGADDEXP(x, 0.L),       MIPP_ULP_TYPES_F)
+MIPP_ULP(softplus_precise,  "softplus",  "precise",  EXP_LO,           EXP_HI,          (mipp::softplus<T,mipp::precise>(x)),                        LOGADDEXP(x, 0.L),       MIPP_ULP_TYPES_F)
+MIPP_ULP(logaddexp_fast,    "logaddexp", "fast",     EXP_LO,           EXP_HI,          (mipp::logaddexp<T,mipp::fast>(x, mipp::Reg<T>((T)1.5))),    LOGADDEXP(x, 1.5L),      MIPP_ULP_TYPES_F)
+MIPP_ULP(logaddexp,         "logaddexp", "balanced", EXP_LO,           EXP_HI,          mipp::logaddexp(x, mipp::Reg<T>((T)1.5)),                    LOGADDEXP(x, 1.5L),      MIPP_ULP_TYPES_F)
+MIPP_ULP(logaddexp_precise, "logaddexp", "precise",  EXP_LO,           EXP_HI,          (mipp::logaddexp<T,mipp::precise>(x, mipp::Reg<T>((T)1.5))), LOGADDEXP(x, 1.5L),      MIPP_ULP_TYPES_F)
+MIPP_ULP(erf_fast,          "erf",       "fast",     (T)-6,            (T)6,            (mipp::erf<T,mipp::fast>(x)),                                std::erf(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(erf,               "erf",       "balanced", (T)-6,            (T)6,            mipp::erf(x),                                                std::erf(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(erf_precise,       "erf",       "precise",  (T)-6,            (T)6,            (mipp::erf<T,mipp::precise>(x)),                             std::erf(x),             MIPP_ULP_TYPES_F)
+MIPP_ULP(erfc_fast,         "erfc",      "fast",     (T)-3,            ERFC_HI,         (mipp::erfc<T,mipp::fast>(x)),                               std::erfc(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(erfc,              "erfc",      "balanced", (T)-3,            ERFC_HI,         mipp::erfc(x),                                               std::erfc(x),            MIPP_ULP_TYPES_F)
+MIPP_ULP(erfc_precise,      "erfc",      "precise",  (T)-3,            ERFC_HI,         (mipp::erfc<T,mipp::precise>(x)),                            std::erfc(x),            MIPP_ULP_TYPES_F)
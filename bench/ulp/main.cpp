@@ -0,0 +1,177 @@
+// MIPP accuracy sweeps: ULP errors, special values and throughput of the MIPP math functions.
+//   usage: run_ulp [--filter <str>] [--json <file>] [--threads <n>] [--f32-step <k>] [--f64-samples <n>]
+//                  [--min-time <ms>]
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "ulp.hpp"
+
+#ifndef MIPP_BENCH_CXX_FLAGS
+#define MIPP_BENCH_CXX_FLAGS ""
+#endif
+
+static std::string json_string(const std::string &s)
+{
+	std::string res = "\"";
+	for (auto ch : s)
+	{
+		switch (ch)
+		{
+			case '"':  res += "\\\""; break;
+			case '\\': res += "\\\\"; break;
+			case '\n': res += "\\n";  break;
+			case '\t': res += "\\t";  break;
+			default:   res += ch;     break;
+		}
+	}
+	return res + "\"";
+}
+
+static std::string json_number(const double v)
+{
+	std::stringstream ss;
+	ss << std::setprecision(9) << v;
+	return ss.str();
+}
+
+static void write_json(std::ostream &os, const ulp::options &opt, const std::vector<ulp::result> &results)
+{
+	os << "{" << std::endl;
+	os << "  \"context\": {" << std::endl;
+	os << "    \"mipp_isa\": "          << json_string(mipp::InstructionFullType) << "," << std::endl;
+	os << "    \"mipp_register_bits\": " << mipp::RegisterSizeBit << "," << std::endl;
+	os << "    \"cxx_flags\": "         << json_string(MIPP_BENCH_CXX_FLAGS)      << "," << std::endl;
+	os << "    \"threads\": "           << opt.n_threads   << "," << std::endl;
+	os << "    \"f32_step\": "          << opt.f32_step    << "," << std::endl;
+	os << "    \"f64_samples\": "       << opt.f64_samples << std::endl;
+	os << "  }," << std::endl;
+	os << "  \"results\": [" << std::endl;
+	for (size_t r = 0; r < results.size(); r++)
+	{
+		auto &res = results[r];
+		os << "    {\"name\": " << json_string(res.name) << ", \"tier\": " << json_string(res.tier)
+		   << ", \"type\": " << json_string(res.type) << ", \"lanes\": " << res.lanes
+		   << ", \"supported\": " << (res.supported ? "true" : "false");
+		if (res.supported)
+		{
+			os << ", \"domain\": ["      << json_number(res.lo) << ", " << json_number(res.hi) << "]"
+			   << ", \"inputs\": "       << res.n_inputs
+			   << ", \"max_ulp\": "      << json_number(res.err.max_ulp)
+			   << ", \"max_ulp_at\": "   << json_number(res.err.max_at)
+			   << ", \"mean_ulp\": "     << json_number(res.err.mean_ulp())
+			   << ", \"max_rel\": "      << json_number(res.err.max_rel)
+			   << ", \"special_errors\": " << res.err.n_special;
+			if (res.err.n_special)
+				os << ", \"special_error_at\": " << json_number(res.err.special_at);
+			os << ", \"denormals_flushed\": " << res.err.n_flushed
+			   << ", \"elmts_per_ns\": "   << json_number(res.elmts_per_ns);
+		}
+		else
+			os << ", \"error\": " << json_string(res.error);
+		os << "}" << (r + 1 < results.size() ? "," : "") << std::endl;
+	}
+	os << "  ]" << std::endl;
+	os << "}" << std::endl;
+}
+
+// the large errors (of the low accuracy tiers) are in scientific notation
+static std::string cell(const double v, const int precision)
+{
+	std::stringstream ss;
+	if (v != 0. && (v >= 1e5 || v < 1e-3))
+		ss << std::scientific << std::setprecision(2) << v;
+	else
+		ss << std::fixed << std::setprecision(precision) << v;
+	return ss.str();
+}
+
+int main(int argc, char** argv)
+{
+	ulp::options opt;
+	std::string json_file = "";
+
+	for (auto a = 1; a < argc; a++)
+	{
+		std::string arg = argv[a];
+		if (a + 1 >= argc && arg != "--help")
+		{
+			std::cerr << "Missing value for '" << arg << "'." << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		if      (arg == "--filter"     ) opt.filter      = argv[++a];
+		else if (arg == "--json"       ) json_file       = argv[++a];
+		else if (arg == "--threads"    ) opt.n_threads   = (unsigned)std::max(0, std::atoi(argv[++a]));
+		else if (arg == "--f32-step"   ) opt.f32_step    = std::max(1ull, std::strtoull(argv[++a], nullptr, 10));
+		else if (arg == "--f64-samples") opt.f64_samples = std::max(1ull, std::strtoull(argv[++a], nullptr, 10));
+		else if (arg == "--min-time"   ) opt.min_time    = std::atof(argv[++a]);
+		else
+		{
+			std::cerr << "usage: " << argv[0] << " [--filter <str>] [--json <file>] [--threads <n>] [--f32-step <k>] "
+			          << "[--f64-samples <n>] [--min-time <ms>]" << std::endl;
+			return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if (opt.n_threads == 0)
+		opt.n_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	std::cout << "# MIPP ISA:  " << mipp::InstructionFullType << " (" << mipp::RegisterSizeBit << "-bit)" << std::endl;
+	std::cout << "# Flags:     " << MIPP_BENCH_CXX_FLAGS << std::endl;
+	std::cout << "# Inputs:    float: one bit pattern over " << opt.f32_step << ", double: " << opt.f64_samples
+	          << " samples (" << opt.n_threads << " threads)" << std::endl;
+	std::cout << "# max/mean ULP and max relative error on the domain, spec = wrong NaN/inf/signed zero, flush = "
+	          << "denormals flushed to zero" << std::endl;
+	std::cout << "#" << std::endl;
+
+	std::cout << std::left << std::setw(12) << "# function" << std::setw(10) << "tier" << std::setw(8) << "type"
+	          << std::setw(26) << "domain" << std::right << std::setw(10) << "max ulp" << std::setw(16) << "at"
+	          << std::setw(10) << "mean ulp" << std::setw(10) << "max rel" << std::setw(10) << "spec"
+	          << std::setw(10) << "flush" << std::setw(10) << "elmt/ns" << std::endl;
+
+	std::vector<ulp::result> results;
+	for (auto &e : ulp::registry())
+	{
+		if (!opt.filter.empty() && e.name.find(opt.filter) == std::string::npos)
+			continue;
+
+		auto res = e.run(opt);
+		results.push_back(res);
+
+		std::cout << std::left << std::setw(12) << ("  " + res.name) << std::setw(10) << res.tier
+		          << std::setw(8) << res.type;
+		if (!res.supported)
+		{
+			std::cout << "(unsupported)" << std::endl;
+			continue;
+		}
+		std::stringstream dom, at;
+		dom << std::setprecision(3) << "[" << res.lo << ", " << res.hi << "]";
+		at << std::setprecision(8) << res.err.max_at;
+		std::cout << std::setw(26) << dom.str() << std::right
+		          << std::setw(10) << cell(res.err.max_ulp,    3)
+		          << std::setw(16) << at.str()
+		          << std::setw(10) << cell(res.err.mean_ulp(), 3)
+		          << std::setw(10) << cell(res.err.max_rel,    3)
+		          << std::setw(10) << res.err.n_special
+		          << std::setw(10) << res.err.n_flushed
+		          << std::setw(10) << cell(res.elmts_per_ns,   2) << std::endl;
+	}
+
+	if (!json_file.empty())
+	{
+		std::ofstream file(json_file);
+		if (!file.is_open())
+		{
+			std::cerr << "Can't open '" << json_file << "'." << std::endl;
+			return EXIT_FAILURE;
+		}
+		write_json(file, opt, results);
+	}
+
+	return EXIT_SUCCESS;
+}
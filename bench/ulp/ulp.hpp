@@ -0,0 +1,387 @@
+#ifndef MIPP_ULP_HPP_
+#define MIPP_ULP_HPP_
+
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <mipp.h>
+
+#include "../src/bench.hpp"
+
+namespace ulp
+{
+// ----------------------------------------------------------------------------------------------------------- options
+
+struct options
+{
+	std::string filter      = "";         // run only the functions whose name contains this string
+	unsigned    n_threads   = 0;          // number of threads of the sweeps (0 = all the hardware threads)
+	uint64_t    f32_step    = 1;          // 1 = all the 2^32 float values, 'k' = one bit pattern over 'k'
+	uint64_t    f64_samples = 1ull << 26; // number of random double values
+	double      min_time    = 20.0;       // minimum duration (in ms) of one throughput measure
+};
+
+// ----------------------------------------------------------------------------------------------------------- results
+
+// errors of one function on one type, the ULP are the units in the last place of the exact result rounded to 'T'
+struct stats
+{
+	double   max_ulp   = 0.;  // largest error in the domain
+	double   max_at    = 0.;  // input of the largest error
+	double   sum_ulp   = 0.;  // sum of the errors in the domain (for the mean)
+	uint64_t n_ulp     = 0;   // number of finite results in the domain
+	double   max_rel   = 0.;  // largest relative error in the domain
+	uint64_t n_special = 0;   // wrong NaN, infinity or signed zero
+	double   special_at = 0.; // input of the first wrong special value
+	uint64_t n_flushed = 0;   // denormal results flushed to zero (not counted in the ULP)
+
+	void merge(const stats &s)
+	{
+		if (s.max_ulp > max_ulp) { max_ulp = s.max_ulp; max_at = s.max_at; }
+		max_rel    = std::max(max_rel, s.max_rel);
+		if (!n_special && s.n_special) special_at = s.special_at;
+		sum_ulp   += s.sum_ulp;
+		n_ulp     += s.n_ulp;
+		n_special += s.n_special;
+		n_flushed += s.n_flushed;
+	}
+
+	double mean_ulp() const { return n_ulp ? sum_ulp / (double)n_ulp : 0.; }
+};
+
+struct result
+{
+	std::string name;
+	std::string tier;
+	std::string type;
+	int         lanes     = 1;
+	double      lo        = 0.;    // domain of the ULP statistics
+	double      hi        = 0.;
+	bool        supported = true;
+	std::string error     = "";
+	uint64_t    n_inputs  = 0;     // number of evaluated values
+	stats       err;
+	double      elmts_per_ns = -1.; // array of values of the domain kept in the L1 cache
+};
+
+struct entry
+{
+	std::string name;
+	std::string tier;
+	std::string type;
+	std::function<result(const options&)> run;
+};
+
+inline std::vector<entry>& registry()
+{
+	static std::vector<entry> entries;
+	return entries;
+}
+
+// ------------------------------------------------------------------------------------------------------------- check
+
+// compares 'y = f(x)' with the exact result 'ref' and updates 'st', 'in' tells if 'x' is in the domain: the special
+// results (NaN, infinities and zeros) are checked on all the inputs, the other results only in the domain
+template <typename T>
+inline void check(stats &st, const T x, const T y, const long double ref, const bool in)
+{
+	const T r = (T)ref;
+	if (std::isnan(r) || std::isinf(r) || r == (T)0)
+	{
+		// the special results must be exact (the sign of zero included), a tiny 'ref' rounded to zero is also
+		// accepted as a denormal flushed to zero
+		const bool ok = std::isnan(r) ? std::isnan(y)
+		                              : (y == r && std::signbit(y) == std::signbit(r)) || (ref != 0.L && y == (T)0);
+		if (!ok && !st.n_special++)
+			st.special_at = (double)x;
+		return;
+	}
+	if (!in)
+		return;
+	if (std::isnan(y) || std::isinf(y))
+	{
+		if (!st.n_special++)
+			st.special_at = (double)x;
+		return;
+	}
+	if (std::abs(r) < std::numeric_limits<T>::min() && y == (T)0)
+	{
+		st.n_flushed++;
+		return;
+	}
+
+	const T      a   = std::abs(r);
+	const T      one = std::abs(r) < std::numeric_limits<T>::min() ? std::numeric_limits<T>::denorm_min()
+	                                                                 : std::nextafter(a, std::numeric_limits<T>::infinity()) - a;
+	const double e   = (double)(std::abs((long double)y - ref) / (long double)one);
+	if (e > st.max_ulp)
+	{
+		st.max_ulp = e;
+		st.max_at  = (double)x;
+	}
+	st.max_rel  = std::max(st.max_rel, (double)(std::abs((long double)y - ref) / std::abs(ref)));
+	st.sum_ulp += e;
+	st.n_ulp++;
+}
+
+// applies 'f' on the 'n' values of 'x' ('n' is a multiple of the register size) and checks the results
+template <typename T, class F, class R>
+inline void eval(stats &st, F f, R ref, const T *x, T *y, const size_t n, const T lo, const T hi)
+{
+	for (size_t i = 0; i < n; i += mipp::N<T>())
+		f(mipp::Reg<T>(x + i)).storeu(y + i);
+	for (size_t i = 0; i < n; i++)
+		check<T>(st, x[i], y[i], ref((long double)x[i]), x[i] >= lo && x[i] <= hi);
+}
+
+// runs 'job(t)' on 'n' threads and merges the statistics
+template <class J>
+inline stats parallel(const unsigned n, J job)
+{
+	std::vector<stats> st(n);
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < n; t++)
+		threads.emplace_back([&, t]() { st[t] = job(t); });
+	stats res;
+	for (unsigned t = 0; t < n; t++)
+	{
+		threads[t].join();
+		res.merge(st[t]);
+	}
+	return res;
+}
+
+// the values at the boundaries of the classes of numbers
+template <typename T>
+inline std::vector<T> special_values()
+{
+	using L = std::numeric_limits<T>;
+	std::vector<T> v = { L::quiet_NaN(), L::infinity(), L::max(), (T)1, L::min(), L::denorm_min(), (T)0 };
+	const size_t n = v.size();
+	for (size_t i = 0; i < n; i++)
+		v.push_back(-v[i]);
+	return v;
+}
+
+// --------------------------------------------------------------------------------------------------------- domains
+
+// all the float values (one bit pattern over 'opt.f32_step'), split in contiguous chunks between the threads
+template <class F, class R>
+inline stats sweep(const options &opt, F f, R ref, const float lo, const float hi, uint64_t &n_inputs)
+{
+	constexpr size_t B = 4096;
+	const uint64_t total = ((1ull << 32) + opt.f32_step -1) / opt.f32_step;
+	const unsigned nt    = opt.n_threads;
+	n_inputs = total;
+	return ulp::parallel(nt, [&](const unsigned t)
+	{
+		stats st;
+		mipp::vector<float> x(B), y(B);
+		const uint64_t beg = total * t / nt, end = total * (t + 1) / nt;
+		for (uint64_t i = beg; i < end; i += B)
+		{
+			const size_t n = (size_t)std::min((uint64_t)B, end - i);
+			for (size_t k = 0; k < n; k++)
+			{
+				const uint32_t bits = (uint32_t)((i + k) * opt.f32_step);
+				std::memcpy(&x[k], &bits, sizeof(bits));
+			}
+			const size_t nr = ((n + mipp::N<float>() -1) / mipp::N<float>()) * mipp::N<float>();
+			std::fill(x.begin() + n, x.begin() + nr, x[0]);
+			ulp::eval<float>(st, f, ref, x.data(), y.data(), nr, lo, hi);
+		}
+		return st;
+	});
+}
+
+// uniform draws in the domain: half of them are uniform in value and half of them uniform in bit pattern (the same
+// number of values in each binade)
+template <typename T>
+inline T draw(std::mt19937_64 &g, const T lo, const T hi)
+{
+	using U = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+	if (g() & 1)
+		return std::uniform_real_distribution<T>(lo, hi)(g);
+
+	// the positive floating-point numbers are ordered as their bit patterns
+	auto bits = [](const T v) { U b; std::memcpy(&b, &v, sizeof(b)); return b; };
+	const bool pos = lo >= (T)0, neg = hi <= (T)0;
+	const U    b0  = pos ? bits(lo) : neg ? bits(-hi) : (U)0;
+	const U    b1  = pos ? bits(hi) : neg ? bits(-lo) : bits(std::max(-lo, hi));
+	for (;;)
+	{
+		const U b = std::uniform_int_distribution<U>(b0, b1)(g);
+		T v;
+		std::memcpy(&v, &b, sizeof(v));
+		if (neg || (!pos && (g() & 1)))
+			v = -v;
+		if (v >= lo && v <= hi)
+			return v;
+	}
+}
+
+template <class F, class R>
+inline stats sample(const options &opt, F f, R ref, const double lo, const double hi, uint64_t &n_inputs)
+{
+	constexpr size_t B = 4096;
+	const unsigned nt = opt.n_threads;
+	const uint64_t total = ((opt.f64_samples + B -1) / B) * B;
+	n_inputs = total;
+	return ulp::parallel(nt, [&](const unsigned t)
+	{
+		stats st;
+		std::mt19937_64 g(1234 + t);
+		mipp::vector<double> x(B), y(B);
+		for (uint64_t i = total * t / nt / B; i < total * (t + 1) / nt / B; i++)
+		{
+			for (size_t k = 0; k < B; k++)
+				x[k] = ulp::draw<double>(g, lo, hi);
+			ulp::eval<double>(st, f, ref, x.data(), y.data(), B, lo, hi);
+		}
+		return st;
+	});
+}
+
+template <typename T> struct domain;
+
+template <>
+struct domain<float>
+{
+	template <class F, class R>
+	static stats run(const options &opt, F f, R ref, const double lo, const double hi, uint64_t &n)
+	{
+		return ulp::sweep(opt, f, ref, (float)lo, (float)hi, n);
+	}
+};
+
+template <>
+struct domain<double>
+{
+	template <class F, class R>
+	static stats run(const options &opt, F f, R ref, const double lo, const double hi, uint64_t &n)
+	{
+		return ulp::sample(opt, f, ref, lo, hi, n);
+	}
+};
+
+// ----------------------------------------------------------------------------------------------------------- runners
+
+// 'FN' is a functor with a 'Reg<T> operator()(Reg<T> x)' method (MIPP version) and a 'long double operator()(long
+// double x)' method (exact result)
+template <class FN, typename T>
+result run(const options &opt, const std::string &name, const std::string &tier, const double lo, const double hi)
+{
+	const FN fn;
+	auto f   = [&](const mipp::Reg<T> x) { return fn(x); };
+	auto ref = [&](const long double x) { return fn(x); };
+
+	result res;
+	res.name  = name;
+	res.tier  = tier;
+	res.type  = bench::type_name<T>();
+	res.lanes = mipp::N<T>();
+	res.lo    = lo;
+	res.hi    = hi;
+
+	// the MIPP functions which are not available for this ISA and this type are throwing an exception
+	try
+	{
+		mipp::Reg<T> x = (T)1;
+		x = f(x);
+		bench::opaque(x);
+	}
+	catch (std::exception &e)
+	{
+		res.supported = false;
+		res.error     = e.what();
+		res.error     = res.error.substr(0, res.error.find('\n'));
+		return res;
+	}
+
+	res.err = domain<T>::run(opt, f, ref, lo, hi, res.n_inputs);
+
+	// the float sweep already went through the special values
+	if (!std::is_same<T,float>::value || opt.f32_step > 1)
+	{
+		auto sv = special_values<T>();
+		sv.resize(((sv.size() + mipp::N<T>() -1) / mipp::N<T>()) * mipp::N<T>(), (T)1);
+		std::vector<T> y(sv.size());
+		ulp::eval<T>(res.err, f, ref, sv.data(), y.data(), sv.size(), (T)lo, (T)hi);
+	}
+
+	// uniform in value: the inputs of the throughput are mostly normal numbers (no microcode assists)
+	std::mt19937_64 g;
+	std::uniform_real_distribution<T> dis((T)lo, (T)hi);
+	mipp::vector<T> in(2048), out(2048);
+	for (auto &v : in)
+		v = dis(g);
+	bench::options bopt;
+	bopt.min_time = opt.min_time;
+	const double ns = bench::measure(bopt, [&](const size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			for (size_t j = 0; j < in.size(); j += mipp::N<T>())
+				f(mipp::Reg<T>(&in[j])).store(&out[j]);
+			bench::clobber();
+		}
+	}) / (double)in.size();
+	res.elmts_per_ns = 1. / ns;
+
+	return res;
+}
+
+// -------------------------------------------------------------------------------------------------------- registrars
+
+template <typename... Ts>
+struct registrar;
+
+template <>
+struct registrar<>
+{
+	template <class FN>
+	static void add(const std::string&, const std::string&) {}
+};
+
+template <typename T, typename... Ts>
+struct registrar<T,Ts...>
+{
+	template <class FN>
+	static void add(const std::string &name, const std::string &tier)
+	{
+		registry().push_back({name, tier, bench::type_name<T>(), [=](const options &opt)
+		{
+			return ulp::run<FN,T>(opt, name, tier, (double)FN::template lo<T>(), (double)FN::template hi<T>());
+		}});
+		registrar<Ts...>::template add<FN>(name, tier);
+	}
+};
+}
+
+// 'MIPP_ULP(id, name, tier, lo, hi, reg_expr, ref_expr, types...)' registers the accuracy measure of a function for
+// each type of the list: 'reg_expr' (with 'x' of type 'Reg<T>') is the MIPP version and 'ref_expr' (with 'x' of type
+// 'long double') is the exact result. The ULP are accumulated on [lo, hi] ('lo' and 'hi' are expressions of the type
+// 'T') and the special values are checked on all the inputs.
+#define MIPP_ULP(ID, NAME, TIER, LO, HI, REG_EXPR, REF_EXPR, ...)                                                    \
+	namespace {                                                                                                        \
+	struct ulp_##ID                                                                                                    \
+	{                                                                                                                  \
+		template <typename T> mipp::Reg<T> operator()(const mipp::Reg<T> x) const { return REG_EXPR; }                \
+		long double operator()(const long double x) const { return REF_EXPR; }                                        \
+		template <typename T> static T lo() { return LO; }                                                             \
+		template <typename T> static T hi() { return HI; }                                                             \
+		static void reg() { ulp::registrar<__VA_ARGS__>::template add<ulp_##ID>(NAME, TIER); }                       \
+	};                                                                                                                 \
+	const bench::auto_register MIPP_BENCH_CAT(ulp_reg_, ID)(&ulp_##ID::reg);                                           \
+	}
+
+#endif /* MIPP_ULP_HPP_ */
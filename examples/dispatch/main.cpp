@@ -0,0 +1,27 @@
+// Runtime dispatch between several compilations of the same MIPP kernel, build with:
+//   g++ -O3 -std=c++11 main.cpp saxpy_sse42.o saxpy_avx2.o saxpy_avx512.o -o dispatch
+// (see 'saxpy.cpp' to build the objects). This file is compiled without any ISA flag so it runs on every x86 CPU.
+#include <iostream>
+#include <vector>
+
+#include "../../src/mipp.h"
+
+namespace isa_sse4_2   { void saxpy(const float a, const float* x, float* y, const size_t n); }
+namespace isa_avx2_fma { void saxpy(const float a, const float* x, float* y, const size_t n); }
+namespace isa_avx512bw { void saxpy(const float a, const float* x, float* y, const size_t n); }
+
+int main(int argc, char** argv)
+{
+	using saxpy_t = void (*)(const float, const float*, float*, const size_t);
+	static const saxpy_t saxpy = mipp::dispatch<saxpy_t>({{mipp::ISA::SSE4_2,   &isa_sse4_2  ::saxpy},
+	                                                      {mipp::ISA::AVX2,     &isa_avx2_fma::saxpy},
+	                                                      {mipp::ISA::AVX512BW, &isa_avx512bw::saxpy}});
+
+	std::cout << "CPU best ISA: " << mipp::isa_name(mipp::best_isa()) << std::endl;
+
+	std::vector<float> x(1000, 1.f), y(1000, 2.f);
+	saxpy(3.f, x.data(), y.data(), x.size());
+	std::cout << "y[0] = " << y[0] << " (expected 5)" << std::endl;
+
+	return 0;
+}
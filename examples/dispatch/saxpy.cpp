@@ -0,0 +1,26 @@
+// This file is compiled once per targeted ISA, for instance:
+//   g++ -O3 -std=c++11 -msse4.2                 -c saxpy.cpp -o saxpy_sse42.o
+//   g++ -O3 -std=c++11 -mavx2 -mfma             -c saxpy.cpp -o saxpy_avx2.o
+//   g++ -O3 -std=c++11 -mavx512f -mavx512bw -mavx512cd -mavx512dq -mavx512vl -c saxpy.cpp -o saxpy_avx512.o
+// MIPP_ISA_NAMESPACE expands to a different name for each compilation ('isa_sse4_2', 'isa_avx2_fma',
+// 'isa_avx512bw'), so the three instances of the kernel can be linked in the same binary.
+#include <cstddef>
+
+#include "../../src/mipp.h"
+
+namespace MIPP_ISA_NAMESPACE
+{
+void saxpy(const float a, const float* x, float* y, const size_t n)
+{
+	const mipp::Reg<float> ra = a;
+	const size_t vec_loop_size = (n / mipp::N<float>()) * mipp::N<float>();
+	for (size_t i = 0; i < vec_loop_size; i += mipp::N<float>())
+	{
+		mipp::Reg<float> rx = &x[i], ry = &y[i];
+		ry = mipp::fmadd(ra, rx, ry);
+		ry.store(&y[i]);
+	}
+	for (size_t i = vec_loop_size; i < n; i++)
+		y[i] = a * x[i] + y[i];
+}
+}
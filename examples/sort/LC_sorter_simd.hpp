@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include <vector>
+#include <limits>
 #include <algorithm>
 
 #include "../../src/mipp.h"
@@ -13,12 +14,13 @@ template <typename T>
 class LC_sorter_simd
 {
 private:
-	int               max_elmts;
-	mipp::vector<int> tree_idx;
-	mipp::vector<T>   vals;
+	int                    max_elmts;
+	mipp::vector<int>      tree_idx;
+	mipp::padded_vector<T> vals; // the padding lanes are +inf (= max) and they never win a min
 
 public:
-	LC_sorter_simd(const int max_elmts) : max_elmts(max_elmts), vals(2 * max_elmts)
+	LC_sorter_simd(const int max_elmts)
+	: max_elmts(max_elmts), vals(2 * max_elmts, (T)0, std::numeric_limits<T>::max())
 	{
 		// assert(is_power_of_2(max_elmts));
 
@@ -38,7 +40,7 @@ public:
 			max_elmts = n_elmts;
 			tree_idx.resize(2 * max_elmts -1);
 			std::iota(tree_idx.begin(), tree_idx.begin() + this->max_elmts, 0);
-			vals.resize(max_elmts);
+			vals.resize(2 * max_elmts);
 		}
 
 		// copy the "values" vector in "vals"
@@ -74,7 +76,7 @@ public:
 			max_elmts = n_elmts;
 			tree_idx.resize(2 * max_elmts -1);
 			std::iota(tree_idx.begin(), tree_idx.begin() + this->max_elmts, 0);
-			vals.resize(max_elmts);
+			vals.resize(2 * max_elmts);
 		}
 
 		if (n_elmts >= 2 * mipp::nElReg<T>())
@@ -145,17 +147,9 @@ private:
 			offset += n;
 		}
 
-		// sequential part (searching the min pos)
-		auto min_pos = 0;
-		auto min = std::numeric_limits<T>::max();
-
-		for (auto i = 0; i < mipp::nElReg<T>(); i++)
-		{
-			min_pos = values[tree_idx[offset +i]] < min ? tree_idx[offset +i] : min_pos;
-			min = std::min(values[tree_idx[offset +i]], min);
-		}
-
-		pos[0] = min_pos;
+		// horizontal part (searching the min pos)
+		const auto min = mipp::argmin(mipp::Reg<T>(&values[offset]));
+		pos[0] = tree_idx[offset + min.second];
 	}
 
 	inline void _partial_sort_step2(T* values, std::vector<int> &pos, const int K, const int depth)
@@ -205,17 +199,9 @@ private:
 				i++;
 			}
 
-			// sequential part (searching the min pos)
-			auto min_pos = 0;
-			auto min = std::numeric_limits<T>::max();
-
-			for (auto i = 0; i < mipp::nElReg<T>(); i++)
-			{
-				min_pos = values[tree_idx[offset +i]] < min ? tree_idx[offset +i] : min_pos;
-				min = std::min(values[tree_idx[offset +i]], min);
-			}
-
-			pos[k +1] = min_pos;
+			// horizontal part (searching the min pos)
+			const auto min = mipp::argmin(mipp::Reg<T>(&values[offset]));
+			pos[k +1] = tree_idx[offset + min.second];
 		}
 	}
 };
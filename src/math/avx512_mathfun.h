@@ -16,11 +16,20 @@
 typedef __m512 v16sf; // vector of 8 float (avx)
 
 // prototypes
-inline v16sf log512_ps(v16sf x);
-inline v16sf exp512_ps(v16sf x);
-inline v16sf sin512_ps(v16sf x);
-inline v16sf cos512_ps(v16sf x);
-inline void sincos512_ps(v16sf x, v16sf *s, v16sf *c);
+static inline v16sf log512_ps(v16sf x);
+static inline v16sf exp512_ps(v16sf x);
+static inline v16sf sin512_ps(v16sf x);
+static inline v16sf cos512_ps(v16sf x);
+static inline void sincos512_ps(v16sf x, v16sf *s, v16sf *c);
+
+typedef __m512d v8df; // vector of 8 double (avx-512)
+typedef __m512i v8di; // vector of 8 int64  (avx-512)
+
+static inline v8df log512_pd(v8df x);
+static inline v8df exp512_pd(v8df x);
+static inline v8df sin512_pd(v8df x);
+static inline v8df cos512_pd(v8df x);
+static inline void sincos512_pd(v8df x, v8df *s, v8df *c);
 
 #include "avx512_mathfun.hxx"
 
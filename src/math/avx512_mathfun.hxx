@@ -15,20 +15,20 @@ typedef __m512i v16si; // vector of 16 int   (avx)
 
 /* yes I know, the top of this file is quite ugly */
 #ifdef _MSC_VER /* visual c++ */
-# define ALIGN32_BEG __declspec(align(32))
-# define ALIGN32_END 
+# define ALIGN64_BEG __declspec(align(64))
+# define ALIGN64_END 
 #else /* gcc or icc */
-# define ALIGN32_BEG
-# define ALIGN32_END __attribute__((aligned(32)))
+# define ALIGN64_BEG
+# define ALIGN64_END __attribute__((aligned(64)))
 #endif
 
 /* declare some AVX512 constants -- why can't I figure a better way to do that? */
 #define _PS512_CONST(Name, Val)                                            \
-  static const ALIGN32_BEG float _ps512_##Name[16] ALIGN32_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
+  static const ALIGN64_BEG float _ps512_##Name[16] ALIGN64_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
 #define _PI32_CONST512(Name, Val)                                            \
-  static const ALIGN32_BEG int _pi32_512_##Name[16] ALIGN32_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
+  static const ALIGN64_BEG int _pi32_512_##Name[16] ALIGN64_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
 #define _PS512_CONST_TYPE(Name, Type, Val)                                 \
-  static const ALIGN32_BEG Type _ps512_##Name[16] ALIGN32_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
+  static const ALIGN64_BEG Type _ps512_##Name[16] ALIGN64_END = { Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val, Val }
 
 _PS512_CONST(1  , 1.0f);
 _PS512_CONST(0p5, 0.5f);
@@ -539,4 +539,255 @@ void sincos512_ps(v16sf x, v16sf *s, v16sf *c) {
   *c = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(xmm2), _mm512_castps_si512(sign_bit_cos)));
 }
 
+/* double precision versions of log, exp, sin, cos and sincos, they are the
+   rewriting of the cephes double routines. AVX-512F gives the exponent and the
+   mantissa (getexp/getmant), the rounding (roundscale), the scaling by 2^n
+   (scalef) and the opmasks, this is why they are simpler than the single
+   precision versions above */
+
+#define _PD512_CONST(Name, Val)                                            \
+  static const ALIGN64_BEG double _pd512_##Name[8] ALIGN64_END = { Val, Val, Val, Val, Val, Val, Val, Val }
+#define _PI64_CONST512(Name, Val)                                            \
+  static const ALIGN64_BEG long long _pi64_512_##Name[8] ALIGN64_END = { Val, Val, Val, Val, Val, Val, Val, Val }
+
+_PD512_CONST(1  , 1.0);
+_PD512_CONST(0p5, 0.5);
+_PD512_CONST(2  , 2.0);
+
+_PI64_CONST512(1, 1);
+_PI64_CONST512(inv1, ~1LL);
+_PI64_CONST512(2, 2);
+_PI64_CONST512(4, 4);
+_PI64_CONST512(sign_mask, (long long)0x8000000000000000ULL);
+_PI64_CONST512(nan, 0x7ff8000000000000LL);
+
+_PD512_CONST(cephes_SQRTH, 0.70710678118654752440);
+_PD512_CONST(cephes_log_p0, 1.01875663804580931796E-4);
+_PD512_CONST(cephes_log_p1, 4.97494994976747001425E-1);
+_PD512_CONST(cephes_log_p2, 4.70579119878881725854E0);
+_PD512_CONST(cephes_log_p3, 1.44989225341610930846E1);
+_PD512_CONST(cephes_log_p4, 1.79368678507819816313E1);
+_PD512_CONST(cephes_log_p5, 7.70838733755885391666E0);
+_PD512_CONST(cephes_log_q0, 1.12873587189167450590E1);
+_PD512_CONST(cephes_log_q1, 4.52279145837532221105E1);
+_PD512_CONST(cephes_log_q2, 8.29875266912776603211E1);
+_PD512_CONST(cephes_log_q3, 7.11544750618563894466E1);
+_PD512_CONST(cephes_log_q4, 2.31251620126765340583E1);
+_PD512_CONST(cephes_log_C1, 2.121944400546905827679E-4);
+_PD512_CONST(cephes_log_C2, 0.693359375);
+
+/* natural logarithm computed for 8 simultaneous double
+   return NaN for x <= 0
+*/
+v8df log512_pd(v8df x) {
+  v8df one = *(v8df*)_pd512_1;
+
+  __mmask8 invalid_mask = _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_LE_OS);
+
+  /* part 1: x = frexp(x, &e); (getexp and getmant also handle the denormals) */
+  v8df e = _mm512_add_pd(_mm512_getexp_pd(x), one);
+  x = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+  /* part2:
+     if( x < SQRTH ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  __mmask8 mask = _mm512_cmp_pd_mask(x, *(v8df*)_pd512_cephes_SQRTH, _CMP_LT_OS);
+  e = _mm512_mask_sub_pd(e, mask, e, one);
+  x = _mm512_mask_add_pd(x, mask, x, x);
+  x = _mm512_sub_pd(x, one);
+
+  v8df z = _mm512_mul_pd(x,x);
+
+  /* y = x * (z * P(x) / Q(x)) */
+  v8df p = *(v8df*)_pd512_cephes_log_p0;
+  p = _mm512_fmadd_pd(p, x, *(v8df*)_pd512_cephes_log_p1);
+  p = _mm512_fmadd_pd(p, x, *(v8df*)_pd512_cephes_log_p2);
+  p = _mm512_fmadd_pd(p, x, *(v8df*)_pd512_cephes_log_p3);
+  p = _mm512_fmadd_pd(p, x, *(v8df*)_pd512_cephes_log_p4);
+  p = _mm512_fmadd_pd(p, x, *(v8df*)_pd512_cephes_log_p5);
+
+  v8df q = _mm512_add_pd(x, *(v8df*)_pd512_cephes_log_q0);
+  q = _mm512_fmadd_pd(q, x, *(v8df*)_pd512_cephes_log_q1);
+  q = _mm512_fmadd_pd(q, x, *(v8df*)_pd512_cephes_log_q2);
+  q = _mm512_fmadd_pd(q, x, *(v8df*)_pd512_cephes_log_q3);
+  q = _mm512_fmadd_pd(q, x, *(v8df*)_pd512_cephes_log_q4);
+
+  v8df y = _mm512_mul_pd(x, _mm512_div_pd(_mm512_mul_pd(z, p), q));
+
+  y = _mm512_fnmadd_pd(e, *(v8df*)_pd512_cephes_log_C1, y);
+  y = _mm512_fnmadd_pd(z, *(v8df*)_pd512_0p5, y);
+
+  x = _mm512_add_pd(x, y);
+  x = _mm512_fmadd_pd(e, *(v8df*)_pd512_cephes_log_C2, x);
+  x = _mm512_mask_blend_pd(invalid_mask, x, *(v8df*)_pi64_512_nan); // negative arg will be NAN
+  return x;
+}
+
+_PD512_CONST(exp_hi,  709.782712893383996843);
+_PD512_CONST(exp_lo, -708.39641853226410622);
+
+_PD512_CONST(cephes_LOG2E, 1.4426950408889634073599);
+_PD512_CONST(cephes_exp_C1, 6.93145751953125E-1);
+_PD512_CONST(cephes_exp_C2, 1.42860682030941723212E-6);
+
+_PD512_CONST(cephes_exp_p0, 1.26177193074810590878E-4);
+_PD512_CONST(cephes_exp_p1, 3.02994407707441961300E-2);
+_PD512_CONST(cephes_exp_p2, 9.99999999999999999910E-1);
+_PD512_CONST(cephes_exp_q0, 3.00198505138664455042E-6);
+_PD512_CONST(cephes_exp_q1, 2.52448340349684104192E-3);
+_PD512_CONST(cephes_exp_q2, 2.27265548208155028766E-1);
+_PD512_CONST(cephes_exp_q3, 2.00000000000000000009E0);
+
+v8df exp512_pd(v8df x) {
+  x = _mm512_min_pd(x, *(v8df*)_pd512_exp_hi);
+  x = _mm512_max_pd(x, *(v8df*)_pd512_exp_lo);
+
+  /* express exp(x) as exp(g + n*log(2)), n = round(x * log2(e)) */
+  v8df fx = _mm512_mul_pd(x, *(v8df*)_pd512_cephes_LOG2E);
+  fx = _mm512_roundscale_pd(fx, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+  x = _mm512_fnmadd_pd(fx, *(v8df*)_pd512_cephes_exp_C1, x);
+  x = _mm512_fnmadd_pd(fx, *(v8df*)_pd512_cephes_exp_C2, x);
+
+  v8df z = _mm512_mul_pd(x,x);
+
+  /* exp(g) = 1 + 2 * g P(g^2) / (Q(g^2) - g P(g^2)) */
+  v8df p = *(v8df*)_pd512_cephes_exp_p0;
+  p = _mm512_fmadd_pd(p, z, *(v8df*)_pd512_cephes_exp_p1);
+  p = _mm512_fmadd_pd(p, z, *(v8df*)_pd512_cephes_exp_p2);
+  p = _mm512_mul_pd(p, x);
+
+  v8df q = *(v8df*)_pd512_cephes_exp_q0;
+  q = _mm512_fmadd_pd(q, z, *(v8df*)_pd512_cephes_exp_q1);
+  q = _mm512_fmadd_pd(q, z, *(v8df*)_pd512_cephes_exp_q2);
+  q = _mm512_fmadd_pd(q, z, *(v8df*)_pd512_cephes_exp_q3);
+
+  v8df y = _mm512_div_pd(p, _mm512_sub_pd(q, p));
+  y = _mm512_fmadd_pd(y, *(v8df*)_pd512_2, *(v8df*)_pd512_1);
+
+  /* y * 2^n */
+  return _mm512_scalef_pd(y, fx);
+}
+
+_PD512_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD512_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD512_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD512_CONST(sincof_p0,  1.58962301576546568060E-10);
+_PD512_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD512_CONST(sincof_p2,  2.75573136213857245213E-6);
+_PD512_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD512_CONST(sincof_p4,  8.33333333332211858878E-3);
+_PD512_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD512_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD512_CONST(coscof_p1,  2.08757008419747316778E-9);
+_PD512_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD512_CONST(coscof_p3,  2.48015872888517045348E-5);
+_PD512_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD512_CONST(coscof_p5,  4.16666666666665929218E-2);
+_PD512_CONST(cephes_FOPI, 1.27323954473516268615); // 4 / M_PI
+
+/* range reduction shared by sin512_pd, cos512_pd and sincos512_pd: returns j
+   (the octants in int64) and reduces x in [-Pi/4, Pi/4], x has to be positive.
+   Precision is good as long as x < 2^30. */
+static inline v8di _sincos_reduce512_pd(v8df *x) {
+  v8df y = _mm512_mul_pd(*x, *(v8df*)_pd512_cephes_FOPI);
+
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  v8di imm2 = _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(y));
+  imm2 = _mm512_add_epi64(imm2, *(v8di*)_pi64_512_1);
+  imm2 = _mm512_and_si512(imm2, *(v8di*)_pi64_512_inv1);
+  y = _mm512_cvtepi32_pd(_mm512_cvtepi64_epi32(imm2));
+
+  /* The magic pass: "Extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  *x = _mm512_fmadd_pd(y, *(v8df*)_pd512_minus_cephes_DP1, *x);
+  *x = _mm512_fmadd_pd(y, *(v8df*)_pd512_minus_cephes_DP2, *x);
+  *x = _mm512_fmadd_pd(y, *(v8df*)_pd512_minus_cephes_DP3, *x);
+
+  return imm2;
+}
+
+/* first polynom (0 <= x <= Pi/4), z = x * x */
+static inline v8df _sin_poly512_pd(v8df x, v8df z) {
+  v8df y = *(v8df*)_pd512_sincof_p0;
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_sincof_p1);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_sincof_p2);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_sincof_p3);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_sincof_p4);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_sincof_p5);
+  return _mm512_fmadd_pd(_mm512_mul_pd(y, z), x, x);
+}
+
+/* second polynom (Pi/4 <= x <= Pi/2), z = x * x */
+static inline v8df _cos_poly512_pd(v8df z) {
+  v8df y = *(v8df*)_pd512_coscof_p0;
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_coscof_p1);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_coscof_p2);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_coscof_p3);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_coscof_p4);
+  y = _mm512_fmadd_pd(y, z, *(v8df*)_pd512_coscof_p5);
+  y = _mm512_mul_pd(_mm512_mul_pd(y, z), z);
+  y = _mm512_fnmadd_pd(z, *(v8df*)_pd512_0p5, y);
+  return _mm512_add_pd(y, *(v8df*)_pd512_1);
+}
+
+/* flips the sign of the elements of x selected by m */
+static inline v8df _negate512_pd(v8df x, __mmask8 m) {
+  return _mm512_castsi512_pd(_mm512_mask_xor_epi64(_mm512_castpd_si512(x), m, _mm512_castpd_si512(x),
+                                                   *(v8di*)_pi64_512_sign_mask));
+}
+
+v8df sin512_pd(v8df x) { // any x
+  __mmask8 sign_bit = _mm512_test_epi64_mask(_mm512_castpd_si512(x), *(v8di*)_pi64_512_sign_mask);
+  x = _mm512_abs_pd(x);
+
+  v8di imm2 = _sincos_reduce512_pd(&x);
+
+  /* get the swap sign flag and the polynom selection mask */
+  __mmask8 swap_sign_bit = _mm512_test_epi64_mask(imm2, *(v8di*)_pi64_512_4);
+  __mmask8 poly_mask = _mm512_test_epi64_mask(imm2, *(v8di*)_pi64_512_2);
+
+  v8df z = _mm512_mul_pd(x,x);
+  v8df y = _mm512_mask_blend_pd(poly_mask, _sin_poly512_pd(x, z), _cos_poly512_pd(z));
+  return _negate512_pd(y, sign_bit ^ swap_sign_bit);
+}
+
+v8df cos512_pd(v8df x) { // any x
+  x = _mm512_abs_pd(x);
+
+  v8di imm2 = _sincos_reduce512_pd(&x);
+  imm2 = _mm512_sub_epi64(imm2, *(v8di*)_pi64_512_2);
+
+  /* get the swap sign flag and the polynom selection mask */
+  __mmask8 sign_bit = _mm512_testn_epi64_mask(imm2, *(v8di*)_pi64_512_4);
+  __mmask8 poly_mask = _mm512_test_epi64_mask(imm2, *(v8di*)_pi64_512_2);
+
+  v8df z = _mm512_mul_pd(x,x);
+  v8df y = _mm512_mask_blend_pd(poly_mask, _sin_poly512_pd(x, z), _cos_poly512_pd(z));
+  return _negate512_pd(y, sign_bit);
+}
+
+void sincos512_pd(v8df x, v8df *s, v8df *c) {
+  __mmask8 sign_bit_sin = _mm512_test_epi64_mask(_mm512_castpd_si512(x), *(v8di*)_pi64_512_sign_mask);
+  x = _mm512_abs_pd(x);
+
+  v8di imm2 = _sincos_reduce512_pd(&x);
+
+  /* get the swap sign flags and the polynom selection mask */
+  sign_bit_sin ^= _mm512_test_epi64_mask(imm2, *(v8di*)_pi64_512_4);
+  __mmask8 sign_bit_cos = _mm512_testn_epi64_mask(_mm512_sub_epi64(imm2, *(v8di*)_pi64_512_2),
+                                                   *(v8di*)_pi64_512_4);
+  __mmask8 poly_mask = _mm512_test_epi64_mask(imm2, *(v8di*)_pi64_512_2);
+
+  v8df z = _mm512_mul_pd(x,x);
+  v8df y1 = _cos_poly512_pd(z);
+  v8df y2 = _sin_poly512_pd(x, z);
+
+  *s = _negate512_pd(_mm512_mask_blend_pd(poly_mask, y2, y1), sign_bit_sin);
+  *c = _negate512_pd(_mm512_mask_blend_pd(poly_mask, y1, y2), sign_bit_cos);
+}
+
 #endif
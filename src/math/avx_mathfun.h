@@ -37,11 +37,19 @@
 typedef __m256 v8sf; // vector of 8 float (avx)
 
 // prototypes
-inline v8sf log256_ps(v8sf x);
-inline v8sf exp256_ps(v8sf x);
-inline v8sf sin256_ps(v8sf x);
-inline v8sf cos256_ps(v8sf x);
-inline void sincos256_ps(v8sf x, v8sf *s, v8sf *c);
+static inline v8sf log256_ps(v8sf x);
+static inline v8sf exp256_ps(v8sf x);
+static inline v8sf sin256_ps(v8sf x);
+static inline v8sf cos256_ps(v8sf x);
+static inline void sincos256_ps(v8sf x, v8sf *s, v8sf *c);
+
+typedef __m256d v4df; // vector of 4 double (avx)
+
+static inline v4df log256_pd(v4df x);
+static inline v4df exp256_pd(v4df x);
+static inline v4df sin256_pd(v4df x);
+static inline v4df cos256_pd(v4df x);
+static inline void sincos256_pd(v4df x, v4df *s, v4df *c);
 
 #include "avx_mathfun.hxx"
 
@@ -724,4 +724,341 @@ void sincos256_ps(v8sf x, v8sf *s, v8sf *c) {
   *c = _mm256_xor_ps(xmm2, sign_bit_cos);
 }
 
+/* double precision versions of log, exp, sin, cos and sincos, they are the
+   rewriting of the cephes double routines (same structure as the single
+   precision versions above) */
+
+#define _PD256_CONST(Name, Val)                                            \
+  static const ALIGN32_BEG double _pd256_##Name[4] ALIGN32_END = { Val, Val, Val, Val }
+#define _PD256_CONST_TYPE(Name, Type, Val)                                 \
+  static const ALIGN32_BEG Type _pd256_##Name[4] ALIGN32_END = { Val, Val, Val, Val }
+
+_PD256_CONST(1  , 1.0);
+_PD256_CONST(0p5, 0.5);
+_PD256_CONST(2  , 2.0);
+/* the smallest non denormalized double number */
+_PD256_CONST_TYPE(min_norm_pos, long long, 0x0010000000000000LL);
+_PD256_CONST_TYPE(inv_mant_mask, long long, ~0x7ff0000000000000LL);
+
+_PD256_CONST_TYPE(sign_mask, long long, (long long)0x8000000000000000ULL);
+_PD256_CONST_TYPE(inv_sign_mask, long long, 0x7fffffffffffffffLL);
+
+/* 1.5 * 2^52: (x + magic) - magic rounds x to the nearest integer and the low
+   bits of (x + magic) contain this integer (for |x| < 2^51), this is how the
+   conversions between double and int64 are made without AVX-512 */
+_PD256_CONST(magic, 6755399441055744.0);
+_PD256_CONST(magic_bias, 6755399441055744.0 + 1023.0);
+
+/* 64-bit shifts of the bits of a double vector (there is no 256-bit integer
+   instruction without AVX2) */
+static inline v4df _pd256_srli_52(v4df x) {
+#ifdef __AVX2__
+  return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(x), 52));
+#else
+  v4si lo = _mm_srli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(x)), 52);
+  v4si hi = _mm_srli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(x, 1)), 52);
+  return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+#endif
+}
+
+static inline v4df _pd256_slli_52(v4df x) {
+#ifdef __AVX2__
+  return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(x), 52));
+#else
+  v4si lo = _mm_slli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(x)), 52);
+  v4si hi = _mm_slli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(x, 1)), 52);
+  return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+#endif
+}
+
+/* builds 4 64-bit lanes from 4 int32: the low halves come from 'lo' and the
+   high halves from 'hi' */
+static inline v4df _pd256_unpack_epi32(v4si lo, v4si hi) {
+  v4si l = _mm_unpacklo_epi32(lo, hi);
+  v4si h = _mm_unpackhi_epi32(lo, hi);
+  return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(l), h, 1));
+}
+
+_PD256_CONST(cephes_SQRTH, 0.70710678118654752440);
+_PD256_CONST(cephes_log_p0, 1.01875663804580931796E-4);
+_PD256_CONST(cephes_log_p1, 4.97494994976747001425E-1);
+_PD256_CONST(cephes_log_p2, 4.70579119878881725854E0);
+_PD256_CONST(cephes_log_p3, 1.44989225341610930846E1);
+_PD256_CONST(cephes_log_p4, 1.79368678507819816313E1);
+_PD256_CONST(cephes_log_p5, 7.70838733755885391666E0);
+_PD256_CONST(cephes_log_q0, 1.12873587189167450590E1);
+_PD256_CONST(cephes_log_q1, 4.52279145837532221105E1);
+_PD256_CONST(cephes_log_q2, 8.29875266912776603211E1);
+_PD256_CONST(cephes_log_q3, 7.11544750618563894466E1);
+_PD256_CONST(cephes_log_q4, 2.31251620126765340583E1);
+_PD256_CONST(cephes_log_C1, 2.121944400546905827679E-4);
+_PD256_CONST(cephes_log_C2, 0.693359375);
+_PD256_CONST(exp_bias, 1022.0);
+
+/* natural logarithm computed for 4 simultaneous double
+   return NaN for x <= 0
+*/
+v4df log256_pd(v4df x) {
+  v4df one = *(v4df*)_pd256_1;
+
+  v4df invalid_mask = _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LE_OS);
+
+  x = _mm256_max_pd(x, *(v4df*)_pd256_min_norm_pos);  /* cut off denormalized stuff */
+
+  /* part 1: x = frexp(x, &e); */
+  v4df e = _pd256_srli_52(x);
+  /* keep only the fractional part */
+  x = _mm256_and_pd(x, *(v4df*)_pd256_inv_mant_mask);
+  x = _mm256_or_pd(x, *(v4df*)_pd256_0p5);
+
+  /* convert the biased exponent to double with the magic number */
+  e = _mm256_or_pd(e, *(v4df*)_pd256_magic);
+  e = _mm256_sub_pd(e, *(v4df*)_pd256_magic);
+  e = _mm256_sub_pd(e, *(v4df*)_pd256_exp_bias);
+
+  /* part2:
+     if( x < SQRTH ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  v4df mask = _mm256_cmp_pd(x, *(v4df*)_pd256_cephes_SQRTH, _CMP_LT_OS);
+  v4df tmp = _mm256_and_pd(x, mask);
+  x = _mm256_sub_pd(x, one);
+  e = _mm256_sub_pd(e, _mm256_and_pd(one, mask));
+  x = _mm256_add_pd(x, tmp);
+
+  v4df z = _mm256_mul_pd(x,x);
+
+  /* y = x * (z * P(x) / Q(x)) */
+  v4df p = *(v4df*)_pd256_cephes_log_p0;
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), *(v4df*)_pd256_cephes_log_p1);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), *(v4df*)_pd256_cephes_log_p2);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), *(v4df*)_pd256_cephes_log_p3);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), *(v4df*)_pd256_cephes_log_p4);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), *(v4df*)_pd256_cephes_log_p5);
+
+  v4df q = _mm256_add_pd(x, *(v4df*)_pd256_cephes_log_q0);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), *(v4df*)_pd256_cephes_log_q1);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), *(v4df*)_pd256_cephes_log_q2);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), *(v4df*)_pd256_cephes_log_q3);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), *(v4df*)_pd256_cephes_log_q4);
+
+  v4df y = _mm256_mul_pd(x, _mm256_div_pd(_mm256_mul_pd(z, p), q));
+
+  tmp = _mm256_mul_pd(e, *(v4df*)_pd256_cephes_log_C1);
+  y = _mm256_sub_pd(y, tmp);
+
+  tmp = _mm256_mul_pd(z, *(v4df*)_pd256_0p5);
+  y = _mm256_sub_pd(y, tmp);
+
+  tmp = _mm256_mul_pd(e, *(v4df*)_pd256_cephes_log_C2);
+  x = _mm256_add_pd(x, y);
+  x = _mm256_add_pd(x, tmp);
+  x = _mm256_or_pd(x, invalid_mask); // negative arg will be NAN
+  return x;
+}
+
+_PD256_CONST(exp_hi,  709.782712893383996843);
+_PD256_CONST(exp_lo, -708.39641853226410622);
+
+_PD256_CONST(cephes_LOG2E, 1.4426950408889634073599);
+_PD256_CONST(cephes_exp_C1, 6.93145751953125E-1);
+_PD256_CONST(cephes_exp_C2, 1.42860682030941723212E-6);
+
+_PD256_CONST(cephes_exp_p0, 1.26177193074810590878E-4);
+_PD256_CONST(cephes_exp_p1, 3.02994407707441961300E-2);
+_PD256_CONST(cephes_exp_p2, 9.99999999999999999910E-1);
+_PD256_CONST(cephes_exp_q0, 3.00198505138664455042E-6);
+_PD256_CONST(cephes_exp_q1, 2.52448340349684104192E-3);
+_PD256_CONST(cephes_exp_q2, 2.27265548208155028766E-1);
+_PD256_CONST(cephes_exp_q3, 2.00000000000000000009E0);
+
+v4df exp256_pd(v4df x) {
+  x = _mm256_min_pd(x, *(v4df*)_pd256_exp_hi);
+  x = _mm256_max_pd(x, *(v4df*)_pd256_exp_lo);
+
+  /* express exp(x) as exp(g + n*log(2)), n = round(x * log2(e)) */
+  v4df fx = _mm256_mul_pd(x, *(v4df*)_pd256_cephes_LOG2E);
+  fx = _mm256_sub_pd(_mm256_add_pd(fx, *(v4df*)_pd256_magic), *(v4df*)_pd256_magic);
+
+  v4df tmp = _mm256_mul_pd(fx, *(v4df*)_pd256_cephes_exp_C1);
+  v4df z = _mm256_mul_pd(fx, *(v4df*)_pd256_cephes_exp_C2);
+  x = _mm256_sub_pd(x, tmp);
+  x = _mm256_sub_pd(x, z);
+
+  z = _mm256_mul_pd(x,x);
+
+  /* exp(g) = 1 + 2 * g P(g^2) / (Q(g^2) - g P(g^2)) */
+  v4df p = *(v4df*)_pd256_cephes_exp_p0;
+  p = _mm256_add_pd(_mm256_mul_pd(p, z), *(v4df*)_pd256_cephes_exp_p1);
+  p = _mm256_add_pd(_mm256_mul_pd(p, z), *(v4df*)_pd256_cephes_exp_p2);
+  p = _mm256_mul_pd(p, x);
+
+  v4df q = *(v4df*)_pd256_cephes_exp_q0;
+  q = _mm256_add_pd(_mm256_mul_pd(q, z), *(v4df*)_pd256_cephes_exp_q1);
+  q = _mm256_add_pd(_mm256_mul_pd(q, z), *(v4df*)_pd256_cephes_exp_q2);
+  q = _mm256_add_pd(_mm256_mul_pd(q, z), *(v4df*)_pd256_cephes_exp_q3);
+
+  v4df y = _mm256_div_pd(p, _mm256_sub_pd(q, p));
+  y = _mm256_add_pd(_mm256_mul_pd(y, *(v4df*)_pd256_2), *(v4df*)_pd256_1);
+
+  /* build 2^n in two steps (2^n1 * 2^n2 with n1 = n/2) to stay in the range of
+     the normalized numbers up to n = 1024 */
+  v4df n1 = _mm256_mul_pd(fx, *(v4df*)_pd256_0p5);
+  n1 = _mm256_sub_pd(_mm256_add_pd(n1, *(v4df*)_pd256_magic), *(v4df*)_pd256_magic);
+  v4df n2 = _mm256_sub_pd(fx, n1);
+  y = _mm256_mul_pd(y, _pd256_slli_52(_mm256_add_pd(n1, *(v4df*)_pd256_magic_bias)));
+  y = _mm256_mul_pd(y, _pd256_slli_52(_mm256_add_pd(n2, *(v4df*)_pd256_magic_bias)));
+  return y;
+}
+
+_PD256_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD256_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD256_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD256_CONST(sincof_p0,  1.58962301576546568060E-10);
+_PD256_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD256_CONST(sincof_p2,  2.75573136213857245213E-6);
+_PD256_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD256_CONST(sincof_p4,  8.33333333332211858878E-3);
+_PD256_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD256_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD256_CONST(coscof_p1,  2.08757008419747316778E-9);
+_PD256_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD256_CONST(coscof_p3,  2.48015872888517045348E-5);
+_PD256_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD256_CONST(coscof_p5,  4.16666666666665929218E-2);
+_PD256_CONST(cephes_FOPI, 1.27323954473516268615); // 4 / M_PI
+
+/* range reduction shared by sin256_pd, cos256_pd and sincos256_pd: returns j (the
+   4 octants in int32) and reduces x in [-Pi/4, Pi/4],
+   x has to be positive. Precision is good as long as x < 2^30. */
+static inline v4si _sincos_reduce256_pd(v4df *x) {
+  v4df y = _mm256_mul_pd(*x, *(v4df*)_pd256_cephes_FOPI);
+
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  v4si emm2 = _mm256_cvttpd_epi32(y);
+  emm2 = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+  emm2 = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+  y = _mm256_cvtepi32_pd(emm2);
+
+  /* The magic pass: "Extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  *x = _mm256_add_pd(*x, _mm256_mul_pd(y, *(v4df*)_pd256_minus_cephes_DP1));
+  *x = _mm256_add_pd(*x, _mm256_mul_pd(y, *(v4df*)_pd256_minus_cephes_DP2));
+  *x = _mm256_add_pd(*x, _mm256_mul_pd(y, *(v4df*)_pd256_minus_cephes_DP3));
+
+  return emm2;
+}
+
+/* first polynom (0 <= x <= Pi/4), z = x * x */
+static inline v4df _sin_poly256_pd(v4df x, v4df z) {
+  v4df y = *(v4df*)_pd256_sincof_p0;
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_sincof_p1);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_sincof_p2);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_sincof_p3);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_sincof_p4);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_sincof_p5);
+  y = _mm256_mul_pd(_mm256_mul_pd(y, z), x);
+  return _mm256_add_pd(y, x);
+}
+
+/* second polynom (Pi/4 <= x <= Pi/2), z = x * x */
+static inline v4df _cos_poly256_pd(v4df z) {
+  v4df y = *(v4df*)_pd256_coscof_p0;
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_coscof_p1);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_coscof_p2);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_coscof_p3);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_coscof_p4);
+  y = _mm256_add_pd(_mm256_mul_pd(y, z), *(v4df*)_pd256_coscof_p5);
+  y = _mm256_mul_pd(_mm256_mul_pd(y, z), z);
+  y = _mm256_sub_pd(y, _mm256_mul_pd(z, *(v4df*)_pd256_0p5));
+  return _mm256_add_pd(y, *(v4df*)_pd256_1);
+}
+
+v4df sin256_pd(v4df x) { // any x
+  /* extract the sign bit and take the absolute value */
+  v4df sign_bit = _mm256_and_pd(x, *(v4df*)_pd256_sign_mask);
+  x = _mm256_and_pd(x, *(v4df*)_pd256_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce256_pd(&x);
+
+  /* get the swap sign flag */
+  v4si emm0 = _mm_slli_epi32(_mm_and_si128(emm2, _mm_set1_epi32(4)), 29);
+  /* get the polynom selection mask */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, _mm_set1_epi32(2)), _mm_setzero_si128());
+
+  sign_bit = _mm256_xor_pd(sign_bit, _pd256_unpack_epi32(_mm_setzero_si128(), emm0));
+  v4df poly_mask = _pd256_unpack_epi32(emm2, emm2);
+
+  v4df z = _mm256_mul_pd(x,x);
+  v4df y1 = _cos_poly256_pd(z);
+  v4df y2 = _sin_poly256_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v4df y = _mm256_or_pd(_mm256_and_pd(poly_mask, y2), _mm256_andnot_pd(poly_mask, y1));
+  /* update the sign */
+  return _mm256_xor_pd(y, sign_bit);
+}
+
+v4df cos256_pd(v4df x) { // any x
+  /* take the absolute value */
+  x = _mm256_and_pd(x, *(v4df*)_pd256_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce256_pd(&x);
+  emm2 = _mm_sub_epi32(emm2, _mm_set1_epi32(2));
+
+  /* get the swap sign flag */
+  v4si emm0 = _mm_slli_epi32(_mm_andnot_si128(emm2, _mm_set1_epi32(4)), 29);
+  /* get the polynom selection mask */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, _mm_set1_epi32(2)), _mm_setzero_si128());
+
+  v4df sign_bit = _pd256_unpack_epi32(_mm_setzero_si128(), emm0);
+  v4df poly_mask = _pd256_unpack_epi32(emm2, emm2);
+
+  v4df z = _mm256_mul_pd(x,x);
+  v4df y1 = _cos_poly256_pd(z);
+  v4df y2 = _sin_poly256_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v4df y = _mm256_or_pd(_mm256_and_pd(poly_mask, y2), _mm256_andnot_pd(poly_mask, y1));
+  /* update the sign */
+  return _mm256_xor_pd(y, sign_bit);
+}
+
+/* since sin256_pd and cos256_pd are almost identical, sincos256_pd could replace both of them..
+   it is almost as fast, and gives you a free cosine with your sine */
+void sincos256_pd(v4df x, v4df *s, v4df *c) {
+  /* extract the sign bit and take the absolute value */
+  v4df sign_bit_sin = _mm256_and_pd(x, *(v4df*)_pd256_sign_mask);
+  x = _mm256_and_pd(x, *(v4df*)_pd256_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce256_pd(&x);
+
+  /* get the swap sign flag for the sine */
+  v4si emm0 = _mm_slli_epi32(_mm_and_si128(emm2, _mm_set1_epi32(4)), 29);
+  sign_bit_sin = _mm256_xor_pd(sign_bit_sin, _pd256_unpack_epi32(_mm_setzero_si128(), emm0));
+
+  /* get the swap sign flag for the cosine */
+  v4si emm4 = _mm_sub_epi32(emm2, _mm_set1_epi32(2));
+  emm4 = _mm_slli_epi32(_mm_andnot_si128(emm4, _mm_set1_epi32(4)), 29);
+  v4df sign_bit_cos = _pd256_unpack_epi32(_mm_setzero_si128(), emm4);
+
+  /* get the polynom selection mask for the sine */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, _mm_set1_epi32(2)), _mm_setzero_si128());
+  v4df poly_mask = _pd256_unpack_epi32(emm2, emm2);
+
+  v4df z = _mm256_mul_pd(x,x);
+  v4df y1 = _cos_poly256_pd(z);
+  v4df y2 = _sin_poly256_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v4df ysin = _mm256_or_pd(_mm256_and_pd (poly_mask, y2), _mm256_andnot_pd(poly_mask, y1));
+  v4df ycos = _mm256_or_pd(_mm256_and_pd (poly_mask, y1), _mm256_andnot_pd(poly_mask, y2));
+
+  /* update the sign */
+  *s = _mm256_xor_pd(ysin, sign_bit_sin);
+  *c = _mm256_xor_pd(ycos, sign_bit_cos);
+}
+
 #endif
@@ -296,4 +296,232 @@ v4sf cos_ps(v4sf x) {
   return ycos;
 }
 
+#ifdef __aarch64__
+/* double precision versions of log, exp, sin, cos and sincos (ARMv8 only),
+   they are the rewriting of the cephes double routines */
+
+typedef uint64x2_t v2du; // vector of 2 uint64
+typedef int64x2_t  v2di; // vector of 2 int64
+
+#define c_pd_cephes_SQRTH 0.70710678118654752440
+#define c_pd_cephes_log_p0 1.01875663804580931796E-4
+#define c_pd_cephes_log_p1 4.97494994976747001425E-1
+#define c_pd_cephes_log_p2 4.70579119878881725854E0
+#define c_pd_cephes_log_p3 1.44989225341610930846E1
+#define c_pd_cephes_log_p4 1.79368678507819816313E1
+#define c_pd_cephes_log_p5 7.70838733755885391666E0
+#define c_pd_cephes_log_q0 1.12873587189167450590E1
+#define c_pd_cephes_log_q1 4.52279145837532221105E1
+#define c_pd_cephes_log_q2 8.29875266912776603211E1
+#define c_pd_cephes_log_q3 7.11544750618563894466E1
+#define c_pd_cephes_log_q4 2.31251620126765340583E1
+#define c_pd_cephes_log_C1 2.121944400546905827679E-4
+#define c_pd_cephes_log_C2 0.693359375
+
+/* natural logarithm computed for 2 simultaneous double
+   return NaN for x <= 0
+*/
+v2df log_pd(v2df x) {
+  v2df one = vdupq_n_f64(1);
+
+  x = vmaxq_f64(x, vdupq_n_f64(0)); /* force flush to zero on denormal values */
+  v2du invalid_mask = vcleq_f64(x, vdupq_n_f64(0));
+
+  v2du ux = vreinterpretq_u64_f64(x);
+
+  v2du emm0 = vshrq_n_u64(ux, 52);
+
+  /* keep only the fractional part */
+  ux = vandq_u64(ux, vdupq_n_u64(~0x7ff0000000000000ULL));
+  ux = vorrq_u64(ux, vreinterpretq_u64_f64(vdupq_n_f64(0.5)));
+  x = vreinterpretq_f64_u64(ux);
+
+  v2df e = vcvtq_f64_s64(vsubq_s64(vreinterpretq_s64_u64(emm0), vdupq_n_s64(1022)));
+
+  /* part2:
+     if( x < SQRTH ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  v2du mask = vcltq_f64(x, vdupq_n_f64(c_pd_cephes_SQRTH));
+  v2df tmp = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(x), mask));
+  x = vsubq_f64(x, one);
+  e = vsubq_f64(e, vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(one), mask)));
+  x = vaddq_f64(x, tmp);
+
+  v2df z = vmulq_f64(x,x);
+
+  /* y = x * (z * P(x) / Q(x)) */
+  v2df p = vdupq_n_f64(c_pd_cephes_log_p0);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_p1), p, x);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_p2), p, x);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_p3), p, x);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_p4), p, x);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_p5), p, x);
+
+  v2df q = vaddq_f64(x, vdupq_n_f64(c_pd_cephes_log_q0));
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_q1), q, x);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_q2), q, x);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_q3), q, x);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_log_q4), q, x);
+
+  v2df y = vmulq_f64(x, vdivq_f64(vmulq_f64(z, p), q));
+
+  y = vfmsq_f64(y, e, vdupq_n_f64(c_pd_cephes_log_C1));
+  y = vfmsq_f64(y, z, vdupq_n_f64(0.5));
+
+  x = vaddq_f64(x, y);
+  x = vfmaq_f64(x, e, vdupq_n_f64(c_pd_cephes_log_C2));
+  x = vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(x), invalid_mask)); // negative arg will be NAN
+  return x;
+}
+
+#define c_pd_exp_hi  709.782712893383996843
+#define c_pd_exp_lo -708.39641853226410622
+
+#define c_pd_cephes_LOG2E 1.4426950408889634073599
+#define c_pd_cephes_exp_C1 6.93145751953125E-1
+#define c_pd_cephes_exp_C2 1.42860682030941723212E-6
+
+#define c_pd_cephes_exp_p0 1.26177193074810590878E-4
+#define c_pd_cephes_exp_p1 3.02994407707441961300E-2
+#define c_pd_cephes_exp_p2 9.99999999999999999910E-1
+#define c_pd_cephes_exp_q0 3.00198505138664455042E-6
+#define c_pd_cephes_exp_q1 2.52448340349684104192E-3
+#define c_pd_cephes_exp_q2 2.27265548208155028766E-1
+#define c_pd_cephes_exp_q3 2.00000000000000000009E0
+
+v2df exp_pd(v2df x) {
+  x = vminq_f64(x, vdupq_n_f64(c_pd_exp_hi));
+  x = vmaxq_f64(x, vdupq_n_f64(c_pd_exp_lo));
+
+  /* express exp(x) as exp(g + n*log(2)), n = round(x * log2(e)) */
+  v2df fx = vrndnq_f64(vmulq_f64(x, vdupq_n_f64(c_pd_cephes_LOG2E)));
+
+  x = vfmsq_f64(x, fx, vdupq_n_f64(c_pd_cephes_exp_C1));
+  x = vfmsq_f64(x, fx, vdupq_n_f64(c_pd_cephes_exp_C2));
+
+  v2df z = vmulq_f64(x,x);
+
+  /* exp(g) = 1 + 2 * g P(g^2) / (Q(g^2) - g P(g^2)) */
+  v2df p = vdupq_n_f64(c_pd_cephes_exp_p0);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_exp_p1), p, z);
+  p = vfmaq_f64(vdupq_n_f64(c_pd_cephes_exp_p2), p, z);
+  p = vmulq_f64(p, x);
+
+  v2df q = vdupq_n_f64(c_pd_cephes_exp_q0);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_exp_q1), q, z);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_exp_q2), q, z);
+  q = vfmaq_f64(vdupq_n_f64(c_pd_cephes_exp_q3), q, z);
+
+  v2df y = vdivq_f64(p, vsubq_f64(q, p));
+  y = vfmaq_f64(vdupq_n_f64(1), y, vdupq_n_f64(2));
+
+  /* build 2^n in two steps (2^n1 * 2^n2 with n1 = n/2) to stay in the range of
+     the normalized numbers up to n = 1024 */
+  v2df n1 = vrndnq_f64(vmulq_f64(fx, vdupq_n_f64(0.5)));
+  v2df n2 = vsubq_f64(fx, n1);
+  v2di mm0 = vshlq_n_s64(vaddq_s64(vcvtq_s64_f64(n1), vdupq_n_s64(1023)), 52);
+  v2di mm1 = vshlq_n_s64(vaddq_s64(vcvtq_s64_f64(n2), vdupq_n_s64(1023)), 52);
+
+  y = vmulq_f64(y, vreinterpretq_f64_s64(mm0));
+  y = vmulq_f64(y, vreinterpretq_f64_s64(mm1));
+  return y;
+}
+
+#define c_pd_minus_cephes_DP1 -7.85398125648498535156E-1
+#define c_pd_minus_cephes_DP2 -3.77489470793079817668E-8
+#define c_pd_minus_cephes_DP3 -2.69515142907905952645E-15
+#define c_pd_sincof_p0  1.58962301576546568060E-10
+#define c_pd_sincof_p1 -2.50507477628578072866E-8
+#define c_pd_sincof_p2  2.75573136213857245213E-6
+#define c_pd_sincof_p3 -1.98412698295895385996E-4
+#define c_pd_sincof_p4  8.33333333332211858878E-3
+#define c_pd_sincof_p5 -1.66666666666666307295E-1
+#define c_pd_coscof_p0 -1.13585365213876817300E-11
+#define c_pd_coscof_p1  2.08757008419747316778E-9
+#define c_pd_coscof_p2 -2.75573141792967388112E-7
+#define c_pd_coscof_p3  2.48015872888517045348E-5
+#define c_pd_coscof_p4 -1.38888888888730564116E-3
+#define c_pd_coscof_p5  4.16666666666665929218E-2
+#define c_pd_cephes_FOPI 1.27323954473516268615 // 4 / M_PI
+
+/* evaluation of 2 sines & cosines at once (see sincos_ps), precision is good
+   as long as |x| < 2^30 */
+void sincos_pd(v2df x, v2df *ysin, v2df *ycos) { // any x
+  v2du sign_mask_sin, sign_mask_cos;
+  sign_mask_sin = vcltq_f64(x, vdupq_n_f64(0));
+  x = vabsq_f64(x);
+
+  /* scale by 4/Pi */
+  v2df y = vmulq_f64(x, vdupq_n_f64(c_pd_cephes_FOPI));
+
+  /* store the integer part of y in mm0 */
+  v2du emm2 = vcvtq_u64_f64(y);
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  emm2 = vaddq_u64(emm2, vdupq_n_u64(1));
+  emm2 = vandq_u64(emm2, vdupq_n_u64(~1ULL));
+  y = vcvtq_f64_u64(emm2);
+
+  /* get the polynom selection mask
+     there is one polynom for 0 <= x <= Pi/4
+     and another one for Pi/4<x<=Pi/2
+
+     Both branches will be computed.
+  */
+  v2du poly_mask = vtstq_u64(emm2, vdupq_n_u64(2));
+
+  /* The magic pass: "Extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  x = vfmaq_f64(x, y, vdupq_n_f64(c_pd_minus_cephes_DP1));
+  x = vfmaq_f64(x, y, vdupq_n_f64(c_pd_minus_cephes_DP2));
+  x = vfmaq_f64(x, y, vdupq_n_f64(c_pd_minus_cephes_DP3));
+
+  sign_mask_sin = veorq_u64(sign_mask_sin, vtstq_u64(emm2, vdupq_n_u64(4)));
+  sign_mask_cos = vtstq_u64(vsubq_u64(emm2, vdupq_n_u64(2)), vdupq_n_u64(4));
+
+  /* Evaluate the first polynom  (0 <= x <= Pi/4) in y1,
+     and the second polynom      (Pi/4 <= x <= 0) in y2 */
+  v2df z = vmulq_f64(x,x);
+  v2df y1, y2;
+
+  y1 = vdupq_n_f64(c_pd_coscof_p0);
+  y1 = vfmaq_f64(vdupq_n_f64(c_pd_coscof_p1), y1, z);
+  y1 = vfmaq_f64(vdupq_n_f64(c_pd_coscof_p2), y1, z);
+  y1 = vfmaq_f64(vdupq_n_f64(c_pd_coscof_p3), y1, z);
+  y1 = vfmaq_f64(vdupq_n_f64(c_pd_coscof_p4), y1, z);
+  y1 = vfmaq_f64(vdupq_n_f64(c_pd_coscof_p5), y1, z);
+  y1 = vmulq_f64(vmulq_f64(y1, z), z);
+  y1 = vfmsq_f64(y1, z, vdupq_n_f64(0.5));
+  y1 = vaddq_f64(y1, vdupq_n_f64(1));
+
+  y2 = vdupq_n_f64(c_pd_sincof_p0);
+  y2 = vfmaq_f64(vdupq_n_f64(c_pd_sincof_p1), y2, z);
+  y2 = vfmaq_f64(vdupq_n_f64(c_pd_sincof_p2), y2, z);
+  y2 = vfmaq_f64(vdupq_n_f64(c_pd_sincof_p3), y2, z);
+  y2 = vfmaq_f64(vdupq_n_f64(c_pd_sincof_p4), y2, z);
+  y2 = vfmaq_f64(vdupq_n_f64(c_pd_sincof_p5), y2, z);
+  y2 = vfmaq_f64(x, vmulq_f64(y2, z), x);
+
+  /* select the correct result from the two polynoms */
+  v2df ys = vbslq_f64(poly_mask, y1, y2);
+  v2df yc = vbslq_f64(poly_mask, y2, y1);
+  *ysin = vbslq_f64(sign_mask_sin, vnegq_f64(ys), ys);
+  *ycos = vbslq_f64(sign_mask_cos, yc, vnegq_f64(yc));
+}
+
+v2df sin_pd(v2df x) {
+  v2df ysin, ycos;
+  sincos_pd(x, &ysin, &ycos);
+  return ysin;
+}
+
+v2df cos_pd(v2df x) {
+  v2df ysin, ycos;
+  sincos_pd(x, &ysin, &ycos);
+  return ycos;
+}
+#endif // __aarch64__
+
 #endif
\ No newline at end of file
@@ -38,11 +38,23 @@
 typedef __m128 v4sf;  // vector of 4 float (sse1)
 
 // prototypes
-inline v4sf log_ps(v4sf x);
-inline v4sf exp_ps(v4sf x);
-inline v4sf sin_ps(v4sf x);
-inline v4sf cos_ps(v4sf x);
-inline void sincos_ps(v4sf x, v4sf *s, v4sf *c);
+static inline v4sf log_ps(v4sf x);
+static inline v4sf exp_ps(v4sf x);
+static inline v4sf sin_ps(v4sf x);
+static inline v4sf cos_ps(v4sf x);
+static inline void sincos_ps(v4sf x, v4sf *s, v4sf *c);
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+typedef __m128d v2df; // vector of 2 double (sse2)
+
+static inline v2df log_pd(v2df x);
+static inline v2df exp_pd(v2df x);
+static inline v2df sin_pd(v2df x);
+static inline v2df cos_pd(v2df x);
+static inline void sincos_pd(v2df x, v2df *s, v2df *c);
+#endif
 
 #include "sse_mathfun.hxx"
 
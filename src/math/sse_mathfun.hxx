@@ -703,4 +703,316 @@ void sincos_ps(v4sf x, v4sf *s, v4sf *c) {
   *c = _mm_xor_ps(xmm2, sign_bit_cos);
 }
 
+#ifdef __SSE2__
+/* double precision versions of log, exp, sin, cos and sincos, they are the
+   rewriting of the cephes double routines (same structure as the single
+   precision versions above) */
+
+#define _PD_CONST(Name, Val)                                            \
+  static const ALIGN16_BEG double _pd_##Name[2] ALIGN16_END = { Val, Val }
+#define _PD_CONST_TYPE(Name, Type, Val)                                 \
+  static const ALIGN16_BEG Type _pd_##Name[2] ALIGN16_END = { Val, Val }
+
+_PD_CONST(1  , 1.0);
+_PD_CONST(0p5, 0.5);
+_PD_CONST(2  , 2.0);
+/* the smallest non denormalized double number */
+_PD_CONST_TYPE(min_norm_pos, long long, 0x0010000000000000LL);
+_PD_CONST_TYPE(inv_mant_mask, long long, ~0x7ff0000000000000LL);
+
+_PD_CONST_TYPE(sign_mask, long long, (long long)0x8000000000000000ULL);
+_PD_CONST_TYPE(inv_sign_mask, long long, 0x7fffffffffffffffLL);
+
+/* 1.5 * 2^52: (x + magic) - magic rounds x to the nearest integer and the low
+   bits of (x + magic) contain this integer (for |x| < 2^51), this is how the
+   conversions between double and int64 are made without SSE4.1 nor AVX-512 */
+_PD_CONST(magic, 6755399441055744.0);
+_PD_CONST(magic_bias, 6755399441055744.0 + 1023.0);
+
+_PD_CONST(cephes_SQRTH, 0.70710678118654752440);
+_PD_CONST(cephes_log_p0, 1.01875663804580931796E-4);
+_PD_CONST(cephes_log_p1, 4.97494994976747001425E-1);
+_PD_CONST(cephes_log_p2, 4.70579119878881725854E0);
+_PD_CONST(cephes_log_p3, 1.44989225341610930846E1);
+_PD_CONST(cephes_log_p4, 1.79368678507819816313E1);
+_PD_CONST(cephes_log_p5, 7.70838733755885391666E0);
+_PD_CONST(cephes_log_q0, 1.12873587189167450590E1);
+_PD_CONST(cephes_log_q1, 4.52279145837532221105E1);
+_PD_CONST(cephes_log_q2, 8.29875266912776603211E1);
+_PD_CONST(cephes_log_q3, 7.11544750618563894466E1);
+_PD_CONST(cephes_log_q4, 2.31251620126765340583E1);
+_PD_CONST(cephes_log_C1, 2.121944400546905827679E-4);
+_PD_CONST(cephes_log_C2, 0.693359375);
+_PD_CONST(exp_bias, 1022.0);
+
+/* natural logarithm computed for 2 simultaneous double
+   return NaN for x <= 0
+*/
+v2df log_pd(v2df x) {
+  v2df one = *(v2df*)_pd_1;
+
+  v2df invalid_mask = _mm_cmple_pd(x, _mm_setzero_pd());
+
+  x = _mm_max_pd(x, *(v2df*)_pd_min_norm_pos);  /* cut off denormalized stuff */
+
+  /* part 1: x = frexp(x, &e); */
+  v4si emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+  /* keep only the fractional part */
+  x = _mm_and_pd(x, *(v2df*)_pd_inv_mant_mask);
+  x = _mm_or_pd(x, *(v2df*)_pd_0p5);
+
+  /* convert the biased exponent to double with the magic number */
+  emm0 = _mm_or_si128(emm0, _mm_castpd_si128(*(v2df*)_pd_magic));
+  v2df e = _mm_sub_pd(_mm_castsi128_pd(emm0), *(v2df*)_pd_magic);
+  e = _mm_sub_pd(e, *(v2df*)_pd_exp_bias);
+
+  /* part2:
+     if( x < SQRTH ) {
+       e -= 1;
+       x = x + x - 1.0;
+     } else { x = x - 1.0; }
+  */
+  v2df mask = _mm_cmplt_pd(x, *(v2df*)_pd_cephes_SQRTH);
+  v2df tmp = _mm_and_pd(x, mask);
+  x = _mm_sub_pd(x, one);
+  e = _mm_sub_pd(e, _mm_and_pd(one, mask));
+  x = _mm_add_pd(x, tmp);
+
+  v2df z = _mm_mul_pd(x,x);
+
+  /* y = x * (z * P(x) / Q(x)) */
+  v2df p = *(v2df*)_pd_cephes_log_p0;
+  p = _mm_add_pd(_mm_mul_pd(p, x), *(v2df*)_pd_cephes_log_p1);
+  p = _mm_add_pd(_mm_mul_pd(p, x), *(v2df*)_pd_cephes_log_p2);
+  p = _mm_add_pd(_mm_mul_pd(p, x), *(v2df*)_pd_cephes_log_p3);
+  p = _mm_add_pd(_mm_mul_pd(p, x), *(v2df*)_pd_cephes_log_p4);
+  p = _mm_add_pd(_mm_mul_pd(p, x), *(v2df*)_pd_cephes_log_p5);
+
+  v2df q = _mm_add_pd(x, *(v2df*)_pd_cephes_log_q0);
+  q = _mm_add_pd(_mm_mul_pd(q, x), *(v2df*)_pd_cephes_log_q1);
+  q = _mm_add_pd(_mm_mul_pd(q, x), *(v2df*)_pd_cephes_log_q2);
+  q = _mm_add_pd(_mm_mul_pd(q, x), *(v2df*)_pd_cephes_log_q3);
+  q = _mm_add_pd(_mm_mul_pd(q, x), *(v2df*)_pd_cephes_log_q4);
+
+  v2df y = _mm_mul_pd(x, _mm_div_pd(_mm_mul_pd(z, p), q));
+
+  tmp = _mm_mul_pd(e, *(v2df*)_pd_cephes_log_C1);
+  y = _mm_sub_pd(y, tmp);
+
+  tmp = _mm_mul_pd(z, *(v2df*)_pd_0p5);
+  y = _mm_sub_pd(y, tmp);
+
+  tmp = _mm_mul_pd(e, *(v2df*)_pd_cephes_log_C2);
+  x = _mm_add_pd(x, y);
+  x = _mm_add_pd(x, tmp);
+  x = _mm_or_pd(x, invalid_mask); // negative arg will be NAN
+  return x;
+}
+
+_PD_CONST(exp_hi,  709.782712893383996843);
+_PD_CONST(exp_lo, -708.39641853226410622);
+
+_PD_CONST(cephes_LOG2E, 1.4426950408889634073599);
+_PD_CONST(cephes_exp_C1, 6.93145751953125E-1);
+_PD_CONST(cephes_exp_C2, 1.42860682030941723212E-6);
+
+_PD_CONST(cephes_exp_p0, 1.26177193074810590878E-4);
+_PD_CONST(cephes_exp_p1, 3.02994407707441961300E-2);
+_PD_CONST(cephes_exp_p2, 9.99999999999999999910E-1);
+_PD_CONST(cephes_exp_q0, 3.00198505138664455042E-6);
+_PD_CONST(cephes_exp_q1, 2.52448340349684104192E-3);
+_PD_CONST(cephes_exp_q2, 2.27265548208155028766E-1);
+_PD_CONST(cephes_exp_q3, 2.00000000000000000009E0);
+
+v2df exp_pd(v2df x) {
+  x = _mm_min_pd(x, *(v2df*)_pd_exp_hi);
+  x = _mm_max_pd(x, *(v2df*)_pd_exp_lo);
+
+  /* express exp(x) as exp(g + n*log(2)), n = round(x * log2(e)) */
+  v2df fx = _mm_mul_pd(x, *(v2df*)_pd_cephes_LOG2E);
+  fx = _mm_sub_pd(_mm_add_pd(fx, *(v2df*)_pd_magic), *(v2df*)_pd_magic);
+
+  v2df tmp = _mm_mul_pd(fx, *(v2df*)_pd_cephes_exp_C1);
+  v2df z = _mm_mul_pd(fx, *(v2df*)_pd_cephes_exp_C2);
+  x = _mm_sub_pd(x, tmp);
+  x = _mm_sub_pd(x, z);
+
+  z = _mm_mul_pd(x,x);
+
+  /* exp(g) = 1 + 2 * g P(g^2) / (Q(g^2) - g P(g^2)) */
+  v2df p = *(v2df*)_pd_cephes_exp_p0;
+  p = _mm_add_pd(_mm_mul_pd(p, z), *(v2df*)_pd_cephes_exp_p1);
+  p = _mm_add_pd(_mm_mul_pd(p, z), *(v2df*)_pd_cephes_exp_p2);
+  p = _mm_mul_pd(p, x);
+
+  v2df q = *(v2df*)_pd_cephes_exp_q0;
+  q = _mm_add_pd(_mm_mul_pd(q, z), *(v2df*)_pd_cephes_exp_q1);
+  q = _mm_add_pd(_mm_mul_pd(q, z), *(v2df*)_pd_cephes_exp_q2);
+  q = _mm_add_pd(_mm_mul_pd(q, z), *(v2df*)_pd_cephes_exp_q3);
+
+  v2df y = _mm_div_pd(p, _mm_sub_pd(q, p));
+  y = _mm_add_pd(_mm_mul_pd(y, *(v2df*)_pd_2), *(v2df*)_pd_1);
+
+  /* build 2^n in two steps (2^n1 * 2^n2 with n1 = n/2) to stay in the range of
+     the normalized numbers up to n = 1024 */
+  v2df n1 = _mm_mul_pd(fx, *(v2df*)_pd_0p5);
+  n1 = _mm_sub_pd(_mm_add_pd(n1, *(v2df*)_pd_magic), *(v2df*)_pd_magic);
+  v2df n2 = _mm_sub_pd(fx, n1);
+  v4si emm0 = _mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(n1, *(v2df*)_pd_magic_bias)), 52);
+  v4si emm1 = _mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(n2, *(v2df*)_pd_magic_bias)), 52);
+  y = _mm_mul_pd(y, _mm_castsi128_pd(emm0));
+  y = _mm_mul_pd(y, _mm_castsi128_pd(emm1));
+  return y;
+}
+
+_PD_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD_CONST(sincof_p0,  1.58962301576546568060E-10);
+_PD_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD_CONST(sincof_p2,  2.75573136213857245213E-6);
+_PD_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD_CONST(sincof_p4,  8.33333333332211858878E-3);
+_PD_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD_CONST(coscof_p1,  2.08757008419747316778E-9);
+_PD_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD_CONST(coscof_p3,  2.48015872888517045348E-5);
+_PD_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD_CONST(coscof_p5,  4.16666666666665929218E-2);
+_PD_CONST(cephes_FOPI, 1.27323954473516268615); // 4 / M_PI
+
+/* range reduction shared by sin_pd, cos_pd and sincos_pd: returns j (the
+   octant in the int32 of each 64-bit lane) and reduces x in [-Pi/4, Pi/4],
+   x has to be positive. Precision is good as long as x < 2^30. */
+static inline v4si _sincos_reduce_pd(v2df *x) {
+  v2df y = _mm_mul_pd(*x, *(v2df*)_pd_cephes_FOPI);
+
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  v4si emm2 = _mm_cvttpd_epi32(y);
+  emm2 = _mm_add_epi32(emm2, *(v4si*)_pi32_1);
+  emm2 = _mm_and_si128(emm2, *(v4si*)_pi32_inv1);
+  y = _mm_cvtepi32_pd(emm2);
+
+  /* The magic pass: "Extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  *x = _mm_add_pd(*x, _mm_mul_pd(y, *(v2df*)_pd_minus_cephes_DP1));
+  *x = _mm_add_pd(*x, _mm_mul_pd(y, *(v2df*)_pd_minus_cephes_DP2));
+  *x = _mm_add_pd(*x, _mm_mul_pd(y, *(v2df*)_pd_minus_cephes_DP3));
+
+  /* duplicate j in the two halves of each 64-bit lane */
+  return _mm_shuffle_epi32(emm2, _MM_SHUFFLE(1,1,0,0));
+}
+
+/* first polynom (0 <= x <= Pi/4), z = x * x */
+static inline v2df _sin_poly_pd(v2df x, v2df z) {
+  v2df y = *(v2df*)_pd_sincof_p0;
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_sincof_p1);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_sincof_p2);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_sincof_p3);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_sincof_p4);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_sincof_p5);
+  y = _mm_mul_pd(_mm_mul_pd(y, z), x);
+  return _mm_add_pd(y, x);
+}
+
+/* second polynom (Pi/4 <= x <= Pi/2), z = x * x */
+static inline v2df _cos_poly_pd(v2df z) {
+  v2df y = *(v2df*)_pd_coscof_p0;
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_coscof_p1);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_coscof_p2);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_coscof_p3);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_coscof_p4);
+  y = _mm_add_pd(_mm_mul_pd(y, z), *(v2df*)_pd_coscof_p5);
+  y = _mm_mul_pd(_mm_mul_pd(y, z), z);
+  y = _mm_sub_pd(y, _mm_mul_pd(z, *(v2df*)_pd_0p5));
+  return _mm_add_pd(y, *(v2df*)_pd_1);
+}
+
+v2df sin_pd(v2df x) { // any x
+  /* extract the sign bit and take the absolute value */
+  v2df sign_bit = _mm_and_pd(x, *(v2df*)_pd_sign_mask);
+  x = _mm_and_pd(x, *(v2df*)_pd_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce_pd(&x);
+
+  /* get the swap sign flag */
+  v4si emm0 = _mm_slli_epi64(_mm_and_si128(emm2, *(v4si*)_pi32_4), 61);
+  /* get the polynom selection mask */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, *(v4si*)_pi32_2), _mm_setzero_si128());
+
+  sign_bit = _mm_xor_pd(sign_bit, _mm_castsi128_pd(emm0));
+  v2df poly_mask = _mm_castsi128_pd(emm2);
+
+  v2df z = _mm_mul_pd(x,x);
+  v2df y1 = _cos_poly_pd(z);
+  v2df y2 = _sin_poly_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v2df y = _mm_or_pd(_mm_and_pd(poly_mask, y2), _mm_andnot_pd(poly_mask, y1));
+  /* update the sign */
+  return _mm_xor_pd(y, sign_bit);
+}
+
+v2df cos_pd(v2df x) { // any x
+  /* take the absolute value */
+  x = _mm_and_pd(x, *(v2df*)_pd_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce_pd(&x);
+  emm2 = _mm_sub_epi32(emm2, *(v4si*)_pi32_2);
+
+  /* get the swap sign flag */
+  v4si emm0 = _mm_slli_epi64(_mm_andnot_si128(emm2, *(v4si*)_pi32_4), 61);
+  /* get the polynom selection mask */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, *(v4si*)_pi32_2), _mm_setzero_si128());
+
+  v2df sign_bit = _mm_castsi128_pd(emm0);
+  v2df poly_mask = _mm_castsi128_pd(emm2);
+
+  v2df z = _mm_mul_pd(x,x);
+  v2df y1 = _cos_poly_pd(z);
+  v2df y2 = _sin_poly_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v2df y = _mm_or_pd(_mm_and_pd(poly_mask, y2), _mm_andnot_pd(poly_mask, y1));
+  /* update the sign */
+  return _mm_xor_pd(y, sign_bit);
+}
+
+/* since sin_pd and cos_pd are almost identical, sincos_pd could replace both of them..
+   it is almost as fast, and gives you a free cosine with your sine */
+void sincos_pd(v2df x, v2df *s, v2df *c) {
+  /* extract the sign bit and take the absolute value */
+  v2df sign_bit_sin = _mm_and_pd(x, *(v2df*)_pd_sign_mask);
+  x = _mm_and_pd(x, *(v2df*)_pd_inv_sign_mask);
+
+  v4si emm2 = _sincos_reduce_pd(&x);
+
+  /* get the swap sign flag for the sine */
+  v4si emm0 = _mm_slli_epi64(_mm_and_si128(emm2, *(v4si*)_pi32_4), 61);
+  sign_bit_sin = _mm_xor_pd(sign_bit_sin, _mm_castsi128_pd(emm0));
+
+  /* get the swap sign flag for the cosine */
+  v4si emm4 = _mm_sub_epi32(emm2, *(v4si*)_pi32_2);
+  emm4 = _mm_slli_epi64(_mm_andnot_si128(emm4, *(v4si*)_pi32_4), 61);
+  v2df sign_bit_cos = _mm_castsi128_pd(emm4);
+
+  /* get the polynom selection mask for the sine */
+  emm2 = _mm_cmpeq_epi32(_mm_and_si128(emm2, *(v4si*)_pi32_2), _mm_setzero_si128());
+  v2df poly_mask = _mm_castsi128_pd(emm2);
+
+  v2df z = _mm_mul_pd(x,x);
+  v2df y1 = _cos_poly_pd(z);
+  v2df y2 = _sin_poly_pd(x, z);
+
+  /* select the correct result from the two polynoms */
+  v2df ysin = _mm_or_pd(_mm_and_pd (poly_mask, y2), _mm_andnot_pd(poly_mask, y1));
+  v2df ycos = _mm_or_pd(_mm_and_pd (poly_mask, y1), _mm_andnot_pd(poly_mask, y2));
+
+  /* update the sign */
+  *s = _mm_xor_pd(ysin, sign_bit_sin);
+  *c = _mm_xor_pd(ycos, sign_bit_cos);
+}
+#endif // __SSE2__
+
 #endif
\ No newline at end of file
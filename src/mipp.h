@@ -35,7 +35,18 @@ SOFTWARE.
 #define MIPP
 
 #ifndef MIPP_NO_INTRINSICS
-#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#if defined(MIPP_EMULATED)
+// portable registers of 'MIPP_REGISTER_SIZE' bits (see "mipp_impl_EMU.hxx"), no intrinsics are used
+#ifndef MIPP_REGISTER_SIZE
+#define MIPP_REGISTER_SIZE 512
+#endif
+#if MIPP_REGISTER_SIZE != 128 && MIPP_REGISTER_SIZE != 256 && MIPP_REGISTER_SIZE != 512 && MIPP_REGISTER_SIZE != 1024
+#error "mipp: 'MIPP_REGISTER_SIZE' has to be 128, 256, 512 or 1024 with 'MIPP_EMULATED'."
+#endif
+#include <cstring>
+#include <limits>
+#include <array>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
 #include <arm_neon.h>
 #include "math/neon_mathfun.h"
 #elif defined(__SSE__) || defined(__AVX__) || defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
@@ -72,12 +83,17 @@ SOFTWARE.
 #include "mipp_scalar_op.h"
 #endif
 
+#include <initializer_list>
 #include <unordered_map>
 #include <typeindex>
 #include <stdexcept>
+#include <algorithm>
 #include <typeinfo>
+#include <type_traits>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <utility>
 #include <cstddef>
 #include <cassert>
 #include <cstdint>
@@ -86,12 +102,26 @@ SOFTWARE.
 #include <vector>
 #include <cmath>
 #include <map>
+#include <new>
 
 #if (defined(__GNUC__) || defined(__clang__) || defined(__llvm__)) && (defined(__linux__) || defined(__linux) || defined(__APPLE__)) && !defined(__ANDROID__)
 #include <execinfo.h>
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) || defined(__linux)
+#include <sys/mman.h>
+#define MIPP_HUGE_PAGES
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 #ifdef _MSC_VER
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -100,13 +130,108 @@ SOFTWARE.
 #undef max
 #endif
 
+// ------------------------------------------------------------------------------------------------ ISA inline namespace
+// --------------------------------------------------------------------------------------------------------------------
+// All the MIPP functions are defined in an inline namespace named after the targeted instruction set. Like this, a
+// kernel can be compiled several times (once per ISA, see "mipp_dispatch.hxx") and linked in the same binary without
+// any collision between the different instances of the MIPP inline functions.
+#ifndef MIPP_NO_INTRINSICS
+#if defined(MIPP_EMULATED)
+#if MIPP_REGISTER_SIZE == 128
+#define MIPP_ISA_NAMESPACE isa_emu128
+#elif MIPP_REGISTER_SIZE == 256
+#define MIPP_ISA_NAMESPACE isa_emu256
+#elif MIPP_REGISTER_SIZE == 512
+#define MIPP_ISA_NAMESPACE isa_emu512
+#else
+#define MIPP_ISA_NAMESPACE isa_emu1024
+#endif
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#ifdef __aarch64__
+#define MIPP_ISA_NAMESPACE isa_neonv2
+#else
+#define MIPP_ISA_NAMESPACE isa_neonv1
+#endif
+#elif defined(__AVX512BW__)
+#define MIPP_ISA_NAMESPACE isa_avx512bw
+#elif defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
+#define MIPP_ISA_NAMESPACE isa_avx512f
+#elif defined(__AVX2__) && defined(__FMA__)
+#define MIPP_ISA_NAMESPACE isa_avx2_fma
+#elif defined(__AVX2__)
+#define MIPP_ISA_NAMESPACE isa_avx2
+#elif defined(__AVX__) && defined(__FMA__)
+#define MIPP_ISA_NAMESPACE isa_avx_fma
+#elif defined(__AVX__)
+#define MIPP_ISA_NAMESPACE isa_avx
+#elif defined(__SSE4_2__)
+#define MIPP_ISA_NAMESPACE isa_sse4_2
+#elif defined(__SSE4_1__)
+#define MIPP_ISA_NAMESPACE isa_sse4_1
+#elif defined(__SSSE3__)
+#define MIPP_ISA_NAMESPACE isa_ssse3
+#elif defined(__SSE3__)
+#define MIPP_ISA_NAMESPACE isa_sse3
+#elif defined(__SSE2__)
+#define MIPP_ISA_NAMESPACE isa_sse2
+#elif defined(__SSE__)
+#define MIPP_ISA_NAMESPACE isa_sse
+#else
+#define MIPP_ISA_NAMESPACE isa_no
+#endif
+#else
+#define MIPP_ISA_NAMESPACE isa_no
+#endif
+
 namespace mipp // My Intrinsics Plus Plus => mipp
 {
+// instruction sets that can be selected at runtime (see "mipp_dispatch.hxx"), this enumeration does not depend on the
+// compilation flags and can be safely shared between translation units compiled for different ISAs
+enum class ISA : int { NO = 0, SSE, SSE2, SSE3, SSSE3, SSE4_1, SSE4_2, AVX, AVX2, AVX512F, AVX512BW, NEONv1, NEONv2 };
+
+inline namespace MIPP_ISA_NAMESPACE
+{
 // ------------------------------------------------------------------------------------------ myIntrinsics vector sizes
 // --------------------------------------------------------------------------------------------------------------------
 #ifndef MIPP_NO_INTRINSICS
+// ----------------------------------------------------------------------------------------------------------- EMULATED
+#if defined(MIPP_EMULATED)
+	const std::string InstructionType = "EMU";
+	#define MIPP_EMU
+
+	const std::string InstructionFullType = InstructionType + std::to_string(MIPP_REGISTER_SIZE);
+	const std::string InstructionVersion  = "1";
+
+	#define MIPP_REQUIRED_ALIGNMENT (MIPP_REGISTER_SIZE / 8)
+	#define MIPP_64BIT
+	#define MIPP_BW
+	#define MIPP_INSTR_VERSION 1
+	#define MIPP_LANES (MIPP_REGISTER_SIZE / 128)
+
+	// the registers are byte arrays ('K' only makes the mask and the register types distinct), the masks have the
+	// size of a register and an element of the mask is set when all its bits are set (as for SSE, AVX and NEON)
+	template <size_t B, int K>
+	struct _emu_reg { std::array<uint8_t,B> b; };
+
+	using msk   = _emu_reg<MIPP_REGISTER_SIZE / 8, 1>;
+	using reg   = _emu_reg<MIPP_REGISTER_SIZE / 8, 0>;
+	using reg_2 = _emu_reg<MIPP_REGISTER_SIZE / 16, 0>; // half a full register
+
+	template <int N>
+	inline reg toreg(const msk m) {
+		reg r;
+		r.b = m.b;
+		return r;
+	}
+
+	inline std::vector<std::string> InstructionExtensions()
+	{
+		std::vector<std::string> ext;
+		return ext;
+	}
+
 // ------------------------------------------------------------------------------------------------------- ARM NEON-128
-#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
 	const std::string InstructionType = "NEON";
 	#define MIPP_NEON
 
@@ -413,6 +538,9 @@ const bool SupportByteWord = true;
 const bool SupportByteWord = false;
 #endif
 
+// ------------------------------------------------------------------------------------------------- runtime dispatcher
+#include "mipp_dispatch.hxx"
+
 typedef struct regx2 { reg val[2]; } regx2;
 
 template <typename T>
@@ -458,15 +586,23 @@ inline bool isAligned(const T *ptr)
 // --------------------------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------- memory allocator
 
+// returns 'nullptr' if the allocation fails (or if 'nData * sizeof(T)' overflows)
 template <typename T>
-T* malloc(uint32_t nData)
+T* malloc(size_t nData)
 {
 	T* ptr = nullptr;
-
-#if !defined(MIPP_NO_INTRINSICS) && (defined(__SSE2__) || defined(__AVX__) || defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__))
+	if (nData > SIZE_MAX / sizeof(T))
+		return ptr;
+
+#if defined(MIPP_EMU) && defined(_MSC_VER)
+	ptr = (T*)_aligned_malloc(nData * sizeof(T), mipp::RequiredAlignment);
+#elif defined(MIPP_EMU)
+	if (posix_memalign((void**)&ptr, mipp::RequiredAlignment, nData * sizeof(T)) != 0)
+		ptr = nullptr;
+#elif !defined(MIPP_NO_INTRINSICS) && (defined(__SSE2__) || defined(__AVX__) || defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__))
 	ptr = (T*)_mm_malloc(nData * sizeof(T), mipp::RequiredAlignment);
 #else
-	ptr = (T*)std::malloc((size_t)(sizeof(T) * nData));
+	ptr = (T*)std::malloc(nData * sizeof(T));
 #endif
 
 	return ptr;
@@ -475,7 +611,11 @@ T* malloc(uint32_t nData)
 template <typename T>
 void free(T* ptr)
 {
-#if !defined(MIPP_NO_INTRINSICS) && (defined(__SSE2__) || defined(__AVX__) || defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__))
+#if defined(MIPP_EMU) && defined(_MSC_VER)
+	_aligned_free(ptr);
+#elif defined(MIPP_EMU)
+	std::free(ptr);
+#elif !defined(MIPP_NO_INTRINSICS) && (defined(__SSE2__) || defined(__AVX__) || defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__))
 	_mm_free(ptr);
 #else
 	std::free(ptr);
@@ -488,7 +628,7 @@ struct allocator
 	typedef T value_type;
 	allocator() { }
 	template <class C> allocator(const allocator<C>& other) { }
-	T* allocate(std::size_t n) { return mipp::malloc<T>((int)n); }
+	T* allocate(std::size_t n) { T* p = mipp::malloc<T>(n); if (!p) throw std::bad_alloc(); return p; }
 	void deallocate(T* p, std::size_t n) { mipp::free<T>(p); }
 };
 
@@ -500,8 +640,271 @@ bool operator==(const allocator<C1>& ma1, const allocator<C2>& ma2) { return tru
 template <class C1, class C2>
 bool operator!=(const allocator<C1>& ma1, const allocator<C2>& ma2) { return !(ma1 == ma2); }
 
-// override vector type
-template<class T> using vector = std::vector<T, allocator<T>>;
+// ----------------------------------------------------------------------------------------------- huge pages allocator
+// the buffers larger than 'MIPP_HUGE_PAGES_THRESHOLD' bytes are directly mapped and the kernel is asked to back them
+// with transparent huge pages (fewer TLB misses when streaming through them), with 'MIPP_ENABLE_HUGETLB' the reserved
+// huge pages ('MAP_HUGETLB') are tried first. The smaller buffers (and the other OSes) use 'mipp::malloc'. The size
+// has to be given back to 'free_huge'.
+#ifndef MIPP_HUGE_PAGES_THRESHOLD
+#define MIPP_HUGE_PAGES_THRESHOLD (2 * 1024 * 1024)
+#endif
+
+inline size_t _huge_pages_size(const size_t bytes)
+{
+	constexpr size_t huge_page = 2 * 1024 * 1024;
+	return ((bytes + huge_page -1) / huge_page) * huge_page;
+}
+
+template <typename T>
+T* malloc_huge(size_t nData)
+{
+	if (nData > SIZE_MAX / sizeof(T))
+		return nullptr;
+#if defined(MIPP_HUGE_PAGES)
+	const size_t bytes = nData * sizeof(T);
+	if (bytes >= (size_t)MIPP_HUGE_PAGES_THRESHOLD)
+	{
+		const size_t len = mipp::_huge_pages_size(bytes);
+		void *ptr = MAP_FAILED;
+#if defined(MIPP_ENABLE_HUGETLB) && defined(MAP_HUGETLB)
+		ptr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+		if (ptr == MAP_FAILED)
+		{
+			ptr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (ptr == MAP_FAILED)
+				return nullptr;
+#if defined(MADV_HUGEPAGE)
+			madvise(ptr, len, MADV_HUGEPAGE);
+#endif
+		}
+		return (T*)ptr;
+	}
+#endif
+	return mipp::malloc<T>(nData);
+}
+
+template <typename T>
+void free_huge(T* ptr, size_t nData)
+{
+#if defined(MIPP_HUGE_PAGES)
+	if (ptr != nullptr && nData * sizeof(T) >= (size_t)MIPP_HUGE_PAGES_THRESHOLD)
+	{
+		munmap((void*)ptr, mipp::_huge_pages_size(nData * sizeof(T)));
+		return;
+	}
+#endif
+	mipp::free<T>(ptr);
+}
+
+template <class T>
+struct huge_allocator
+{
+	typedef T value_type;
+	huge_allocator() { }
+	template <class C> huge_allocator(const huge_allocator<C>& other) { }
+	T* allocate(std::size_t n) { T* p = mipp::malloc_huge<T>(n); if (!p) throw std::bad_alloc(); return p; }
+	void deallocate(T* p, std::size_t n) { mipp::free_huge<T>(p, n); }
+};
+
+template <class C1, class C2>
+bool operator==(const huge_allocator<C1>& ma1, const huge_allocator<C2>& ma2) { return true; }
+
+template <class C1, class C2>
+bool operator!=(const huge_allocator<C1>& ma1, const huge_allocator<C2>& ma2) { return !(ma1 == ma2); }
+
+// ----------------------------------------------------------------------------------------------------- pool allocator
+// per thread cache of aligned blocks for the short-lived buffers (scratch vectors allocated in a loop): the sizes are
+// rounded up to a power of two and the deallocated blocks are kept in a free list per size instead of being released.
+// A block can be deallocated by another thread than the one that allocated it (it goes in the pool of the
+// deallocating thread), the cached blocks are released when the thread exits. The blocks larger than
+// 2^'MIPP_POOL_MAX_BLOCK_LOG2' bytes are not cached and at most 'MIPP_POOL_MAX_BLOCKS' blocks are kept per size.
+#ifndef MIPP_POOL_MAX_BLOCK_LOG2
+#define MIPP_POOL_MAX_BLOCK_LOG2 24
+#endif
+
+#ifndef MIPP_POOL_MAX_BLOCKS
+#define MIPP_POOL_MAX_BLOCKS 32
+#endif
+
+class _pool
+{
+private:
+	// the smallest blocks are 64 bytes (the largest alignment required by MIPP and room for the free list link)
+	static constexpr int min_log2 = 6;
+	static constexpr int n_sizes  = MIPP_POOL_MAX_BLOCK_LOG2 - min_log2 + 1;
+
+	struct node { node *next; };
+	node    *heads [n_sizes] = {};
+	uint32_t counts[n_sizes] = {};
+
+	_pool() = default;
+
+	~_pool()
+	{
+		for (auto s = 0; s < n_sizes; s++)
+			while (heads[s] != nullptr)
+			{
+				node *n = heads[s];
+				heads[s] = n->next;
+				mipp::free<uint8_t>((uint8_t*)n);
+			}
+		_pool::destroyed() = true;
+	}
+
+	// set when the pool of the thread is destroyed (the buffers deallocated after that are directly released), it is
+	// a trivial type and then it can be accessed until the thread ends
+	static bool& destroyed()
+	{
+		static thread_local bool d = false;
+		return d;
+	}
+
+	static _pool& local()
+	{
+		static thread_local _pool p;
+		return p;
+	}
+
+	static int size_id(const size_t bytes)
+	{
+		int l = min_log2;
+		while (l <= MIPP_POOL_MAX_BLOCK_LOG2 && ((size_t)1 << l) < bytes)
+			l++;
+		return l - min_log2;
+	}
+
+public:
+	static void* allocate(const size_t bytes)
+	{
+		const int s = _pool::size_id(bytes);
+		if (s >= n_sizes)
+			return (void*)mipp::malloc<uint8_t>(bytes);
+
+		if (!_pool::destroyed())
+		{
+			_pool &p = _pool::local();
+			if (p.heads[s] != nullptr)
+			{
+				node *n = p.heads[s];
+				p.heads[s] = n->next;
+				p.counts[s]--;
+				return (void*)n;
+			}
+		}
+		return (void*)mipp::malloc<uint8_t>((size_t)1 << (s + min_log2));
+	}
+
+	static void deallocate(void *ptr, const size_t bytes)
+	{
+		if (ptr == nullptr)
+			return;
+
+		const int s = _pool::size_id(bytes);
+		if (s < n_sizes && !_pool::destroyed())
+		{
+			_pool &p = _pool::local();
+			if (p.counts[s] < MIPP_POOL_MAX_BLOCKS)
+			{
+				node *n = (node*)ptr;
+				n->next = p.heads[s];
+				p.heads[s] = n;
+				p.counts[s]++;
+				return;
+			}
+		}
+		mipp::free<uint8_t>((uint8_t*)ptr);
+	}
+};
+
+template <class T>
+struct pool_allocator
+{
+	typedef T value_type;
+	pool_allocator() { }
+	template <class C> pool_allocator(const pool_allocator<C>& other) { }
+	T* allocate(std::size_t n)
+	{
+		if (n > SIZE_MAX / sizeof(T)) throw std::bad_alloc();
+		T* p = (T*)_pool::allocate(n * sizeof(T));
+		if (!p) throw std::bad_alloc();
+		return p;
+	}
+	void deallocate(T* p, std::size_t n) { _pool::deallocate((void*)p, n * sizeof(T)); }
+};
+
+template <class C1, class C2>
+bool operator==(const pool_allocator<C1>& ma1, const pool_allocator<C2>& ma2) { return true; }
+
+template <class C1, class C2>
+bool operator!=(const pool_allocator<C1>& ma1, const pool_allocator<C2>& ma2) { return !(ma1 == ma2); }
+
+// override vector type, the allocator can be replaced by 'huge_allocator<T>' or 'pool_allocator<T>'
+template<class T, class A = allocator<T>> using vector = std::vector<T, A>;
+
+// ------------------------------------------------------------------------------------------------------ padded vector
+// aligned vector whose storage is always a whole number of registers ('padded_size()' is 'size()' rounded up to
+// 'N<T>()'), the elements after 'size()' (the padding lanes) are set to the 'pad' value. The full register loops can
+// then process the last register without masking and without scalar epilogue, the padding value has to be neutral
+// for the computation ('+inf' for a min search, '0' for a sum, ...). The padding lanes are not preserved by the full
+// register stores: 'fill_padding()' has to be called before reading them again.
+template <typename T, class A = allocator<T>>
+class padded_vector
+{
+private:
+	std::vector<T,A> buffer;
+	size_t           n_elmts;
+	T                pad_val;
+
+	static size_t padded(const size_t n) { return ((n + N<T>() -1) / N<T>()) * N<T>(); }
+
+public:
+	typedef T        value_type;
+	typedef T*       iterator;
+	typedef const T* const_iterator;
+
+	explicit padded_vector(const size_t n = 0)
+	: buffer(padded(n), T(0)), n_elmts(n), pad_val(T(0)) { }
+
+	padded_vector(const size_t n, const T val, const T pad = T(0))
+	: buffer(padded(n), pad), n_elmts(n), pad_val(pad) { std::fill(buffer.begin(), buffer.begin() + n, val); }
+
+	padded_vector(std::initializer_list<T> l, const T pad = T(0))
+	: buffer(padded(l.size()), pad), n_elmts(l.size()), pad_val(pad) { std::copy(l.begin(), l.end(), buffer.begin()); }
+
+	inline size_t         size        () const { return n_elmts;                  }
+	inline size_t         padded_size () const { return buffer.size();            }
+	inline size_t         capacity    () const { return buffer.capacity();        }
+	inline bool           empty       () const { return n_elmts == 0;             }
+	inline T              pad         () const { return pad_val;                  }
+	inline T*             data        ()       { return buffer.data();            }
+	inline const T*       data        () const { return buffer.data();            }
+	inline iterator       begin       ()       { return buffer.data();            }
+	inline const_iterator begin       () const { return buffer.data();            }
+	inline iterator       end         ()       { return buffer.data() + n_elmts;  }
+	inline const_iterator end         () const { return buffer.data() + n_elmts;  }
+	inline T&             operator[]  (const size_t i)       { return buffer[i];  }
+	inline const T&       operator[]  (const size_t i) const { return buffer[i];  }
+	inline T&             back        ()       { return buffer[n_elmts -1];       }
+	inline const T&       back        () const { return buffer[n_elmts -1];       }
+
+	inline void fill_padding()            { std::fill(buffer.begin() + n_elmts, buffer.end(), pad_val); }
+	inline void set_pad     (const T pad) { pad_val = pad; this->fill_padding();                       }
+	inline void reserve     (const size_t n) { buffer.reserve(padded(n));                              }
+	inline void clear       ()            { buffer.clear(); n_elmts = 0;                               }
+	inline void push_back   (const T val) { this->resize(n_elmts + 1, val);                            }
+
+	// the new elements are set to 'val' and the padding lanes are (re)set to the 'pad' value
+	void resize(const size_t n, const T val = T(0))
+	{
+		const size_t old = n_elmts;
+		buffer.resize(padded(n), pad_val);
+		n_elmts = n;
+		if (n > old)
+			std::fill(buffer.begin() + old, buffer.begin() + n, val);
+		this->fill_padding();
+	}
+};
 
 // --------------------------------------------------------------------------------------------------- memory allocator
 // --------------------------------------------------------------------------------------------------------------------
@@ -761,11 +1164,122 @@ inline regx2 deinterleave(const regx2 v)
 	return mipp::deinterleave<T>(v.val[0], v.val[1]);
 }
 
+// -------------------------------------------------------------------------------------------- partial loads and stores
+// --------------------------------------------------------------------------------------------------------------------
+// those generic implementations go through a temporary buffer, they are specialized in the implementation files when
+// the instruction set comes with masked memory operations
+
+// mask in which only the 'n' first elements are set
+template <int N>
+inline msk mask_n(const uint32_t n)
+{
+	bool m[N];
+	for (auto i = 0; i < N; i++)
+		m[i] = (uint32_t)i < n;
+	return mipp::set<N>(m);
+}
+
+// load the 'n' first elements, the other elements of the register are set to zero
+template <typename T>
+inline reg loadu_n(const T *mem_addr, const uint32_t n)
+{
+	if (n >= (uint32_t)nElReg<T>())
+		return mipp::loadu<T>(mem_addr);
+
+	T buffer[nElReg<T>()] = {};
+	for (uint32_t i = 0; i < n; i++)
+		buffer[i] = mem_addr[i];
+	return mipp::loadu<T>(buffer);
+}
+
+// store the 'n' first elements, the memory after 'mem_addr[n -1]' is not touched
+template <typename T>
+inline void storeu_n(T *mem_addr, const reg v, const uint32_t n)
+{
+	if (n >= (uint32_t)nElReg<T>())
+	{
+		mipp::storeu<T>(mem_addr, v);
+		return;
+	}
+
+	T buffer[nElReg<T>()];
+	mipp::storeu<T>(buffer, v);
+	for (uint32_t i = 0; i < n; i++)
+		mem_addr[i] = buffer[i];
+}
+
+// there is no alignment constraint on the masked memory operations
+template <typename T> inline reg  load_n (const T *mem_addr,              const uint32_t n) { return mipp::loadu_n <T>(mem_addr,    n); }
+template <typename T> inline void store_n(      T *mem_addr, const reg v, const uint32_t n) {        mipp::storeu_n<T>(mem_addr, v, n); }
+
+// ------------------------------------------------------------------------------------ non-temporal stores and prefetch
+// --------------------------------------------------------------------------------------------------------------------
+// 'stream' writes a register in memory without going through the caches (the working set is not evicted by large
+// outputs that are not read back soon), 'mem_addr' has to be aligned on the register size (even if
+// 'MIPP_ALIGNED_LOADS' is not defined). It is specialized in the implementation files when the instruction set comes
+// with non-temporal stores and it is a regular 'store' otherwise. The streamed stores are weakly ordered: 'sfence' has
+// to be called before the data are consumed by another thread.
+template <typename T>
+inline void stream(T *mem_addr, const reg v)
+{
+	mipp::store<T>(mem_addr, v);
+}
+
+inline void sfence()
+{
+#if !defined(MIPP_NO_INTRINSICS) && (defined(MIPP_SSE) || defined(MIPP_AVX) || defined(MIPP_AVX512))
+	_mm_sfence();
+#endif
+}
+
+// temporal locality hints of 'prefetch': 'T0' brings the data in all the cache levels, 'T1' and 'T2' skip the closest
+// levels and 'NTA' minimizes the cache pollution (data accessed only once)
+enum class Hint : int { NTA = 0, T2 = 1, T1 = 2, T0 = 3 };
+
+// fetches the cache line of 'ptr' for a future read, it is only a hint: it never faults and it does nothing when the
+// compiler does not expose a prefetch instruction
+template <Hint H = Hint::T0>
+inline void prefetch(const void *ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, 0, (int)H);
+#elif defined(_MSC_VER) && !defined(MIPP_NO_INTRINSICS) && (defined(MIPP_SSE) || defined(MIPP_AVX) || defined(MIPP_AVX512))
+	_mm_prefetch((const char*)ptr, H == Hint::T0 ? _MM_HINT_T0 : H == Hint::T1 ? _MM_HINT_T1 :
+	                               H == Hint::T2 ? _MM_HINT_T2 : _MM_HINT_NTA);
+#else
+	(void)ptr;
+#endif
+}
+
 // ------------------------------------------------------------------------------------------------------------ aliases
 // --------------------------------------------------------------------------------------------------------------------
 template <typename T> inline reg copysign(const reg r1, const reg r2) { return neg<T>(r1, r2); }
 template <typename T> inline reg copysign(const reg r1, const msk r2) { return neg<T>(r1, r2); }
 
+// inverse trigonometric functions (in 'mipp_math.hxx')
+template <typename T> inline reg atan (const reg r);
+template <typename T> inline reg atan2(const reg y, const reg x);
+template <typename T> inline reg asin (const reg r);
+template <typename T> inline reg acos (const reg r);
+
+// exponential and logarithmic functions (in 'mipp_math.hxx')
+template <typename T> inline reg exp2 (const reg r);
+template <typename T> inline reg expm1(const reg r);
+template <typename T> inline reg log2 (const reg r);
+template <typename T> inline reg log10(const reg r);
+template <typename T> inline reg log1p(const reg r);
+template <typename T> inline reg cbrt (const reg r);
+template <typename T> inline reg pow  (const reg x, const reg y);
+template <typename T> inline reg powi (const reg x, const int n);
+
+// activation and error functions (in 'mipp_math.hxx')
+template <typename T> inline reg tanh     (const reg r);
+template <typename T> inline reg sigmoid  (const reg r);
+template <typename T> inline reg softplus (const reg r);
+template <typename T> inline reg logaddexp(const reg a, const reg b);
+template <typename T> inline reg erf      (const reg r);
+template <typename T> inline reg erfc     (const reg r);
+
 // --------------------------------------------------------------------------------- hyperbolic trigonometric functions
 // --------------------------------------------------------------------------------------------------------------------
 template <typename T>
@@ -792,15 +1306,6 @@ inline reg cosh(const reg r)
 	return mipp::mul<T>(mipp::add<T>(mipp::exp<T>(r), mipp::exp<T>(mipp::sub<T>(zero,r))), half);
 }
 
-template <typename T>
-inline reg tanh(const reg r)
-{
-	mipp::reg zero = mipp::set0<T>();
-	auto epx = mipp::exp<T>(r);
-	auto emx = mipp::exp<T>(mipp::sub<T>(zero,r));
-	return mipp::div<T>(mipp::sub<T>(epx, emx), mipp::add<T>(epx, emx));
-}
-
 template <typename T>
 inline reg asinh(const reg r)
 {
@@ -1063,15 +1568,43 @@ inline Reg<T> maskz(const Msk<N<T>()> m, const Reg<T> a, const Reg<T> b, const R
 // --------------------------------------------------------------------------------------- myIntrinsics implementations
 // --------------------------------------------------------------------------------------------------------------------
 
-// ---------------------------------------------------------------------------------------------------------------- get
+// ------------------------------------------------------------------------------------------------------------ extract
+// returns the element 'I' (known at compile time) or 'index' (known at runtime) of a register, those generic
+// implementations go through a temporary buffer, they are specialized in the implementation files to stay in the
+// registers ('extract', 'getq_lane', 'permutevar' + 'cvtss'...)
+template <typename T, int I>
+struct _extract
+{
+	static T apply(const reg r)
+	{
+		T tmp[mipp::N<T>()];
+		mipp::storeu<T>(tmp, r);
+		return tmp[I];
+	}
+};
+
+template <typename T, int I>
+inline T extract(const reg r)
+{
+	static_assert(I >= 0 && I < mipp::N<T>(), "mipp::extract: 'I' is out of the register.");
+	return _extract<T,I>::apply(r);
+}
+
 template <typename T>
-T get(const mipp::reg r, const size_t index)
+inline T extract(const reg r, const uint32_t index)
 {
 	T tmp[mipp::N<T>()];
 	mipp::storeu<T>(tmp, r);
 	return tmp[index % mipp::N<T>()];
 }
 
+// ---------------------------------------------------------------------------------------------------------------- get
+template <typename T>
+T get(const mipp::reg r, const size_t index)
+{
+	return mipp::extract<T>(r, (uint32_t)(index % mipp::N<T>()));
+}
+
 template <typename T>
 T get(const mipp::reg_2 r, const size_t index)
 {
@@ -1094,6 +1627,428 @@ bool get(const mipp::msk m, const size_t index)
 #endif
 }
 
+// ------------------------------------------------------------------------------------------------------------ permute
+// 'permute<T, I0, I1, ...>(r)' returns the register in which the element 'i' is the element 'Ii' of 'r', the indexes
+// are known at compile time. The generic implementation is the variable shuffle ('shuff' + 'cmask'), the
+// implementation files look for the patterns that fit an instruction with an immediate ('shufps', 'vpermilps',
+// 'vpermq', 'valignd', 'palignr'...).
+
+// the 'k'-th value of a list
+constexpr int _perm_get(int) { return -1; }
+template <typename... R>
+constexpr int _perm_get(int k, int i, R... r) { return k == 0 ? i : mipp::_perm_get(k -1, r...); }
+
+// compile-time properties of the indexes 'I'
+template <int... I>
+struct _perm_idx
+{
+	static constexpr int n = (int)sizeof...(I);
+
+	static constexpr int get(int k) { return mipp::_perm_get(k, I...); }
+
+	// all the indexes are in the register
+	static constexpr bool valid(int k = 0) { return k == n || (get(k) >= 0 && get(k) < n && valid(k +1)); }
+
+	static constexpr bool identity(int k = 0) { return k == n || (get(k) == k && identity(k +1)); }
+
+	// the elements stay in their group of 'L' elements and all the groups follow the pattern of the first one
+	static constexpr bool in_lane(int L, int k = 0) {
+		return k == n || (get(k) / L == k / L && get(k) % L == get(k % L) && in_lane(L, k +1));
+	}
+
+	// the elements stay in their group of 'L' elements (each group can have its own pattern)
+	static constexpr bool in_lanes(int L, int k = 0) {
+		return k == n || (get(k) / L == k / L && in_lanes(L, k +1));
+	}
+
+	// bit 'k' set when the element 'k' comes from another group of 'L' elements
+	static constexpr int cross(int L, int k = 0) { return k == n ? 0 : ((get(k) / L != k / L) << k) | cross(L, k +1); }
+
+	// the element 'k' is the element 'k + rot' (modulo 'n'), 'rot' is in '[0, n)'
+	static constexpr int rot() { return get(0); }
+	static constexpr bool rotation(int k = 0) { return k == n || (get(k) == (k + rot()) % n && rotation(k +1)); }
+
+	// immediate made of the 'L' indexes from 'k0' (modulo 'L') on 'B' bits each
+	static constexpr int imm(int L, int B, int k0 = 0, int j = 0) {
+		return j == L ? 0 : ((get(k0 + j) % L) << (j * B)) | imm(L, B, k0, j +1);
+	}
+
+	// immediate in which the bit 'k' is set when 'get(k)' is odd (in-lane selection of the 64-bit elements)
+	static constexpr int odd_bits(int k = 0) { return k == n ? 0 : ((get(k) & 1) << k) | odd_bits(k +1); }
+};
+
+// cases selected by the specializations
+template <int C>
+using _perm_case = std::integral_constant<int,C>;
+
+// compile-time sequence '0, 1, ..., N -1' (to build the tables which are not a function of the indexes alone)
+template <int... K>
+struct _perm_seq {};
+template <int N, int... K>
+struct _perm_make_seq : _perm_make_seq<N -1, N -1, K...> {};
+template <int... K>
+struct _perm_make_seq<0, K...> { using type = _perm_seq<K...>; };
+
+template <typename T, int... I>
+inline reg _permute_shuff(const reg r)
+{
+	const uint32_t idx[mipp::N<T>()] = { (uint32_t)I... };
+	return mipp::shuff<T>(r, mipp::cmask<T>(idx));
+}
+
+template <typename T, int... I>
+struct _permute
+{
+	static reg apply(const reg r) { return mipp::_permute_shuff<T,I...>(r); }
+};
+
+template <typename T, int... I>
+inline reg permute(const reg r)
+{
+	static_assert(sizeof...(I) == (size_t)mipp::N<T>(), "mipp::permute: the number of indexes has to be 'N<T>()'.");
+	static_assert(_perm_idx<I...>::valid(), "mipp::permute: an index is out of the register.");
+	return _perm_idx<I...>::identity() ? r : _permute<T,I...>::apply(r);
+}
+
+// ------------------------------------------------------------------------------------------------------ mask to bits
+// 'to_bits' packs a mask in an integer (the bit 'i' is the element 'i'), it is specialized in the implementation files
+// ('kmov' on AVX-512, 'movemask' on SSE/AVX, pairwise additions on NEON), the other mask utilities are built on top.
+// The masks of more than 64 elements (8-bit elements of the 1024-bit emulated registers) do not fit in the integer:
+// 'to_bits' is undefined for them and the emulated backend specializes the other utilities.
+
+template <int N>
+inline uint64_t to_bits(const msk)
+{
+	errorMessage<N>("to_bits");
+	exit(-1);
+}
+
+inline uint32_t _popcnt64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint32_t)__builtin_popcountll(x);
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// 'x' has to be different from zero
+inline uint32_t _ctz64(const uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint32_t)__builtin_ctzll(x);
+#else
+	return mipp::_popcnt64((x & (~x + 1)) - 1);
+#endif
+}
+
+// 'x' has to be different from zero
+inline uint32_t _clz64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint32_t)__builtin_clzll(x);
+#else
+	x |= x >> 1; x |= x >> 2; x |= x >> 4; x |= x >> 8; x |= x >> 16; x |= x >> 32;
+	return 64 - mipp::_popcnt64(x);
+#endif
+}
+
+// number of elements set in the mask
+template <int N>
+inline uint32_t popcnt(const msk m)
+{
+	return mipp::_popcnt64(mipp::to_bits<N>(m));
+}
+
+// position of the first element set (counting from the element 0), 'N' if there is none
+template <int N>
+inline uint32_t ctz(const msk m)
+{
+	const auto bits = mipp::to_bits<N>(m);
+	return bits ? mipp::_ctz64(bits) : (uint32_t)N;
+}
+
+// number of elements unset after the last element set (counting from the element 'N -1'), 'N' if there is none
+template <int N>
+inline uint32_t clz(const msk m)
+{
+	const auto bits = mipp::to_bits<N>(m);
+	return bits ? mipp::_clz64(bits) - (64 - N) : (uint32_t)N;
+}
+
+template <int N>
+inline bool any(const msk m)
+{
+	return mipp::to_bits<N>(m) != 0;
+}
+
+template <int N>
+inline bool all(const msk m)
+{
+	return mipp::to_bits<N>(m) == (~(uint64_t)0 >> (64 - N));
+}
+
+// ------------------------------------------------------------------------------------------------- compress / expand
+// 'compress' moves the elements selected by the mask at the beginning of the register (left-packing) and 'expand'
+// does the opposite, the other elements are set to zero. Those generic implementations go through a temporary buffer,
+// they are specialized in the implementation files ('vcompress'/'vexpand' on AVX-512, shuffles driven by the following
+// tables on SSE, AVX2 and NEON).
+
+// '_compress_lut()[m]': positions of the elements set in the 8-bit mask 'm' (one per byte, in order), the unused bytes
+// are 0xFF (out of range indexes are writing zeros with 'pshufb' and 'vtbl')
+inline const uint64_t* _compress_lut()
+{
+	static const uint64_t lut[256] = {
+		0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFF01ULL, 0xFFFFFFFFFFFF0100ULL,
+		0xFFFFFFFFFFFFFF02ULL, 0xFFFFFFFFFFFF0200ULL, 0xFFFFFFFFFFFF0201ULL, 0xFFFFFFFFFF020100ULL,
+		0xFFFFFFFFFFFFFF03ULL, 0xFFFFFFFFFFFF0300ULL, 0xFFFFFFFFFFFF0301ULL, 0xFFFFFFFFFF030100ULL,
+		0xFFFFFFFFFFFF0302ULL, 0xFFFFFFFFFF030200ULL, 0xFFFFFFFFFF030201ULL, 0xFFFFFFFF03020100ULL,
+		0xFFFFFFFFFFFFFF04ULL, 0xFFFFFFFFFFFF0400ULL, 0xFFFFFFFFFFFF0401ULL, 0xFFFFFFFFFF040100ULL,
+		0xFFFFFFFFFFFF0402ULL, 0xFFFFFFFFFF040200ULL, 0xFFFFFFFFFF040201ULL, 0xFFFFFFFF04020100ULL,
+		0xFFFFFFFFFFFF0403ULL, 0xFFFFFFFFFF040300ULL, 0xFFFFFFFFFF040301ULL, 0xFFFFFFFF04030100ULL,
+		0xFFFFFFFFFF040302ULL, 0xFFFFFFFF04030200ULL, 0xFFFFFFFF04030201ULL, 0xFFFFFF0403020100ULL,
+		0xFFFFFFFFFFFFFF05ULL, 0xFFFFFFFFFFFF0500ULL, 0xFFFFFFFFFFFF0501ULL, 0xFFFFFFFFFF050100ULL,
+		0xFFFFFFFFFFFF0502ULL, 0xFFFFFFFFFF050200ULL, 0xFFFFFFFFFF050201ULL, 0xFFFFFFFF05020100ULL,
+		0xFFFFFFFFFFFF0503ULL, 0xFFFFFFFFFF050300ULL, 0xFFFFFFFFFF050301ULL, 0xFFFFFFFF05030100ULL,
+		0xFFFFFFFFFF050302ULL, 0xFFFFFFFF05030200ULL, 0xFFFFFFFF05030201ULL, 0xFFFFFF0503020100ULL,
+		0xFFFFFFFFFFFF0504ULL, 0xFFFFFFFFFF050400ULL, 0xFFFFFFFFFF050401ULL, 0xFFFFFFFF05040100ULL,
+		0xFFFFFFFFFF050402ULL, 0xFFFFFFFF05040200ULL, 0xFFFFFFFF05040201ULL, 0xFFFFFF0504020100ULL,
+		0xFFFFFFFFFF050403ULL, 0xFFFFFFFF05040300ULL, 0xFFFFFFFF05040301ULL, 0xFFFFFF0504030100ULL,
+		0xFFFFFFFF05040302ULL, 0xFFFFFF0504030200ULL, 0xFFFFFF0504030201ULL, 0xFFFF050403020100ULL,
+		0xFFFFFFFFFFFFFF06ULL, 0xFFFFFFFFFFFF0600ULL, 0xFFFFFFFFFFFF0601ULL, 0xFFFFFFFFFF060100ULL,
+		0xFFFFFFFFFFFF0602ULL, 0xFFFFFFFFFF060200ULL, 0xFFFFFFFFFF060201ULL, 0xFFFFFFFF06020100ULL,
+		0xFFFFFFFFFFFF0603ULL, 0xFFFFFFFFFF060300ULL, 0xFFFFFFFFFF060301ULL, 0xFFFFFFFF06030100ULL,
+		0xFFFFFFFFFF060302ULL, 0xFFFFFFFF06030200ULL, 0xFFFFFFFF06030201ULL, 0xFFFFFF0603020100ULL,
+		0xFFFFFFFFFFFF0604ULL, 0xFFFFFFFFFF060400ULL, 0xFFFFFFFFFF060401ULL, 0xFFFFFFFF06040100ULL,
+		0xFFFFFFFFFF060402ULL, 0xFFFFFFFF06040200ULL, 0xFFFFFFFF06040201ULL, 0xFFFFFF0604020100ULL,
+		0xFFFFFFFFFF060403ULL, 0xFFFFFFFF06040300ULL, 0xFFFFFFFF06040301ULL, 0xFFFFFF0604030100ULL,
+		0xFFFFFFFF06040302ULL, 0xFFFFFF0604030200ULL, 0xFFFFFF0604030201ULL, 0xFFFF060403020100ULL,
+		0xFFFFFFFFFFFF0605ULL, 0xFFFFFFFFFF060500ULL, 0xFFFFFFFFFF060501ULL, 0xFFFFFFFF06050100ULL,
+		0xFFFFFFFFFF060502ULL, 0xFFFFFFFF06050200ULL, 0xFFFFFFFF06050201ULL, 0xFFFFFF0605020100ULL,
+		0xFFFFFFFFFF060503ULL, 0xFFFFFFFF06050300ULL, 0xFFFFFFFF06050301ULL, 0xFFFFFF0605030100ULL,
+		0xFFFFFFFF06050302ULL, 0xFFFFFF0605030200ULL, 0xFFFFFF0605030201ULL, 0xFFFF060503020100ULL,
+		0xFFFFFFFFFF060504ULL, 0xFFFFFFFF06050400ULL, 0xFFFFFFFF06050401ULL, 0xFFFFFF0605040100ULL,
+		0xFFFFFFFF06050402ULL, 0xFFFFFF0605040200ULL, 0xFFFFFF0605040201ULL, 0xFFFF060504020100ULL,
+		0xFFFFFFFF06050403ULL, 0xFFFFFF0605040300ULL, 0xFFFFFF0605040301ULL, 0xFFFF060504030100ULL,
+		0xFFFFFF0605040302ULL, 0xFFFF060504030200ULL, 0xFFFF060504030201ULL, 0xFF06050403020100ULL,
+		0xFFFFFFFFFFFFFF07ULL, 0xFFFFFFFFFFFF0700ULL, 0xFFFFFFFFFFFF0701ULL, 0xFFFFFFFFFF070100ULL,
+		0xFFFFFFFFFFFF0702ULL, 0xFFFFFFFFFF070200ULL, 0xFFFFFFFFFF070201ULL, 0xFFFFFFFF07020100ULL,
+		0xFFFFFFFFFFFF0703ULL, 0xFFFFFFFFFF070300ULL, 0xFFFFFFFFFF070301ULL, 0xFFFFFFFF07030100ULL,
+		0xFFFFFFFFFF070302ULL, 0xFFFFFFFF07030200ULL, 0xFFFFFFFF07030201ULL, 0xFFFFFF0703020100ULL,
+		0xFFFFFFFFFFFF0704ULL, 0xFFFFFFFFFF070400ULL, 0xFFFFFFFFFF070401ULL, 0xFFFFFFFF07040100ULL,
+		0xFFFFFFFFFF070402ULL, 0xFFFFFFFF07040200ULL, 0xFFFFFFFF07040201ULL, 0xFFFFFF0704020100ULL,
+		0xFFFFFFFFFF070403ULL, 0xFFFFFFFF07040300ULL, 0xFFFFFFFF07040301ULL, 0xFFFFFF0704030100ULL,
+		0xFFFFFFFF07040302ULL, 0xFFFFFF0704030200ULL, 0xFFFFFF0704030201ULL, 0xFFFF070403020100ULL,
+		0xFFFFFFFFFFFF0705ULL, 0xFFFFFFFFFF070500ULL, 0xFFFFFFFFFF070501ULL, 0xFFFFFFFF07050100ULL,
+		0xFFFFFFFFFF070502ULL, 0xFFFFFFFF07050200ULL, 0xFFFFFFFF07050201ULL, 0xFFFFFF0705020100ULL,
+		0xFFFFFFFFFF070503ULL, 0xFFFFFFFF07050300ULL, 0xFFFFFFFF07050301ULL, 0xFFFFFF0705030100ULL,
+		0xFFFFFFFF07050302ULL, 0xFFFFFF0705030200ULL, 0xFFFFFF0705030201ULL, 0xFFFF070503020100ULL,
+		0xFFFFFFFFFF070504ULL, 0xFFFFFFFF07050400ULL, 0xFFFFFFFF07050401ULL, 0xFFFFFF0705040100ULL,
+		0xFFFFFFFF07050402ULL, 0xFFFFFF0705040200ULL, 0xFFFFFF0705040201ULL, 0xFFFF070504020100ULL,
+		0xFFFFFFFF07050403ULL, 0xFFFFFF0705040300ULL, 0xFFFFFF0705040301ULL, 0xFFFF070504030100ULL,
+		0xFFFFFF0705040302ULL, 0xFFFF070504030200ULL, 0xFFFF070504030201ULL, 0xFF07050403020100ULL,
+		0xFFFFFFFFFFFF0706ULL, 0xFFFFFFFFFF070600ULL, 0xFFFFFFFFFF070601ULL, 0xFFFFFFFF07060100ULL,
+		0xFFFFFFFFFF070602ULL, 0xFFFFFFFF07060200ULL, 0xFFFFFFFF07060201ULL, 0xFFFFFF0706020100ULL,
+		0xFFFFFFFFFF070603ULL, 0xFFFFFFFF07060300ULL, 0xFFFFFFFF07060301ULL, 0xFFFFFF0706030100ULL,
+		0xFFFFFFFF07060302ULL, 0xFFFFFF0706030200ULL, 0xFFFFFF0706030201ULL, 0xFFFF070603020100ULL,
+		0xFFFFFFFFFF070604ULL, 0xFFFFFFFF07060400ULL, 0xFFFFFFFF07060401ULL, 0xFFFFFF0706040100ULL,
+		0xFFFFFFFF07060402ULL, 0xFFFFFF0706040200ULL, 0xFFFFFF0706040201ULL, 0xFFFF070604020100ULL,
+		0xFFFFFFFF07060403ULL, 0xFFFFFF0706040300ULL, 0xFFFFFF0706040301ULL, 0xFFFF070604030100ULL,
+		0xFFFFFF0706040302ULL, 0xFFFF070604030200ULL, 0xFFFF070604030201ULL, 0xFF07060403020100ULL,
+		0xFFFFFFFFFF070605ULL, 0xFFFFFFFF07060500ULL, 0xFFFFFFFF07060501ULL, 0xFFFFFF0706050100ULL,
+		0xFFFFFFFF07060502ULL, 0xFFFFFF0706050200ULL, 0xFFFFFF0706050201ULL, 0xFFFF070605020100ULL,
+		0xFFFFFFFF07060503ULL, 0xFFFFFF0706050300ULL, 0xFFFFFF0706050301ULL, 0xFFFF070605030100ULL,
+		0xFFFFFF0706050302ULL, 0xFFFF070605030200ULL, 0xFFFF070605030201ULL, 0xFF07060503020100ULL,
+		0xFFFFFFFF07060504ULL, 0xFFFFFF0706050400ULL, 0xFFFFFF0706050401ULL, 0xFFFF070605040100ULL,
+		0xFFFFFF0706050402ULL, 0xFFFF070605040200ULL, 0xFFFF070605040201ULL, 0xFF07060504020100ULL,
+		0xFFFFFF0706050403ULL, 0xFFFF070605040300ULL, 0xFFFF070605040301ULL, 0xFF07060504030100ULL,
+		0xFFFF070605040302ULL, 0xFF07060504030200ULL, 0xFF07060504030201ULL, 0x0706050403020100ULL
+	};
+	return lut;
+}
+
+// '_expand_lut()[m]': for each element set in the 8-bit mask 'm', the position of the source element (its rank in the
+// mask), 0xFF for the elements unset
+inline const uint64_t* _expand_lut()
+{
+	static const uint64_t lut[256] = {
+		0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFF00FFULL, 0xFFFFFFFFFFFF0100ULL,
+		0xFFFFFFFFFF00FFFFULL, 0xFFFFFFFFFF01FF00ULL, 0xFFFFFFFFFF0100FFULL, 0xFFFFFFFFFF020100ULL,
+		0xFFFFFFFF00FFFFFFULL, 0xFFFFFFFF01FFFF00ULL, 0xFFFFFFFF01FF00FFULL, 0xFFFFFFFF02FF0100ULL,
+		0xFFFFFFFF0100FFFFULL, 0xFFFFFFFF0201FF00ULL, 0xFFFFFFFF020100FFULL, 0xFFFFFFFF03020100ULL,
+		0xFFFFFF00FFFFFFFFULL, 0xFFFFFF01FFFFFF00ULL, 0xFFFFFF01FFFF00FFULL, 0xFFFFFF02FFFF0100ULL,
+		0xFFFFFF01FF00FFFFULL, 0xFFFFFF02FF01FF00ULL, 0xFFFFFF02FF0100FFULL, 0xFFFFFF03FF020100ULL,
+		0xFFFFFF0100FFFFFFULL, 0xFFFFFF0201FFFF00ULL, 0xFFFFFF0201FF00FFULL, 0xFFFFFF0302FF0100ULL,
+		0xFFFFFF020100FFFFULL, 0xFFFFFF030201FF00ULL, 0xFFFFFF03020100FFULL, 0xFFFFFF0403020100ULL,
+		0xFFFF00FFFFFFFFFFULL, 0xFFFF01FFFFFFFF00ULL, 0xFFFF01FFFFFF00FFULL, 0xFFFF02FFFFFF0100ULL,
+		0xFFFF01FFFF00FFFFULL, 0xFFFF02FFFF01FF00ULL, 0xFFFF02FFFF0100FFULL, 0xFFFF03FFFF020100ULL,
+		0xFFFF01FF00FFFFFFULL, 0xFFFF02FF01FFFF00ULL, 0xFFFF02FF01FF00FFULL, 0xFFFF03FF02FF0100ULL,
+		0xFFFF02FF0100FFFFULL, 0xFFFF03FF0201FF00ULL, 0xFFFF03FF020100FFULL, 0xFFFF04FF03020100ULL,
+		0xFFFF0100FFFFFFFFULL, 0xFFFF0201FFFFFF00ULL, 0xFFFF0201FFFF00FFULL, 0xFFFF0302FFFF0100ULL,
+		0xFFFF0201FF00FFFFULL, 0xFFFF0302FF01FF00ULL, 0xFFFF0302FF0100FFULL, 0xFFFF0403FF020100ULL,
+		0xFFFF020100FFFFFFULL, 0xFFFF030201FFFF00ULL, 0xFFFF030201FF00FFULL, 0xFFFF040302FF0100ULL,
+		0xFFFF03020100FFFFULL, 0xFFFF04030201FF00ULL, 0xFFFF0403020100FFULL, 0xFFFF050403020100ULL,
+		0xFF00FFFFFFFFFFFFULL, 0xFF01FFFFFFFFFF00ULL, 0xFF01FFFFFFFF00FFULL, 0xFF02FFFFFFFF0100ULL,
+		0xFF01FFFFFF00FFFFULL, 0xFF02FFFFFF01FF00ULL, 0xFF02FFFFFF0100FFULL, 0xFF03FFFFFF020100ULL,
+		0xFF01FFFF00FFFFFFULL, 0xFF02FFFF01FFFF00ULL, 0xFF02FFFF01FF00FFULL, 0xFF03FFFF02FF0100ULL,
+		0xFF02FFFF0100FFFFULL, 0xFF03FFFF0201FF00ULL, 0xFF03FFFF020100FFULL, 0xFF04FFFF03020100ULL,
+		0xFF01FF00FFFFFFFFULL, 0xFF02FF01FFFFFF00ULL, 0xFF02FF01FFFF00FFULL, 0xFF03FF02FFFF0100ULL,
+		0xFF02FF01FF00FFFFULL, 0xFF03FF02FF01FF00ULL, 0xFF03FF02FF0100FFULL, 0xFF04FF03FF020100ULL,
+		0xFF02FF0100FFFFFFULL, 0xFF03FF0201FFFF00ULL, 0xFF03FF0201FF00FFULL, 0xFF04FF0302FF0100ULL,
+		0xFF03FF020100FFFFULL, 0xFF04FF030201FF00ULL, 0xFF04FF03020100FFULL, 0xFF05FF0403020100ULL,
+		0xFF0100FFFFFFFFFFULL, 0xFF0201FFFFFFFF00ULL, 0xFF0201FFFFFF00FFULL, 0xFF0302FFFFFF0100ULL,
+		0xFF0201FFFF00FFFFULL, 0xFF0302FFFF01FF00ULL, 0xFF0302FFFF0100FFULL, 0xFF0403FFFF020100ULL,
+		0xFF0201FF00FFFFFFULL, 0xFF0302FF01FFFF00ULL, 0xFF0302FF01FF00FFULL, 0xFF0403FF02FF0100ULL,
+		0xFF0302FF0100FFFFULL, 0xFF0403FF0201FF00ULL, 0xFF0403FF020100FFULL, 0xFF0504FF03020100ULL,
+		0xFF020100FFFFFFFFULL, 0xFF030201FFFFFF00ULL, 0xFF030201FFFF00FFULL, 0xFF040302FFFF0100ULL,
+		0xFF030201FF00FFFFULL, 0xFF040302FF01FF00ULL, 0xFF040302FF0100FFULL, 0xFF050403FF020100ULL,
+		0xFF03020100FFFFFFULL, 0xFF04030201FFFF00ULL, 0xFF04030201FF00FFULL, 0xFF05040302FF0100ULL,
+		0xFF0403020100FFFFULL, 0xFF0504030201FF00ULL, 0xFF050403020100FFULL, 0xFF06050403020100ULL,
+		0x00FFFFFFFFFFFFFFULL, 0x01FFFFFFFFFFFF00ULL, 0x01FFFFFFFFFF00FFULL, 0x02FFFFFFFFFF0100ULL,
+		0x01FFFFFFFF00FFFFULL, 0x02FFFFFFFF01FF00ULL, 0x02FFFFFFFF0100FFULL, 0x03FFFFFFFF020100ULL,
+		0x01FFFFFF00FFFFFFULL, 0x02FFFFFF01FFFF00ULL, 0x02FFFFFF01FF00FFULL, 0x03FFFFFF02FF0100ULL,
+		0x02FFFFFF0100FFFFULL, 0x03FFFFFF0201FF00ULL, 0x03FFFFFF020100FFULL, 0x04FFFFFF03020100ULL,
+		0x01FFFF00FFFFFFFFULL, 0x02FFFF01FFFFFF00ULL, 0x02FFFF01FFFF00FFULL, 0x03FFFF02FFFF0100ULL,
+		0x02FFFF01FF00FFFFULL, 0x03FFFF02FF01FF00ULL, 0x03FFFF02FF0100FFULL, 0x04FFFF03FF020100ULL,
+		0x02FFFF0100FFFFFFULL, 0x03FFFF0201FFFF00ULL, 0x03FFFF0201FF00FFULL, 0x04FFFF0302FF0100ULL,
+		0x03FFFF020100FFFFULL, 0x04FFFF030201FF00ULL, 0x04FFFF03020100FFULL, 0x05FFFF0403020100ULL,
+		0x01FF00FFFFFFFFFFULL, 0x02FF01FFFFFFFF00ULL, 0x02FF01FFFFFF00FFULL, 0x03FF02FFFFFF0100ULL,
+		0x02FF01FFFF00FFFFULL, 0x03FF02FFFF01FF00ULL, 0x03FF02FFFF0100FFULL, 0x04FF03FFFF020100ULL,
+		0x02FF01FF00FFFFFFULL, 0x03FF02FF01FFFF00ULL, 0x03FF02FF01FF00FFULL, 0x04FF03FF02FF0100ULL,
+		0x03FF02FF0100FFFFULL, 0x04FF03FF0201FF00ULL, 0x04FF03FF020100FFULL, 0x05FF04FF03020100ULL,
+		0x02FF0100FFFFFFFFULL, 0x03FF0201FFFFFF00ULL, 0x03FF0201FFFF00FFULL, 0x04FF0302FFFF0100ULL,
+		0x03FF0201FF00FFFFULL, 0x04FF0302FF01FF00ULL, 0x04FF0302FF0100FFULL, 0x05FF0403FF020100ULL,
+		0x03FF020100FFFFFFULL, 0x04FF030201FFFF00ULL, 0x04FF030201FF00FFULL, 0x05FF040302FF0100ULL,
+		0x04FF03020100FFFFULL, 0x05FF04030201FF00ULL, 0x05FF0403020100FFULL, 0x06FF050403020100ULL,
+		0x0100FFFFFFFFFFFFULL, 0x0201FFFFFFFFFF00ULL, 0x0201FFFFFFFF00FFULL, 0x0302FFFFFFFF0100ULL,
+		0x0201FFFFFF00FFFFULL, 0x0302FFFFFF01FF00ULL, 0x0302FFFFFF0100FFULL, 0x0403FFFFFF020100ULL,
+		0x0201FFFF00FFFFFFULL, 0x0302FFFF01FFFF00ULL, 0x0302FFFF01FF00FFULL, 0x0403FFFF02FF0100ULL,
+		0x0302FFFF0100FFFFULL, 0x0403FFFF0201FF00ULL, 0x0403FFFF020100FFULL, 0x0504FFFF03020100ULL,
+		0x0201FF00FFFFFFFFULL, 0x0302FF01FFFFFF00ULL, 0x0302FF01FFFF00FFULL, 0x0403FF02FFFF0100ULL,
+		0x0302FF01FF00FFFFULL, 0x0403FF02FF01FF00ULL, 0x0403FF02FF0100FFULL, 0x0504FF03FF020100ULL,
+		0x0302FF0100FFFFFFULL, 0x0403FF0201FFFF00ULL, 0x0403FF0201FF00FFULL, 0x0504FF0302FF0100ULL,
+		0x0403FF020100FFFFULL, 0x0504FF030201FF00ULL, 0x0504FF03020100FFULL, 0x0605FF0403020100ULL,
+		0x020100FFFFFFFFFFULL, 0x030201FFFFFFFF00ULL, 0x030201FFFFFF00FFULL, 0x040302FFFFFF0100ULL,
+		0x030201FFFF00FFFFULL, 0x040302FFFF01FF00ULL, 0x040302FFFF0100FFULL, 0x050403FFFF020100ULL,
+		0x030201FF00FFFFFFULL, 0x040302FF01FFFF00ULL, 0x040302FF01FF00FFULL, 0x050403FF02FF0100ULL,
+		0x040302FF0100FFFFULL, 0x050403FF0201FF00ULL, 0x050403FF020100FFULL, 0x060504FF03020100ULL,
+		0x03020100FFFFFFFFULL, 0x04030201FFFFFF00ULL, 0x04030201FFFF00FFULL, 0x05040302FFFF0100ULL,
+		0x04030201FF00FFFFULL, 0x05040302FF01FF00ULL, 0x05040302FF0100FFULL, 0x06050403FF020100ULL,
+		0x0403020100FFFFFFULL, 0x0504030201FFFF00ULL, 0x0504030201FF00FFULL, 0x0605040302FF0100ULL,
+		0x050403020100FFFFULL, 0x060504030201FF00ULL, 0x06050403020100FFULL, 0x0706050403020100ULL
+	};
+	return lut;
+}
+
+// duplicates each bit of the 4 first bits of 'b' ('b0 b1 b2 b3' -> 'b0 b0 b1 b1 b2 b2 b3 b3'), the 64-bit elements are
+// compressed as pairs of 32-bit elements
+inline uint32_t _dup_bits4(uint32_t b)
+{
+	b = (b | (b << 2)) & 0x33;
+	b = (b | (b << 1)) & 0x55;
+	return b | (b << 1);
+}
+
+template <typename T>
+inline reg compress(const reg v, const msk m)
+{
+	constexpr int N = nElReg<T>();
+	const auto bits = mipp::to_bits<N>(m);
+
+	T in[N], out[N] = {};
+	mipp::storeu<T>(in, v);
+	for (auto i = 0, j = 0; i < N; i++)
+		if ((bits >> i) & 1)
+			out[j++] = in[i];
+	return mipp::loadu<T>(out);
+}
+
+template <typename T>
+inline reg expand(const reg v, const msk m)
+{
+	constexpr int N = nElReg<T>();
+	const auto bits = mipp::to_bits<N>(m);
+
+	T in[N], out[N] = {};
+	mipp::storeu<T>(in, v);
+	for (auto i = 0, j = 0; i < N; i++)
+		if ((bits >> i) & 1)
+			out[i] = in[j++];
+	return mipp::loadu<T>(out);
+}
+
+// stores the elements selected by the mask contiguously in 'mem_addr' and returns their number, the memory after the
+// last stored element is not touched
+template <typename T>
+inline uint32_t compress_store(T *mem_addr, const reg v, const msk m)
+{
+	const auto n = mipp::popcnt<nElReg<T>()>(m);
+	mipp::storeu_n<T>(mem_addr, mipp::compress<T>(v, m), n);
+	return n;
+}
+
+// ---------------------------------------------------------------------------------------------------- gather / scatter
+// emulated gather and scatter (through temporary buffers), they are specialized in the implementation files when the
+// instruction set comes with native gather/scatter instructions. The indexes are given in a 'TI' register with the
+// same number of elements than the 'T' register ('sizeof(TI) == sizeof(T)').
+
+template <typename T, typename TI>
+inline reg gather(const T *mem_addr, const reg idx)
+{
+	static_assert(sizeof(T) == sizeof(TI), "mipp::gather: 'T' and 'TI' have to be the same size.");
+	TI indexes[mipp::N<TI>()];
+	T  values [mipp::N<T >()];
+	mipp::storeu<TI>(indexes, idx);
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		values[i] = mem_addr[indexes[i]];
+	return mipp::loadu<T>(values);
+}
+
+// elements for which the 'm' mask is false are taken from 'src' (and the memory is not accessed)
+template <typename T, typename TI>
+inline reg gather(const msk m, const reg src, const T *mem_addr, const reg idx)
+{
+	static_assert(sizeof(T) == sizeof(TI), "mipp::gather: 'T' and 'TI' have to be the same size.");
+	TI indexes[mipp::N<TI>()];
+	T  values [mipp::N<T >()];
+	mipp::storeu<TI>(indexes, idx);
+	mipp::storeu<T >(values,  src);
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		if (mipp::get<mipp::N<T>()>(m, i))
+			values[i] = mem_addr[indexes[i]];
+	return mipp::loadu<T>(values);
+}
+
+// if several indexes are equal, the element with the highest position in the register is the last written
+template <typename T, typename TI>
+inline void scatter(T *mem_addr, const reg idx, const reg r)
+{
+	static_assert(sizeof(T) == sizeof(TI), "mipp::scatter: 'T' and 'TI' have to be the same size.");
+	TI indexes[mipp::N<TI>()];
+	T  values [mipp::N<T >()];
+	mipp::storeu<TI>(indexes, idx);
+	mipp::storeu<T >(values,  r);
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		mem_addr[indexes[i]] = values[i];
+}
+
+// only the elements for which the 'm' mask is true are written
+template <typename T, typename TI>
+inline void scatter(const msk m, T *mem_addr, const reg idx, const reg r)
+{
+	static_assert(sizeof(T) == sizeof(TI), "mipp::scatter: 'T' and 'TI' have to be the same size.");
+	TI indexes[mipp::N<TI>()];
+	T  values [mipp::N<T >()];
+	mipp::storeu<TI>(indexes, idx);
+	mipp::storeu<T >(values,  r);
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		if (mipp::get<mipp::N<T>()>(m, i))
+			mem_addr[indexes[i]] = values[i];
+}
+
 // --------------------------------------------------------------------------------------------------------------- dump
 
 template <typename T>
@@ -1217,6 +2172,12 @@ void dump(const mipp::msk m, std::ostream &stream = std::cout, const uint32_t el
 
 // ---------------------------------------------------------------------------------------------------------- reduction
 
+// default number of independent accumulators used by the 'reduction<T,OP>::apply' and 'Reduction<T,OP>::apply' array
+// versions
+#ifndef MIPP_REDUCTION_ACCUMULATORS
+#define MIPP_REDUCTION_ACCUMULATORS 4
+#endif
+
 template <typename T>
 using red_op = reg (*)(const reg, const reg);
 
@@ -1248,6 +2209,21 @@ struct _Reduction
 	}
 };
 
+// calls 'f(0)', 'f(1)', ..., 'f(K -1)', the compiler sees constant indexes and can keep the accumulators in registers
+template <int K>
+struct _unroll
+{
+	template <typename F>
+	static inline void apply(F &&f) { _unroll<K -1>::apply(f); f(K -1); }
+};
+
+template <>
+struct _unroll<0>
+{
+	template <typename F>
+	static inline void apply(F &&) {}
+};
+
 template <typename T, red_op<T> OP>
 struct reduction
 {
@@ -1258,13 +2234,7 @@ struct reduction
 
 	static T sapply(const reg r)
 	{
-		auto red = reduction<T,OP>::apply(r);
-#ifdef _MSC_VER
-		return *((T*)&red);
-#else
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-		return *((T*)&red);
-#endif
+		return mipp::extract<T,0>(reduction<T,OP>::apply(r));
 	}
 
 	template <ld_op<T> LD = mipp::load<T>>
@@ -1279,21 +2249,51 @@ struct reduction
 		return reduction<T,OP>::template apply<LD>(data.data(), data.size());
 	}
 
-	template <ld_op<T> LD = mipp::loadu<T>>
-	static T apply(const T *data, const uint32_t dataSize)
+	// 'K' independent accumulators are used in the main loop to hide the latency of 'OP', the last
+	// 'dataSize % nElReg<T>()' elements are merged in the first lanes of the result with a masked 'OP'
+	template <ld_op<T> LD = mipp::loadu<T>, int K = MIPP_REDUCTION_ACCUMULATORS>
+	static T apply(const T *data, const size_t dataSize)
 	{
+		static_assert(K > 0, "The number of accumulators 'K' has to be greater than 0.");
 		assert(dataSize > 0);
-		assert(dataSize % mipp::nElReg<T>() == 0);
+
+		constexpr size_t N = (size_t)mipp::nElReg<T>();
+		const size_t vecSize = (dataSize / N) * N;
+
+		// not even one full register: there is no neutral element for 'OP', the elements are broadcasted instead
+		if (vecSize == 0)
+		{
+			auto rRed = mipp::set1<T>(data[0]);
+			for (size_t i = 1; i < dataSize; i++)
+				rRed = OP(rRed, mipp::set1<T>(data[i]));
+			return mipp::extract<T,0>(rRed);
+		}
 
 		auto rRed = LD(&data[0]);
-		for (auto i = mipp::nElReg<T>(); i < dataSize; i += mipp::nElReg<T>())
-			rRed = OP(rRed, LD(&data[i]));
-		rRed = reduction<T,OP>::apply(rRed);
+		size_t i = N;
+		if (vecSize >= K * N)
+		{
+			reg rAcc[K];
+			_unroll<K>::apply([&](const int k) { rAcc[k] = LD(&data[k * N]); });
 
-		T tRed[mipp::nElReg<T>()];
-		mipp::store<T>(tRed, rRed);
+			for (i = K * N; i + K * N <= vecSize; i += K * N)
+				_unroll<K>::apply([&](const int k) { rAcc[k] = OP(rAcc[k], LD(&data[i + k * N])); });
 
-		return tRed[0];
+			for (auto s = 1; s < K; s *= 2)
+				for (auto k = 0; k + s < K; k += 2 * s)
+					rAcc[k] = OP(rAcc[k], rAcc[k + s]);
+			rRed = rAcc[0];
+		}
+		for (; i < vecSize; i += N)
+			rRed = OP(rRed, LD(&data[i]));
+
+		if (vecSize < dataSize)
+		{
+			const uint32_t n = (uint32_t)(dataSize - vecSize);
+			auto rTail = mipp::loadu_n<T>(&data[vecSize], n);
+			rRed = mipp::mask<T,OP>(mipp::mask_n<mipp::N<T>()>(n), rRed, rRed, rTail);
+		}
+		return mipp::extract<T,0>(reduction<T,OP>::apply(rRed));
 	}
 };
 
@@ -1307,8 +2307,11 @@ struct Reduction
 
 	static T sapply(const Reg<T> r)
 	{
-		auto red = Reduction<T,OP>::apply(r);
-		return red[0];
+#ifndef MIPP_NO_INTRINSICS
+		return mipp::extract<T,0>(Reduction<T,OP>::apply(r).r);
+#else
+		return Reduction<T,OP>::apply(r).r;
+#endif
 	}
 
 	template <ld_op<T> LD = mipp::load<T>>
@@ -1323,29 +2326,63 @@ struct Reduction
 		return Reduction<T,OP>::template apply<LD>(data.data(), data.size());
 	}
 
-	template <ld_op<T> LD = mipp::loadu<T>>
-	static T apply(const T *data, const uint32_t dataSize)
+	// same algorithm as 'reduction<T,OP>::apply'
+	template <ld_op<T> LD = mipp::loadu<T>, int K = MIPP_REDUCTION_ACCUMULATORS>
+	static T apply(const T *data, const size_t dataSize)
 	{
+		static_assert(K > 0, "The number of accumulators 'K' has to be greater than 0.");
 		assert(dataSize > 0);
-		assert(dataSize % mipp::nElReg<T>() == 0);
+
+		constexpr size_t N = (size_t)mipp::nElReg<T>();
+		const size_t vecSize = (dataSize / N) * N;
+
+		if (vecSize == 0)
+		{
+			auto rRed = Reg<T>(data[0]);
+			for (size_t i = 1; i < dataSize; i++)
+				rRed = OP(rRed, Reg<T>(data[i]));
+			return rRed[0];
+		}
+
+		auto rRed = Reduction<T,OP>::template _load<LD>(&data[0]);
+		size_t i = N;
+		if (vecSize >= K * N)
+		{
+			Reg<T> rAcc[K];
+			_unroll<K>::apply([&](const int k) { rAcc[k] = Reduction<T,OP>::template _load<LD>(&data[k * N]); });
+
+			for (i = K * N; i + K * N <= vecSize; i += K * N)
+				_unroll<K>::apply([&](const int k) {
+					rAcc[k] = OP(rAcc[k], Reduction<T,OP>::template _load<LD>(&data[i + k * N]));
+				});
+
+			for (auto s = 1; s < K; s *= 2)
+				for (auto k = 0; k + s < K; k += 2 * s)
+					rAcc[k] = OP(rAcc[k], rAcc[k + s]);
+			rRed = rAcc[0];
+		}
+		for (; i < vecSize; i += N)
+			rRed = OP(rRed, Reduction<T,OP>::template _load<LD>(&data[i]));
 
 #ifndef MIPP_NO_INTRINSICS
-		auto rRed = Reg<T>(LD(&data[0]));
-#else
-		auto rRed = Reg<T>(data[0]);
+		if (vecSize < dataSize)
+		{
+			const uint32_t n = (uint32_t)(dataSize - vecSize);
+			auto rTail = Reg<T>(mipp::loadu_n<T>(&data[vecSize], n));
+			rRed = mipp::mask<T,OP>(Msk<mipp::N<T>()>(mipp::mask_n<mipp::N<T>()>(n)), rRed, rRed, rTail);
+		}
 #endif
-		for (auto i = mipp::nElReg<T>(); i < dataSize; i += mipp::nElReg<T>())
+		return Reduction<T,OP>::sapply(rRed);
+	}
+
+	template <ld_op<T> LD>
+	static Reg<T> _load(const T *data)
+	{
 #ifndef MIPP_NO_INTRINSICS
-			rRed = OP(rRed, Reg<T>(LD(&data[i])));
+		return Reg<T>(LD(data));
 #else
-			rRed = OP(rRed, Reg<T>(data[i]));
+		return Reg<T>(*data);
 #endif
-		rRed = Reduction<T,OP>::apply(rRed);
-
-		T tRed[mipp::nElReg<T>()];
-		rRed.store(tRed);
-
-		return tRed[0];
 	}
 };
 
@@ -1357,13 +2394,140 @@ template <typename T> inline T hmul(const reg v) { return reduction<T,mipp::mul<
 template <typename T> inline T hmin(const reg v) { return reduction<T,mipp::min<T>>::sapply(v); }
 template <typename T> inline T hmax(const reg v) { return reduction<T,mipp::max<T>>::sapply(v); }
 
+// ------------------------------------------------------------------------------------------------- argmin and argmax
+
+// position of the first lane set in 'm', 'nElReg<T>()' if there is none (the lane positions are computed in the 'T'
+// type so the horizontal minimum of 'T' can be reused, 'uint8_t' for 'int8_t': 128 lanes do not fit in 'int8_t')
+template <typename T>
+inline uint32_t _first_lane(const msk m)
+{
+	using L = typename std::conditional<std::is_same<T,int8_t>::value, uint8_t, T>::type;
+	L lanes[nElReg<T>()];
+	for (auto i = 0; i < nElReg<T>(); i++)
+		lanes[i] = (L)i;
+	const auto idx = mipp::blend<L>(mipp::loadu<L>(lanes), mipp::set1<L>((L)nElReg<T>()), m);
+	return (uint32_t)mipp::hmin<L>(idx);
+}
+
+// the elements of 'v' equal to 'val', or its NaN elements if 'val' is NaN (a NaN is not equal to itself)
+template <typename T>
+inline msk _arg_lanes(const reg v, const T val)
+{
+	return (val != val) ? mipp::cmpneq<T>(v, v) : mipp::cmpeq<T>(v, mipp::set1<T>(val));
+}
+
+// the minimum value and the position of its first occurrence in 'v'
+template <typename T>
+inline std::pair<T,uint32_t> argmin(const reg v)
+{
+	const T val = mipp::hmin<T>(v);
+	return std::make_pair(val, mipp::_first_lane<T>(mipp::_arg_lanes<T>(v, val)));
+}
+
+// the maximum value and the position of its first occurrence in 'v'
+template <typename T>
+inline std::pair<T,uint32_t> argmax(const reg v)
+{
+	const T val = mipp::hmax<T>(v);
+	return std::make_pair(val, mipp::_first_lane<T>(mipp::_arg_lanes<T>(v, val)));
+}
+
+// --------------------------------------------------------------------------------------------------------------- scan
+
+// 'v' shifted by 'S' elements toward the last element (the 'S' first elements are undefined), used by the log-step
+// 'scan', the implementation files specialize it with in-register byte shifts
+template <typename T, int S>
+struct _scan_shift
+{
+	static reg apply(const reg v) {
+		uint32_t idx[nElReg<T>()];
+		for (auto i = 0; i < nElReg<T>(); i++)
+			idx[i] = (i < S) ? 0 : (uint32_t)(i - S);
+		return mipp::shuff<T>(v, mipp::cmask<T>(idx));
+	}
+};
+
+// ---------------------------------------------------------------------------------------------------------------- dot
+
+template <typename T>
+inline reg _dot_acc_same(const reg acc, const reg a, const reg b, std::true_type) {
+	return mipp::fmadd<T>(a, b, acc);
+}
+
+template <typename T>
+inline reg _dot_acc_same(const reg acc, const reg a, const reg b, std::false_type) {
+	return mipp::add<T>(acc, mipp::mul<T>(a, b));
+}
+
+// the elements of 'v' converted in 'TA' by halves and added to 'acc'
+template <typename T, typename TA>
+inline reg _dot_widen_add(const reg acc, const reg v) {
+	return mipp::add<TA>(acc, mipp::add<TA>(mipp::cvt<T,TA>(mipp::low<T>(v)), mipp::cvt<T,TA>(mipp::high<T>(v))));
+}
+
+template <typename T> struct _dot_wider           { using type = T;        };
+template <>           struct _dot_wider<int8_t  > { using type = int16_t;  };
+template <>           struct _dot_wider<int16_t > { using type = int32_t;  };
+template <>           struct _dot_wider<uint8_t > { using type = uint16_t; };
+template <>           struct _dot_wider<uint16_t> { using type = uint32_t; };
+
+// the mixed precision kernels are composed of conversions by halves, the tag is 'sizeof(TA) / sizeof(T)'
+template <typename T, typename TA, int R>
+inline reg _dot_acc_cvt(const reg, const reg, const reg, std::integral_constant<int,R>) {
+	errorMessage<T,TA>("_dot_acc");
+	exit(-1);
+}
+
+template <typename T, typename TA>
+inline reg _dot_acc_cvt(const reg acc, const reg a, const reg b, std::integral_constant<int,1>) {
+	static_assert(std::is_same<T,TA>::value, "The accumulation type has to be 'T' or a wider integer type.");
+	return mipp::_dot_acc_same<T>(acc, a, b, std::is_floating_point<T>());
+}
+
+template <typename T, typename TA>
+inline reg _dot_acc_cvt(const reg acc, const reg a, const reg b, std::integral_constant<int,2>) {
+	const auto lo = mipp::mul<TA>(mipp::cvt<T,TA>(mipp::low <T>(a)), mipp::cvt<T,TA>(mipp::low <T>(b)));
+	const auto hi = mipp::mul<TA>(mipp::cvt<T,TA>(mipp::high<T>(a)), mipp::cvt<T,TA>(mipp::high<T>(b)));
+	return mipp::add<TA>(acc, mipp::add<TA>(lo, hi));
+}
+
+// the products are exact in the intermediate type (8-bit products in 16-bit elements)
+template <typename T, typename TA>
+inline reg _dot_acc_cvt(const reg acc, const reg a, const reg b, std::integral_constant<int,4>) {
+	using TH = typename _dot_wider<T>::type;
+	static_assert(sizeof(TH) == 2 * sizeof(T), "The 8-bit and 16-bit integers are the only types with a 4 times wider "
+	                                           "accumulation type.");
+	const auto lo = mipp::mul<TH>(mipp::cvt<T,TH>(mipp::low <T>(a)), mipp::cvt<T,TH>(mipp::low <T>(b)));
+	const auto hi = mipp::mul<TH>(mipp::cvt<T,TH>(mipp::high<T>(a)), mipp::cvt<T,TH>(mipp::high<T>(b)));
+	return mipp::_dot_widen_add<TH,TA>(mipp::_dot_widen_add<TH,TA>(acc, lo), hi);
+}
+
+// 'acc' plus the products of the 'T' elements of 'a' and 'b', accumulated in the 'TA' elements of 'acc'. In mixed
+// precision an element of 'acc' receives the products of several elements (grouped differently depending on the
+// instruction set): only the sum of the elements of 'acc' is meaningful. It is specialized in the implementation files
+// with the multiply-add instructions ('pmaddwd', 'vpdpwssd', 'vpdpbusd').
+template <typename T, typename TA>
+struct _dot_acc
+{
+	static reg apply(const reg acc, const reg a, const reg b) {
+		return mipp::_dot_acc_cvt<T,TA>(acc, a, b, std::integral_constant<int,(int)(sizeof(TA) / sizeof(T))>());
+	}
+};
+
 // ------------------------------------------------------------------------------------------------- wrapper to objects
 #include "mipp_object.hxx"
 
+// ----------------------------------------------------------------------------------------------- expression templates
+#include "mipp_expr.hxx"
+
 #ifndef MIPP_NO_INTRINSICS
+// ----------------------------------------------------------------------------------------------------------- EMULATED
+// --------------------------------------------------------------------------------------------------------------------
+#if defined(MIPP_EMU)
+#include "mipp_impl_EMU.hxx"
 // ------------------------------------------------------------------------------------------------------- ARM NEON-128
 // --------------------------------------------------------------------------------------------------------------------
-#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
 #include "mipp_impl_NEON.hxx"
 // -------------------------------------------------------------------------------------------------------- X86 AVX-512
 // --------------------------------------------------------------------------------------------------------------------
@@ -1380,6 +2544,110 @@ template <typename T> inline T hmax(const reg v) { return reduction<T,mipp::max<
 #endif
 #endif
 
+// ------------------------------------------------------------------------------------------------ unsigned integers
+// --------------------------------------------------------------------------------------------------------------------
+// the unsigned integers share the registers of the signed integers of the same size: the operations that do not depend
+// on the signedness (memory, permutations, bitwise, wrapping arithmetic, ...) are forwarded to the signed
+// implementations. The comparisons, 'min', 'max', the saturated 'add' and 'sub', the conversions and the packing are
+// specialized in the implementation files ('rshift' is a logical shift for all the integer types).
+#ifndef MIPP_NO_INTRINSICS
+// adapts an unsigned 'Reg' reduction operator to the signed reductions
+template <typename TU, typename TS, Red_op<TU> OP>
+inline Reg<TS> _unsigned_op(const Reg<TS> v1, const Reg<TS> v2)
+{
+	return Reg<TS>(OP(Reg<TU>(v1.r), Reg<TU>(v2.r)).r);
+}
+
+#define MIPP_UNSIGNED_FORWARD(UT, ST)                                                                                                \
+template <> inline reg   load         <UT>(const UT *mem                          ) { return mipp::load<ST>((const ST*)mem); }       \
+template <> inline reg   loadu        <UT>(const UT *mem                          ) { return mipp::loadu<ST>((const ST*)mem); }      \
+template <> inline void  store        <UT>(UT *mem, const reg v                   ) { mipp::store<ST>((ST*)mem, v); }                \
+template <> inline void  storeu       <UT>(UT *mem, const reg v                   ) { mipp::storeu<ST>((ST*)mem, v); }               \
+template <> inline reg   loadu_n      <UT>(const UT *mem, const uint32_t n        ) { return mipp::loadu_n<ST>((const ST*)mem, n); } \
+template <> inline void  storeu_n     <UT>(UT *mem, const reg v, const uint32_t n ) { mipp::storeu_n<ST>((ST*)mem, v, n); }          \
+template <> inline void  stream       <UT>(UT *mem, const reg v                   ) { mipp::stream<ST>((ST*)mem, v); }               \
+template <> inline reg   set          <UT>(const UT vals[nElReg<UT>()]            ) { return mipp::set<ST>((const ST*)vals); }       \
+template <> inline reg   set1         <UT>(const UT val                           ) { return mipp::set1<ST>((ST)val); }              \
+template <> inline reg   set0         <UT>(                                       ) { return mipp::set0<ST>(); }                     \
+template <> inline reg_2 low          <UT>(const reg v                            ) { return mipp::low<ST>(v); }                     \
+template <> inline reg_2 high         <UT>(const reg v                            ) { return mipp::high<ST>(v); }                    \
+template <> inline reg   combine      <UT>(const reg_2 v1, const reg_2 v2         ) { return mipp::combine<ST>(v1, v2); }            \
+template <> inline reg   cmask        <UT>(const uint32_t val[nElReg<UT>()]       ) { return mipp::cmask<ST>(val); }                 \
+template <> inline reg   cmask2       <UT>(const uint32_t val[nElReg<UT>()/2]     ) { return mipp::cmask2<ST>(val); }                \
+template <> inline reg   cmask4       <UT>(const uint32_t val[nElReg<UT>()/4]     ) { return mipp::cmask4<ST>(val); }                \
+template <> inline reg   shuff        <UT>(const reg v, const reg cm              ) { return mipp::shuff<ST>(v, cm); }               \
+template <> inline reg   shuff2       <UT>(const reg v, const reg cm              ) { return mipp::shuff2<ST>(v, cm); }              \
+template <> inline reg   shuff4       <UT>(const reg v, const reg cm              ) { return mipp::shuff4<ST>(v, cm); }              \
+template <> inline reg   interleavelo <UT>(const reg v1, const reg v2             ) { return mipp::interleavelo<ST>(v1, v2); }       \
+template <> inline reg   interleavehi <UT>(const reg v1, const reg v2             ) { return mipp::interleavehi<ST>(v1, v2); }       \
+template <> inline reg   interleavelo2<UT>(const reg v1, const reg v2             ) { return mipp::interleavelo2<ST>(v1, v2); }      \
+template <> inline reg   interleavehi2<UT>(const reg v1, const reg v2             ) { return mipp::interleavehi2<ST>(v1, v2); }      \
+template <> inline reg   interleavelo4<UT>(const reg v1, const reg v2             ) { return mipp::interleavelo4<ST>(v1, v2); }      \
+template <> inline reg   interleavehi4<UT>(const reg v1, const reg v2             ) { return mipp::interleavehi4<ST>(v1, v2); }      \
+template <> inline regx2 interleave   <UT>(const reg v1, const reg v2             ) { return mipp::interleave<ST>(v1, v2); }         \
+template <> inline regx2 deinterleave <UT>(const reg v1, const reg v2             ) { return mipp::deinterleave<ST>(v1, v2); }       \
+template <> inline regx2 interleave2  <UT>(const reg v1, const reg v2             ) { return mipp::interleave2<ST>(v1, v2); }        \
+template <> inline regx2 interleave4  <UT>(const reg v1, const reg v2             ) { return mipp::interleave4<ST>(v1, v2); }        \
+template <> inline reg   interleave   <UT>(const reg v                            ) { return mipp::interleave<ST>(v); }              \
+template <> inline regx2 interleavex2 <UT>(const reg v1, const reg v2             ) { return mipp::interleavex2<ST>(v1, v2); }       \
+template <> inline reg   interleavex4 <UT>(const reg v                            ) { return mipp::interleavex4<ST>(v); }            \
+template <> inline reg   interleavex16<UT>(const reg v                            ) { return mipp::interleavex16<ST>(v); }           \
+template <> inline reg   andb         <UT>(const reg v1, const reg v2             ) { return mipp::andb<ST>(v1, v2); }               \
+template <> inline reg   andnb        <UT>(const reg v1, const reg v2             ) { return mipp::andnb<ST>(v1, v2); }              \
+template <> inline reg   notb         <UT>(const reg v                            ) { return mipp::notb<ST>(v); }                    \
+template <> inline reg   orb          <UT>(const reg v1, const reg v2             ) { return mipp::orb<ST>(v1, v2); }                \
+template <> inline reg   xorb         <UT>(const reg v1, const reg v2             ) { return mipp::xorb<ST>(v1, v2); }               \
+template <> inline reg   lshift       <UT>(const reg v, const uint32_t n          ) { return mipp::lshift<ST>(v, n); }               \
+template <> inline reg   lshiftr      <UT>(const reg v1, const reg v2             ) { return mipp::lshiftr<ST>(v1, v2); }            \
+template <> inline reg   rshift       <UT>(const reg v, const uint32_t n          ) { return mipp::rshift<ST>(v, n); }               \
+template <> inline reg   rshiftr      <UT>(const reg v1, const reg v2             ) { return mipp::rshiftr<ST>(v1, v2); }            \
+template <> inline msk   cmpeq        <UT>(const reg v1, const reg v2             ) { return mipp::cmpeq<ST>(v1, v2); }              \
+template <> inline msk   cmpneq       <UT>(const reg v1, const reg v2             ) { return mipp::cmpneq<ST>(v1, v2); }             \
+template <> inline reg   mul          <UT>(const reg v1, const reg v2             ) { return mipp::mul<ST>(v1, v2); }                \
+template <> inline reg   msb          <UT>(const reg v                            ) { return mipp::msb<ST>(v); }                     \
+template <> inline reg   msb          <UT>(const reg v1, const reg v2             ) { return mipp::msb<ST>(v1, v2); }                \
+template <> inline reg   blend        <UT>(const reg v1, const reg v2, const msk m) { return mipp::blend<ST>(v1, v2, m); }           \
+template <> inline reg   compress     <UT>(const reg v, const msk m               ) { return mipp::compress<ST>(v, m); }             \
+template <> inline reg   expand       <UT>(const reg v, const msk m               ) { return mipp::expand<ST>(v, m); }               \
+template <> inline reg   lrot         <UT>(const reg v                            ) { return mipp::lrot<ST>(v); }                    \
+template <> inline reg   rrot         <UT>(const reg v                            ) { return mipp::rrot<ST>(v); }                    \
+template <> inline bool  testz        <UT>(const reg v1, const reg v2             ) { return mipp::testz<ST>(v1, v2); }              \
+template <> inline bool  testz        <UT>(const reg v                            ) { return mipp::testz<ST>(v); }                   \
+template <> inline reg   div2         <UT>(const reg v                            ) { return mipp::rshift<ST>(v, 1); }               \
+template <> inline reg   div4         <UT>(const reg v                            ) { return mipp::rshift<ST>(v, 2); }               \
+template <> inline reg   abs          <UT>(const reg v                            ) { return v; }                                    \
+template <> inline msk   sign         <UT>(const reg                              ) { return mipp::set0<N<ST>()>(); }                \
+template <> inline reg   gather       <UT,UT>(const UT *mem, const reg idx) { return mipp::gather<ST,ST>((const ST*)mem, idx); }     \
+template <> inline reg   gather       <UT,UT>(const msk m, const reg src, const UT *mem, const reg idx)                              \
+{ return mipp::gather<ST,ST>(m, src, (const ST*)mem, idx); }                                                                         \
+template <> inline void  scatter      <UT,UT>(UT *mem, const reg idx, const reg v) { mipp::scatter<ST,ST>((ST*)mem, idx, v); }       \
+template <> inline void  scatter      <UT,UT>(const msk m, UT *mem, const reg idx, const reg v)                                      \
+{ mipp::scatter<ST,ST>(m, (ST*)mem, idx, v); }                                                                                       \
+template <> inline UT    extract      <UT>(const reg v, const uint32_t index      ) { return (UT)mipp::extract<ST>(v, index); }      \
+template <int I> struct _extract<UT,I>                                                                                               \
+{ static UT apply(const reg v) { return (UT)_extract<ST,I>::apply(v); } };                                                           \
+template <int... I> struct _permute<UT,I...>                                                                                         \
+{ static reg apply(const reg v) { return _permute<ST,I...>::apply(v); } };                                                           \
+template <> inline reg   sat          <UT>(const reg v, UT min, UT max)                                                              \
+{ return mipp::min<UT>(mipp::max<UT>(v, mipp::set1<UT>(min)), mipp::set1<UT>(max)); }                                                \
+template <red_op<UT> OP> struct _reduction<UT,OP>                                                                                    \
+{ static reg apply(const reg v) { return _reduction<ST,OP>::apply(v); } };                                                           \
+template <Red_op<UT> OP> struct _Reduction<UT,OP>                                                                                    \
+{ static Reg<UT> apply(const Reg<UT> v) { return Reg<UT>(_Reduction<ST,_unsigned_op<UT,ST,OP>>::apply(Reg<ST>(v.r)).r); } };
+
+MIPP_UNSIGNED_FORWARD(uint64_t, int64_t)
+MIPP_UNSIGNED_FORWARD(uint32_t, int32_t)
+MIPP_UNSIGNED_FORWARD(uint16_t, int16_t)
+MIPP_UNSIGNED_FORWARD(uint8_t,  int8_t )
+
+#undef MIPP_UNSIGNED_FORWARD
+
+// the 32-bit and 64-bit additions and subtractions wrap around (as for the signed integers)
+template <> inline reg add<uint64_t>(const reg v1, const reg v2) { return mipp::add<int64_t>(v1, v2); }
+template <> inline reg add<uint32_t>(const reg v1, const reg v2) { return mipp::add<int32_t>(v1, v2); }
+template <> inline reg sub<uint64_t>(const reg v1, const reg v2) { return mipp::sub<int64_t>(v1, v2); }
+template <> inline reg sub<uint32_t>(const reg v1, const reg v2) { return mipp::sub<int32_t>(v1, v2); }
+#endif
 
 template <>
 inline regx2 cmul<float>(const regx2 v1, const regx2 v2)
@@ -1417,6 +2685,10 @@ inline reg norm<float>(const regx2 v)
 {
 	return mipp::fmadd<float>(v.val[0], v.val[0], mipp::mul<float>(v.val[1], v.val[1]));
 }
+
+// ----------------------------------------------------------------------------------------------------- accuracy tiers
+#include "mipp_math.hxx"
+} // inline namespace MIPP_ISA_NAMESPACE
 }
 
 #endif /* MY_INTRINSICS_PLUS_PLUS_H_ */
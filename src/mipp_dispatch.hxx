@@ -0,0 +1,202 @@
+#include "mipp.h"
+
+// --------------------------------------------------------------------------------------------------- runtime dispatch
+// --------------------------------------------------------------------------------------------------------------------
+// A kernel written against 'mipp::Reg<T>' can be compiled several times with different ISA flags (ex.: '-msse4.2',
+// '-mavx2 -mfma', '-mavx512f -mavx512bw...'), each compilation lands in its own 'mipp::isa_xxx' inline namespace. At
+// runtime, 'mipp::dispatch' selects the best compiled instance supported by the current CPU:
+//
+//   using kern_t = void (*)(const float*, float*, size_t);
+//   static const kern_t kern = mipp::dispatch<kern_t>({{mipp::ISA::SSE4_2,   &sse42::kernel },
+//                                                      {mipp::ISA::AVX2,     &avx2::kernel  },
+//                                                      {mipp::ISA::AVX512BW, &avx512::kernel}});
+//
+// The 'MIPP_ISA' environment variable (ex.: 'MIPP_ISA=AVX2') can be used to cap the selected ISA (useful to validate
+// the fallbacks on a recent CPU).
+
+// ISA targeted by the current compilation unit
+#if defined(MIPP_NO_INTRINSICS) || defined(MIPP_EMU)
+constexpr ISA CompiledISA = ISA::NO;
+#elif defined(MIPP_NEONV2)
+constexpr ISA CompiledISA = ISA::NEONv2;
+#elif defined(MIPP_NEONV1)
+constexpr ISA CompiledISA = ISA::NEONv1;
+#elif defined(MIPP_AVX512BW)
+constexpr ISA CompiledISA = ISA::AVX512BW;
+#elif defined(MIPP_AVX512)
+constexpr ISA CompiledISA = ISA::AVX512F;
+#elif defined(MIPP_AVX2)
+constexpr ISA CompiledISA = ISA::AVX2;
+#elif defined(MIPP_AVX1)
+constexpr ISA CompiledISA = ISA::AVX;
+#elif defined(MIPP_SSE4_2)
+constexpr ISA CompiledISA = ISA::SSE4_2;
+#elif defined(MIPP_SSE4_1)
+constexpr ISA CompiledISA = ISA::SSE4_1;
+#elif defined(MIPP_SSSE3)
+constexpr ISA CompiledISA = ISA::SSSE3;
+#elif defined(MIPP_SSE3)
+constexpr ISA CompiledISA = ISA::SSE3;
+#elif defined(MIPP_SSE2)
+constexpr ISA CompiledISA = ISA::SSE2;
+#else
+constexpr ISA CompiledISA = ISA::SSE;
+#endif
+
+inline std::string isa_name(const ISA isa)
+{
+	switch (isa)
+	{
+		case ISA::NO:       return "NO_INTRINSICS";
+		case ISA::SSE:      return "SSE";
+		case ISA::SSE2:     return "SSE2";
+		case ISA::SSE3:     return "SSE3";
+		case ISA::SSSE3:    return "SSSE3";
+		case ISA::SSE4_1:   return "SSE4.1";
+		case ISA::SSE4_2:   return "SSE4.2";
+		case ISA::AVX:      return "AVX";
+		case ISA::AVX2:     return "AVX2";
+		case ISA::AVX512F:  return "AVX512F";
+		case ISA::AVX512BW: return "AVX512BW";
+		case ISA::NEONv1:   return "NEONv1";
+		case ISA::NEONv2:   return "NEONv2";
+		default:            return "UNKNOWN";
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+// regs[0] = eax, regs[1] = ebx, regs[2] = ecx, regs[3] = edx
+inline void _cpuid(const uint32_t leaf, const uint32_t subleaf, uint32_t regs[4])
+{
+#ifdef _MSC_VER
+	int r[4];
+	__cpuidex(r, (int)leaf, (int)subleaf);
+	for (auto i = 0; i < 4; i++) regs[i] = (uint32_t)r[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// state components enabled by the OS (XCR0 register), only valid if the CPU supports OSXSAVE
+inline uint64_t _xgetbv0()
+{
+#ifdef _MSC_VER
+	return (uint64_t)_xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+// return the highest ISA supported by the CPU and by the OS
+inline ISA _detect_isa()
+{
+	uint32_t r[4];
+	_cpuid(0, 0, r);
+	const uint32_t max_leaf = r[0];
+	if (max_leaf < 1)
+		return ISA::NO;
+
+	_cpuid(1, 0, r);
+	const uint32_t ecx1 = r[2], edx1 = r[3];
+	uint32_t ebx7 = 0;
+	if (max_leaf >= 7)
+	{
+		_cpuid(7, 0, r);
+		ebx7 = r[1];
+	}
+
+	const bool osxsave = (ecx1 >> 27) & 1;
+	const uint64_t xcr0 = osxsave ? _xgetbv0() : 0;
+	const bool os_avx    = (xcr0 & 0x06) == 0x06; // XMM and YMM states
+	const bool os_avx512 = (xcr0 & 0xE6) == 0xE6; // XMM, YMM, opmask, ZMM_Hi256 and Hi16_ZMM states
+
+	const bool sse      = (edx1 >> 25) & 1;
+	const bool sse2     = (edx1 >> 26) & 1;
+	const bool sse3     = (ecx1 >>  0) & 1;
+	const bool ssse3    = (ecx1 >>  9) & 1;
+	const bool fma      = (ecx1 >> 12) & 1;
+	const bool sse4_1   = (ecx1 >> 19) & 1;
+	const bool sse4_2   = (ecx1 >> 20) & 1;
+	const bool avx      = (ecx1 >> 28) & 1;
+	const bool avx2     = (ebx7 >>  5) & 1;
+	const bool avx512f  = (ebx7 >> 16) & 1;
+	const bool avx512dq = (ebx7 >> 17) & 1;
+	const bool avx512cd = (ebx7 >> 28) & 1;
+	const bool avx512bw = (ebx7 >> 30) & 1;
+	const bool avx512vl = (ebx7 >> 31) & 1;
+
+	// each level requires all the previous ones, 'AVX2' implies 'FMA' and 'AVX512BW' stands for the Skylake-SP
+	// feature set (F, CD, BW, DQ and VL)
+	ISA isa = ISA::NO;
+	if (!sse                                                        ) return isa; else isa = ISA::SSE;
+	if (!sse2                                                       ) return isa; else isa = ISA::SSE2;
+	if (!sse3                                                       ) return isa; else isa = ISA::SSE3;
+	if (!ssse3                                                      ) return isa; else isa = ISA::SSSE3;
+	if (!sse4_1                                                     ) return isa; else isa = ISA::SSE4_1;
+	if (!sse4_2                                                     ) return isa; else isa = ISA::SSE4_2;
+	if (!avx || !os_avx                                             ) return isa; else isa = ISA::AVX;
+	if (!avx2 || !fma                                               ) return isa; else isa = ISA::AVX2;
+	if (!avx512f || !os_avx512                                      ) return isa; else isa = ISA::AVX512F;
+	if (!avx512bw || !avx512dq || !avx512cd || !avx512vl            ) return isa; else isa = ISA::AVX512BW;
+	return isa;
+}
+#else
+inline ISA _detect_isa()
+{
+#if defined(__aarch64__)
+	return ISA::NEONv2;
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+	return ISA::NEONv1;
+#else
+	return ISA::NO;
+#endif
+}
+#endif
+
+// return true if 'isa' can be executed on the current CPU (independently of the 'MIPP_ISA' environment variable)
+inline bool isa_supported(const ISA isa)
+{
+	static const ISA cpu_isa = _detect_isa();
+	if (isa == ISA::NO)
+		return true;
+	const bool cpu_is_arm = cpu_isa == ISA::NEONv1 || cpu_isa == ISA::NEONv2;
+	const bool isa_is_arm = isa     == ISA::NEONv1 || isa     == ISA::NEONv2;
+	return cpu_is_arm == isa_is_arm && (int)isa <= (int)cpu_isa;
+}
+
+// return the best ISA supported by the current CPU, capped by the 'MIPP_ISA' environment variable if defined
+inline ISA best_isa()
+{
+	static const ISA best = []() {
+		ISA isa = _detect_isa();
+		const char* env = std::getenv("MIPP_ISA");
+		if (env != nullptr)
+		{
+			const std::string cap(env);
+			for (auto i = (int)ISA::NO; i <= (int)ISA::NEONv2; i++)
+				if (isa_name((ISA)i) == cap && isa_supported((ISA)i))
+					isa = (ISA)i;
+		}
+		return isa;
+	}();
+	return best;
+}
+
+// select the kernel compiled for the best ISA supported by the current CPU, throw if there is none
+template <typename F>
+F dispatch(const std::initializer_list<std::pair<ISA,F>> kernels)
+{
+	const ISA best = best_isa();
+	const std::pair<ISA,F>* selected = nullptr;
+	for (auto &k : kernels)
+		if (isa_supported(k.first) && (int)k.first <= (int)best && (!selected || (int)k.first > (int)selected->first))
+			selected = &k;
+
+	if (selected == nullptr)
+		throw std::runtime_error("mipp::dispatch: there is no kernel compatible with the current CPU ('" +
+		                         isa_name(best) + "').");
+
+	return selected->second;
+}
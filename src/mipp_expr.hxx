@@ -0,0 +1,327 @@
+#include "mipp.h"
+
+// ----------------------------------------------------------------------------------------------- expression templates
+// --------------------------------------------------------------------------------------------------------------------
+// Lazy arithmetic over arrays: 'y = a * x + b' (with 'x' and 'y' wrapped arrays) builds a tree of nodes and nothing is
+// computed until the tree is assigned to an array. Then the whole tree is evaluated register by register in a single
+// pass (no temporary array, each element is loaded and stored once) and the tail is processed with partial loads and
+// stores. On the floating-point types, the 'a * b + c', 'a * b - c' and 'c - a * b' sub-trees are evaluated with
+// 'fmadd', 'fmsub' and 'fnmadd'.
+//
+//   mipp::vector<float> x(n), y(n);
+//   mipp::expr::wrap(y) = 2.f * mipp::expr::wrap(x) + 1.f;
+//   float s = mipp::expr::sum(mipp::expr::wrap(x) * mipp::expr::wrap(y));
+//
+// The nodes are stored by copy (a leaf is a pointer and a size) and a tree can be kept in an 'auto' variable as long
+// as the arrays are alive. The output can be one of the inputs (element-wise operations only).
+namespace expr
+{
+// loads the register at the position 'i' of a leaf
+struct _ld_full
+{
+	size_t i;
+
+	template <typename T>
+	inline Reg<T> operator()(const T *data) const { Reg<T> r; r.loadu(data + i); return r; }
+};
+
+// loads the 'n' elements at the position 'i' of a leaf (the other elements are set to zero)
+struct _ld_tail
+{
+	size_t i;
+	uint32_t n;
+
+	template <typename T>
+	inline Reg<T> operator()(const T *data) const { Reg<T> r; r.loadu_n(data + i, n); return r; }
+};
+
+// size of the nodes that adapt to any size (the scalars)
+constexpr size_t _any = (size_t)-1;
+
+// all the nodes derive from 'node<E>' (CRTP), 'E' has a 'type', a 'size()' ('_any' for the scalars) and an 'eval(ld)'
+// that returns a 'Reg<type>'
+template <class E>
+struct node
+{
+	inline const E& self() const { return static_cast<const E&>(*this); }
+};
+
+// broadcasted value
+template <typename T>
+class scalar : public node<scalar<T>>
+{
+	T val;
+
+public:
+	using type = T;
+
+	explicit scalar(const T val) : val(val) {}
+
+	inline size_t size() const { return _any; }
+
+	template <class LD>
+	inline Reg<T> eval(const LD &) const { return Reg<T>(val); }
+};
+
+// read-only array
+template <typename T>
+class cspan : public node<cspan<T>>
+{
+	const T *ptr;
+	size_t   n;
+
+public:
+	using type = T;
+
+	cspan(const T *data, const size_t size) : ptr(data), n(size) {}
+
+	inline size_t   size() const { return n;   }
+	inline const T* data() const { return ptr; }
+
+	template <class LD>
+	inline Reg<T> eval(const LD &ld) const { return ld(ptr); }
+};
+
+// assignable array: the assignment of a tree evaluates it
+template <typename T>
+class span : public node<span<T>>
+{
+	T      *ptr;
+	size_t  n;
+
+public:
+	using type = T;
+
+	span(T *data, const size_t size) : ptr(data), n(size) {}
+	// a copy refers to the same array (the assignment copies the elements)
+	span(const span<T> &s) = default;
+
+	inline size_t size() const { return n;   }
+	inline T*     data() const { return ptr; }
+
+	template <class LD>
+	inline Reg<T> eval(const LD &ld) const { return ld((const T*)ptr); }
+
+	template <class E>
+	inline span<T>& operator=(const node<E> &e)
+	{
+		static_assert(std::is_same<typename E::type, T>::value, "mipp::expr: the types of the tree and the array differ.");
+		const auto &ex = e.self();
+		if (ex.size() != _any && ex.size() != n)
+			throw std::runtime_error("mipp::expr::span: the sizes of the tree and the array differ.");
+
+		const size_t vecSize = (n / N<T>()) * N<T>();
+		size_t i = 0;
+		for (; i < vecSize; i += N<T>())
+			ex.eval(_ld_full{i}).storeu(ptr + i);
+
+		if (i < n)
+			ex.eval(_ld_tail{i, (uint32_t)(n - i)}).storeu_n(ptr + i, (uint32_t)(n - i));
+		return *this;
+	}
+
+	inline span<T>& operator=(const span<T> &s) { return this->operator=<span<T>>(s); }
+
+	inline span<T>& operator=(const T val) { return *this = scalar<T>(val); }
+};
+
+struct add_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return a + b;          } };
+struct sub_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return a - b;          } };
+struct mul_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return a * b;          } };
+struct div_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return a / b;          } };
+struct min_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return mipp::min(a, b); } };
+struct max_op { template <typename T> static inline Reg<T> apply(const Reg<T> a, const Reg<T> b) { return mipp::max(a, b); } };
+
+struct neg_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return Reg<T>((T)0) - a; } };
+struct abs_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::abs(a);      } };
+struct sqrt_op { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::sqrt(a);     } };
+struct exp_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::exp(a);      } };
+struct log_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::log(a);      } };
+struct sin_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::sin(a);      } };
+struct cos_op  { template <typename T> static inline Reg<T> apply(const Reg<T> a) { return mipp::cos(a);      } };
+
+template <class OP, class E>
+class unary : public node<unary<OP,E>>
+{
+public:
+	E e;
+
+	using type = typename E::type;
+
+	explicit unary(const E &e) : e(e) {}
+
+	inline size_t size() const { return e.size(); }
+
+	template <class LD>
+	inline Reg<type> eval(const LD &ld) const { return OP::apply(e.eval(ld)); }
+};
+
+template <class OP, class L, class R>
+class binary;
+
+// evaluation of 'OP(l, r)', specialized below to fuse the multiplications and the additions ('F' is true for the
+// floating-point types)
+template <class OP, class L, class R, bool F>
+struct _fuse
+{
+	template <class LD>
+	static inline Reg<typename L::type> eval(const L &l, const R &r, const LD &ld)
+	{
+		return OP::apply(l.eval(ld), r.eval(ld));
+	}
+};
+
+// 'a * b + c'
+template <class A, class B, class C>
+struct _fuse<add_op, binary<mul_op,A,B>, C, true>
+{
+	template <class LD>
+	static inline Reg<typename C::type> eval(const binary<mul_op,A,B> &l, const C &r, const LD &ld)
+	{
+		return mipp::fmadd(l.l.eval(ld), l.r.eval(ld), r.eval(ld));
+	}
+};
+
+// 'c + a * b'
+template <class C, class A, class B>
+struct _fuse<add_op, C, binary<mul_op,A,B>, true>
+{
+	template <class LD>
+	static inline Reg<typename C::type> eval(const C &l, const binary<mul_op,A,B> &r, const LD &ld)
+	{
+		return mipp::fmadd(r.l.eval(ld), r.r.eval(ld), l.eval(ld));
+	}
+};
+
+// 'a * b + c * d'
+template <class A, class B, class C, class D>
+struct _fuse<add_op, binary<mul_op,A,B>, binary<mul_op,C,D>, true>
+{
+	template <class LD>
+	static inline Reg<typename A::type> eval(const binary<mul_op,A,B> &l, const binary<mul_op,C,D> &r, const LD &ld)
+	{
+		return mipp::fmadd(l.l.eval(ld), l.r.eval(ld), r.eval(ld));
+	}
+};
+
+// 'a * b - c'
+template <class A, class B, class C>
+struct _fuse<sub_op, binary<mul_op,A,B>, C, true>
+{
+	template <class LD>
+	static inline Reg<typename C::type> eval(const binary<mul_op,A,B> &l, const C &r, const LD &ld)
+	{
+		return mipp::fmsub(l.l.eval(ld), l.r.eval(ld), r.eval(ld));
+	}
+};
+
+// 'c - a * b'
+template <class C, class A, class B>
+struct _fuse<sub_op, C, binary<mul_op,A,B>, true>
+{
+	template <class LD>
+	static inline Reg<typename C::type> eval(const C &l, const binary<mul_op,A,B> &r, const LD &ld)
+	{
+		return mipp::fnmadd(r.l.eval(ld), r.r.eval(ld), l.eval(ld));
+	}
+};
+
+// 'a * b - c * d'
+template <class A, class B, class C, class D>
+struct _fuse<sub_op, binary<mul_op,A,B>, binary<mul_op,C,D>, true>
+{
+	template <class LD>
+	static inline Reg<typename A::type> eval(const binary<mul_op,A,B> &l, const binary<mul_op,C,D> &r, const LD &ld)
+	{
+		return mipp::fmsub(l.l.eval(ld), l.r.eval(ld), r.eval(ld));
+	}
+};
+
+template <class OP, class L, class R>
+class binary : public node<binary<OP,L,R>>
+{
+	static_assert(std::is_same<typename L::type, typename R::type>::value, "mipp::expr: the operand types differ.");
+
+public:
+	L l;
+	R r;
+
+	using type = typename L::type;
+
+	binary(const L &l, const R &r) : l(l), r(r)
+	{
+		if (l.size() != _any && r.size() != _any && l.size() != r.size())
+			throw std::runtime_error("mipp::expr::binary: the sizes of the operands differ.");
+	}
+
+	inline size_t size() const { return l.size() != _any ? l.size() : r.size(); }
+
+	template <class LD>
+	inline Reg<type> eval(const LD &ld) const
+	{
+		return _fuse<OP,L,R,std::is_floating_point<type>::value>::eval(l, r, ld);
+	}
+};
+
+// ------------------------------------------------------------------------------------------------------------- leaves
+template <typename T, class A> inline span <T> wrap(      std::vector<T,A> &v     ) { return span <T>(v.data(), v.size()); }
+template <typename T, class A> inline cspan<T> wrap(const std::vector<T,A> &v     ) { return cspan<T>(v.data(), v.size()); }
+template <typename T>          inline span <T> wrap(      T *data, const size_t n ) { return span <T>(data, n);            }
+template <typename T>          inline cspan<T> wrap(const T *data, const size_t n ) { return cspan<T>(data, n);            }
+
+// ---------------------------------------------------------------------------------------------------------- operators
+#define MIPP_EXPR_BINARY(OP, NAME)                                                                                     \
+template <class L, class R>                                                                                            \
+inline binary<NAME,L,R> OP(const node<L> &l, const node<R> &r)                                                         \
+{ return binary<NAME,L,R>(l.self(), r.self()); }                                                                       \
+template <class L>                                                                                                     \
+inline binary<NAME,L,scalar<typename L::type>> OP(const node<L> &l, const typename L::type r)                          \
+{ return binary<NAME,L,scalar<typename L::type>>(l.self(), scalar<typename L::type>(r)); }                             \
+template <class R>                                                                                                     \
+inline binary<NAME,scalar<typename R::type>,R> OP(const typename R::type l, const node<R> &r)                          \
+{ return binary<NAME,scalar<typename R::type>,R>(scalar<typename R::type>(l), r.self()); }
+
+MIPP_EXPR_BINARY(operator+, add_op)
+MIPP_EXPR_BINARY(operator-, sub_op)
+MIPP_EXPR_BINARY(operator*, mul_op)
+MIPP_EXPR_BINARY(operator/, div_op)
+MIPP_EXPR_BINARY(min,       min_op)
+MIPP_EXPR_BINARY(max,       max_op)
+
+#undef MIPP_EXPR_BINARY
+
+template <class E> inline unary<neg_op, E> operator-(const node<E> &e) { return unary<neg_op, E>(e.self()); }
+template <class E> inline unary<abs_op, E> abs      (const node<E> &e) { return unary<abs_op, E>(e.self()); }
+template <class E> inline unary<sqrt_op,E> sqrt     (const node<E> &e) { return unary<sqrt_op,E>(e.self()); }
+template <class E> inline unary<exp_op, E> exp      (const node<E> &e) { return unary<exp_op, E>(e.self()); }
+template <class E> inline unary<log_op, E> log      (const node<E> &e) { return unary<log_op, E>(e.self()); }
+template <class E> inline unary<sin_op, E> sin      (const node<E> &e) { return unary<sin_op, E>(e.self()); }
+template <class E> inline unary<cos_op, E> cos      (const node<E> &e) { return unary<cos_op, E>(e.self()); }
+
+// --------------------------------------------------------------------------------------------------------- reductions
+// the tree is evaluated and summed in the same pass, the lanes after the tail are masked out
+template <class E>
+inline typename E::type sum(const node<E> &e)
+{
+	using T = typename E::type;
+	const auto &ex = e.self();
+	const size_t n = ex.size();
+	if (n == _any)
+		throw std::runtime_error("mipp::expr::sum: the tree has no array.");
+
+	const size_t vecSize = (n / N<T>()) * N<T>();
+	Reg<T> acc((T)0);
+	size_t i = 0;
+	for (; i < vecSize; i += N<T>())
+		acc += ex.eval(_ld_full{i});
+
+#ifndef MIPP_NO_INTRINSICS
+	if (i < n) {
+		const uint32_t t = (uint32_t)(n - i);
+		const auto m = Msk<N<T>()>(mipp::mask_n<N<T>()>(t));
+		acc += ex.eval(_ld_tail{i, t}).blend(Reg<T>((T)0), m);
+	}
+#endif
+	return acc.sum();
+}
+} // namespace expr
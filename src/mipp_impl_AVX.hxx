@@ -192,6 +192,161 @@
 	}
 #endif
 
+	// ---------------------------------------------------------------------------------------------------------- mask_n
+	template <>
+	inline msk mask_n<4>(const uint32_t n) {
+		const __m128i vn = _mm_set1_epi32((int)(n > 4 ? 4 : n));
+		return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_cmpgt_epi32(vn, _mm_setr_epi32(0, 0, 1, 1))),
+		                               _mm_cmpgt_epi32(vn, _mm_setr_epi32(2, 2, 3, 3)), 1);
+	}
+
+#ifdef __AVX2__
+	template <>
+	inline msk mask_n<8>(const uint32_t n) {
+		return _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n > 8 ? 8 : n)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+	}
+
+	template <>
+	inline msk mask_n<16>(const uint32_t n) {
+		return _mm256_cmpgt_epi16(_mm256_set1_epi16((int16_t)(n > 16 ? 16 : n)),
+		                          _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+	}
+
+	template <>
+	inline msk mask_n<32>(const uint32_t n) {
+		return _mm256_cmpgt_epi8(_mm256_set1_epi8((int8_t)(n > 32 ? 32 : n)),
+		                         _mm256_setr_epi8( 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+		                                          16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31));
+	}
+#else
+	template <>
+	inline msk mask_n<8>(const uint32_t n) {
+		const __m128i vn = _mm_set1_epi32((int)(n > 8 ? 8 : n));
+		return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_cmpgt_epi32(vn, _mm_setr_epi32(0, 1, 2, 3))),
+		                               _mm_cmpgt_epi32(vn, _mm_setr_epi32(4, 5, 6, 7)), 1);
+	}
+#endif
+
+	// --------------------------------------------------------------------------------------------------------- loadu_n
+	template <>
+	inline reg loadu_n<float>(const float *mem_addr, const uint32_t n) {
+		return _mm256_maskload_ps(mem_addr, mask_n<8>(n));
+	}
+
+	template <>
+	inline reg loadu_n<double>(const double *mem_addr, const uint32_t n) {
+		return _mm256_castpd_ps(_mm256_maskload_pd(mem_addr, mask_n<4>(n)));
+	}
+
+	template <>
+	inline reg loadu_n<int64_t>(const int64_t *mem_addr, const uint32_t n) {
+		return _mm256_castpd_ps(_mm256_maskload_pd((const double*)mem_addr, mask_n<4>(n)));
+	}
+
+	template <>
+	inline reg loadu_n<int32_t>(const int32_t *mem_addr, const uint32_t n) {
+		return _mm256_maskload_ps((const float*)mem_addr, mask_n<8>(n));
+	}
+
+	// -------------------------------------------------------------------------------------------------------- storeu_n
+	template <>
+	inline void storeu_n<float>(float *mem_addr, const reg v, const uint32_t n) {
+		_mm256_maskstore_ps(mem_addr, mask_n<8>(n), v);
+	}
+
+	template <>
+	inline void storeu_n<double>(double *mem_addr, const reg v, const uint32_t n) {
+		_mm256_maskstore_pd(mem_addr, mask_n<4>(n), _mm256_castps_pd(v));
+	}
+
+	template <>
+	inline void storeu_n<int64_t>(int64_t *mem_addr, const reg v, const uint32_t n) {
+		_mm256_maskstore_pd((double*)mem_addr, mask_n<4>(n), _mm256_castps_pd(v));
+	}
+
+	template <>
+	inline void storeu_n<int32_t>(int32_t *mem_addr, const reg v, const uint32_t n) {
+		_mm256_maskstore_ps((float*)mem_addr, mask_n<8>(n), v);
+	}
+
+	// --------------------------------------------------------------------------------------------------------- stream
+	// the non-temporal stores require 'mem_addr' to be aligned on 32 bytes (even if 'MIPP_ALIGNED_LOADS' is not defined)
+	template <>
+	inline void stream<float>(float *mem_addr, const reg v) {
+		_mm256_stream_ps(mem_addr, v);
+	}
+
+	template <>
+	inline void stream<double>(double *mem_addr, const reg v) {
+		_mm256_stream_pd(mem_addr, _mm256_castps_pd(v));
+	}
+
+	template <>
+	inline void stream<int64_t>(int64_t *mem_addr, const reg v) {
+		_mm256_stream_si256((__m256i*)mem_addr, _mm256_castps_si256(v));
+	}
+
+	template <>
+	inline void stream<int32_t>(int32_t *mem_addr, const reg v) {
+		_mm256_stream_si256((__m256i*)mem_addr, _mm256_castps_si256(v));
+	}
+
+	template <>
+	inline void stream<int16_t>(int16_t *mem_addr, const reg v) {
+		_mm256_stream_si256((__m256i*)mem_addr, _mm256_castps_si256(v));
+	}
+
+	template <>
+	inline void stream<int8_t>(int8_t *mem_addr, const reg v) {
+		_mm256_stream_si256((__m256i*)mem_addr, _mm256_castps_si256(v));
+	}
+
+	// ---------------------------------------------------------------------------------------------------------- gather
+#ifdef __AVX2__
+	template <>
+	inline reg gather<double,int64_t>(const double *mem_addr, const reg idx) {
+		return _mm256_castpd_ps(_mm256_i64gather_pd(mem_addr, _mm256_castps_si256(idx), 8));
+	}
+
+	template <>
+	inline reg gather<float,int32_t>(const float *mem_addr, const reg idx) {
+		return _mm256_i32gather_ps(mem_addr, _mm256_castps_si256(idx), 4);
+	}
+
+	template <>
+	inline reg gather<int64_t,int64_t>(const int64_t *mem_addr, const reg idx) {
+		return _mm256_castsi256_ps(_mm256_i64gather_epi64((const long long*)mem_addr, _mm256_castps_si256(idx), 8));
+	}
+
+	template <>
+	inline reg gather<int32_t,int32_t>(const int32_t *mem_addr, const reg idx) {
+		return _mm256_castsi256_ps(_mm256_i32gather_epi32((const int*)mem_addr, _mm256_castps_si256(idx), 4));
+	}
+
+	template <>
+	inline reg gather<double,int64_t>(const msk m, const reg src, const double *mem_addr, const reg idx) {
+		return _mm256_castpd_ps(_mm256_mask_i64gather_pd(_mm256_castps_pd(src), mem_addr, _mm256_castps_si256(idx),
+		                                                 _mm256_castsi256_pd(m), 8));
+	}
+
+	template <>
+	inline reg gather<float,int32_t>(const msk m, const reg src, const float *mem_addr, const reg idx) {
+		return _mm256_mask_i32gather_ps(src, mem_addr, _mm256_castps_si256(idx), _mm256_castsi256_ps(m), 4);
+	}
+
+	template <>
+	inline reg gather<int64_t,int64_t>(const msk m, const reg src, const int64_t *mem_addr, const reg idx) {
+		return _mm256_castsi256_ps(_mm256_mask_i64gather_epi64(_mm256_castps_si256(src), (const long long*)mem_addr,
+		                                                       _mm256_castps_si256(idx), m, 8));
+	}
+
+	template <>
+	inline reg gather<int32_t,int32_t>(const msk m, const reg src, const int32_t *mem_addr, const reg idx) {
+		return _mm256_castsi256_ps(_mm256_mask_i32gather_epi32(_mm256_castps_si256(src), (const int*)mem_addr,
+		                                                       _mm256_castps_si256(idx), m, 4));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ set
 	template <>
 	inline reg set<double>(const double vals[nElReg<double>()]) {
@@ -383,6 +538,202 @@
 		return _mm256_setzero_si256();
 	}
 
+	// -------------------------------------------------------------------------------------------------------- extract
+	template <int I>
+	struct _extract<double,I> {
+		static double apply(const reg r) {
+			const auto half = _mm256_extractf128_pd(_mm256_castps_pd(r), I / 2);
+			return _mm_cvtsd_f64(_mm_shuffle_pd(half, half, I % 2));
+		}
+	};
+
+	template <int I>
+	struct _extract<float,I> {
+		static float apply(const reg r) {
+			const auto half = _mm256_extractf128_ps(r, I / 4);
+			return _mm_cvtss_f32(_mm_shuffle_ps(half, half, _MM_SHUFFLE(0, 0, 0, I % 4)));
+		}
+	};
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <int I>
+	struct _extract<int64_t,I> {
+		static int64_t apply(const reg r) {
+			return (int64_t)_mm_extract_epi64(_mm256_extractf128_si256(_mm256_castps_si256(r), I / 2), I % 2);
+		}
+	};
+#endif
+
+	template <int I>
+	struct _extract<int32_t,I> {
+		static int32_t apply(const reg r) {
+			return (int32_t)_mm_extract_epi32(_mm256_extractf128_si256(_mm256_castps_si256(r), I / 4), I % 4);
+		}
+	};
+
+	template <int I>
+	struct _extract<int16_t,I> {
+		static int16_t apply(const reg r) {
+			return (int16_t)_mm_extract_epi16(_mm256_extractf128_si256(_mm256_castps_si256(r), I / 8), I % 8);
+		}
+	};
+
+	template <int I>
+	struct _extract<int8_t,I> {
+		static int8_t apply(const reg r) {
+			return (int8_t)_mm_extract_epi8(_mm256_extractf128_si256(_mm256_castps_si256(r), I / 16), I % 16);
+		}
+	};
+
+#ifdef __AVX2__
+	// the 32-bit element(s) holding the element 'index' are moved in the first 32-bit element(s) of the register
+	template <>
+	inline double extract<double>(const reg r, const uint32_t index) {
+		const auto i = (int)(index % 4) * 2;
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_setr_epi32(i, i +1, 0, 0)));
+		return _mm_cvtsd_f64(_mm_castps_pd(_mm256_castps256_ps128(p)));
+	}
+
+	template <>
+	inline float extract<float>(const reg r, const uint32_t index) {
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_cvtsi32_si128((int)index)));
+		return _mm_cvtss_f32(_mm256_castps256_ps128(p));
+	}
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <>
+	inline int64_t extract<int64_t>(const reg r, const uint32_t index) {
+		const auto i = (int)(index % 4) * 2;
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_setr_epi32(i, i +1, 0, 0)));
+		return (int64_t)_mm_cvtsi128_si64(_mm_castps_si128(_mm256_castps256_ps128(p)));
+	}
+#endif
+
+	template <>
+	inline int32_t extract<int32_t>(const reg r, const uint32_t index) {
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_cvtsi32_si128((int)index)));
+		return (int32_t)_mm_cvtsi128_si32(_mm_castps_si128(_mm256_castps256_ps128(p)));
+	}
+
+	template <>
+	inline int16_t extract<int16_t>(const reg r, const uint32_t index) {
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_cvtsi32_si128((int)(index / 2))));
+		return (int16_t)(_mm_cvtsi128_si32(_mm_castps_si128(_mm256_castps256_ps128(p))) >> (16 * (index % 2)));
+	}
+
+	template <>
+	inline int8_t extract<int8_t>(const reg r, const uint32_t index) {
+		const auto p = _mm256_permutevar8x32_ps(r, _mm256_castsi128_si256(_mm_cvtsi32_si128((int)(index / 4))));
+		return (int8_t)(_mm_cvtsi128_si32(_mm_castps_si128(_mm256_castps256_ps128(p))) >> (8 * (index % 4)));
+	}
+#endif
+
+	// -------------------------------------------------------------------------------------------------------- permute
+	// the permutations inside the 128-bit lanes are immediate ('vpermilps', 'vpermilpd') or constant in-lane shuffles
+	// ('vpermilps' variable, 'vpshufb'), the lane crossing permutations are 'vpermq' (AVX2) or the blend of the in-lane
+	// shuffles of the register and of its swapped lanes
+	template <int... I>
+	struct _permute<float,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lane(4) ? 1 : P::in_lanes(4) ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+#ifdef __AVX2__
+			return mipp::_permute_shuff<float,I...>(r);
+#else
+			const __m256i c = _mm256_setr_epi32((I % 4)...);
+			const __m256  a = _mm256_permutevar_ps(r, c);
+			const __m256  b = _mm256_permutevar_ps(_mm256_permute2f128_ps(r, r, 0x01), c);
+			constexpr int blend = P::cross(4);
+			return _mm256_blend_ps(a, b, blend);
+#endif
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			constexpr int imm = P::imm(4, 2);
+			return _mm256_permute_ps(r, imm);
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+			return _mm256_permutevar_ps(r, _mm256_setr_epi32((I % 4)...));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int32_t,I...> {
+		static reg apply(const reg r) {
+			return _permute<float,I...>::apply(r);
+		}
+	};
+
+	template <int... I>
+	struct _permute<double,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+#ifdef __AVX2__
+			constexpr int imm = P::imm(4, 2);
+			return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(r), imm));
+#else
+			constexpr int imm = P::odd_bits(), blend = P::cross(2);
+			const __m256d v = _mm256_castps_pd(r);
+			const __m256d a = _mm256_permute_pd(v, imm);
+			if (P::in_lanes(2))
+				return _mm256_castpd_ps(a);
+			const __m256d b = _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x01), imm);
+			return _mm256_castpd_ps(_mm256_blend_pd(a, b, blend));
+#endif
+		}
+	};
+
+	template <int... I>
+	struct _permute<int64_t,I...> {
+		static reg apply(const reg r) {
+			return _permute<double,I...>::apply(r);
+		}
+	};
+
+#ifdef __AVX2__
+	// 'vpshufb' of the register and of its swapped lanes, blended where the elements cross the lanes
+	template <int... I>
+	struct _permute<int16_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			const __m256i v = _mm256_castps_si256(r);
+			const __m256i c = _mm256_setr_epi16((short)(((I % 8) * 2) | (((I % 8) * 2 + 1) << 8))...);
+			const __m256i a = _mm256_shuffle_epi8(v, c);
+			if (P::in_lanes(8))
+				return _mm256_castsi256_ps(a);
+			const __m256i b = _mm256_shuffle_epi8(_mm256_permute2x128_si256(v, v, 0x01), c);
+			const __m256i m = _mm256_cmpeq_epi16(_mm256_setr_epi16((short)(I / 8)...),
+			                                     _mm256_setr_epi16(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1));
+			return _mm256_castsi256_ps(_mm256_blendv_epi8(b, a, m));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int8_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			const __m256i v = _mm256_castps_si256(r);
+			const __m256i c = _mm256_setr_epi8((char)(I % 16)...);
+			const __m256i a = _mm256_shuffle_epi8(v, c);
+			if (P::in_lanes(16))
+				return _mm256_castsi256_ps(a);
+			const __m256i b = _mm256_shuffle_epi8(_mm256_permute2x128_si256(v, v, 0x01), c);
+			const __m256i m = _mm256_cmpeq_epi8(_mm256_setr_epi8((char)(I / 16)...),
+			                                    _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			                                                     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1));
+			return _mm256_castsi256_ps(_mm256_blendv_epi8(b, a, m));
+		}
+	};
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ low
 	template <>
 	inline reg_2 low<double>(const reg v) {
@@ -2164,12 +2515,12 @@
 	// --------------------------------------------------------------------------------------------------------- cmpneq
 	template <>
 	inline msk cmpneq<float>(const reg v1, const reg v2) {
-		return _mm256_castps_si256(_mm256_cmp_ps(v1, v2, _CMP_NEQ_OQ));
+		return _mm256_castps_si256(_mm256_cmp_ps(v1, v2, _CMP_NEQ_UQ));
 	}
 
 	template <>
 	inline msk cmpneq<double>(const reg v1, const reg v2) {
-		return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castps_pd(v1), _mm256_castps_pd(v2), _CMP_NEQ_OQ));
+		return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castps_pd(v1), _mm256_castps_pd(v2), _CMP_NEQ_UQ));
 	}
 
 	template <>
@@ -2225,6 +2576,36 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline msk cmpgt<uint64_t>(const reg v1, const reg v2) {
+		const __m256i bias = _mm256_set1_epi64x((int64_t)0x8000000000000000);
+		return _mm256_cmpgt_epi64(_mm256_xor_si256(_mm256_castps_si256(v1), bias),
+		                          _mm256_xor_si256(_mm256_castps_si256(v2), bias));
+	}
+
+	template <>
+	inline msk cmpgt<uint32_t>(const reg v1, const reg v2) {
+		const __m256i bias = _mm256_set1_epi32((int32_t)0x80000000);
+		return _mm256_cmpgt_epi32(_mm256_xor_si256(_mm256_castps_si256(v1), bias),
+		                          _mm256_xor_si256(_mm256_castps_si256(v2), bias));
+	}
+
+	template <>
+	inline msk cmpgt<uint16_t>(const reg v1, const reg v2) {
+		const __m256i bias = _mm256_set1_epi16((int16_t)0x8000);
+		return _mm256_cmpgt_epi16(_mm256_xor_si256(_mm256_castps_si256(v1), bias),
+		                          _mm256_xor_si256(_mm256_castps_si256(v2), bias));
+	}
+
+	template <>
+	inline msk cmpgt<uint8_t>(const reg v1, const reg v2) {
+		const __m256i bias = _mm256_set1_epi8((int8_t)0x80);
+		return _mm256_cmpgt_epi8(_mm256_xor_si256(_mm256_castps_si256(v1), bias),
+		                         _mm256_xor_si256(_mm256_castps_si256(v2), bias));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmpge
 	template <>
 	inline msk cmpge<float>(const reg v1, const reg v2) {
@@ -2256,6 +2637,26 @@
 		return orb<N<int8_t>()>(cmpeq<int8_t>(v1, v2), cmpgt<int8_t>(v1, v2));
 	}
 
+	template <>
+	inline msk cmpge<uint64_t>(const reg v1, const reg v2) {
+		return orb<N<uint64_t>()>(cmpeq<int64_t>(v1, v2), cmpgt<uint64_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmpge<uint32_t>(const reg v1, const reg v2) {
+		return orb<N<uint32_t>()>(cmpeq<int32_t>(v1, v2), cmpgt<uint32_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmpge<uint16_t>(const reg v1, const reg v2) {
+		return orb<N<uint16_t>()>(cmpeq<int16_t>(v1, v2), cmpgt<uint16_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmpge<uint8_t>(const reg v1, const reg v2) {
+		return orb<N<uint8_t>()>(cmpeq<int8_t>(v1, v2), cmpgt<uint8_t>(v1, v2));
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmple
 	template <>
 	inline msk cmple<float>(const reg v1, const reg v2) {
@@ -2287,6 +2688,26 @@
 		return notb<N<int8_t>()>(cmpgt<int8_t>(v1, v2));
 	}
 
+	template <>
+	inline msk cmple<uint64_t>(const reg v1, const reg v2) {
+		return notb<N<uint64_t>()>(cmpgt<uint64_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmple<uint32_t>(const reg v1, const reg v2) {
+		return notb<N<uint32_t>()>(cmpgt<uint32_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmple<uint16_t>(const reg v1, const reg v2) {
+		return notb<N<uint16_t>()>(cmpgt<uint16_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmple<uint8_t>(const reg v1, const reg v2) {
+		return notb<N<uint8_t>()>(cmpgt<uint8_t>(v1, v2));
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmplt
 	template <>
 	inline msk cmplt<float>(const reg v1, const reg v2) {
@@ -2318,6 +2739,26 @@
 		return cmpgt<int8_t>(v2, v1);
 	}
 
+	template <>
+	inline msk cmplt<uint64_t>(const reg v1, const reg v2) {
+		return cmpgt<uint64_t>(v2, v1);
+	}
+
+	template <>
+	inline msk cmplt<uint32_t>(const reg v1, const reg v2) {
+		return cmpgt<uint32_t>(v2, v1);
+	}
+
+	template <>
+	inline msk cmplt<uint16_t>(const reg v1, const reg v2) {
+		return cmpgt<uint16_t>(v2, v1);
+	}
+
+	template <>
+	inline msk cmplt<uint8_t>(const reg v1, const reg v2) {
+		return cmpgt<uint8_t>(v2, v1);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ add
 	template <>
 	inline reg add<float>(const reg v1, const reg v2) {
@@ -2351,6 +2792,18 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline reg add<uint16_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_adds_epu16(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg add<uint8_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_adds_epu8(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ sub
 	template <>
 	inline reg sub<float>(const reg v1, const reg v2) {
@@ -2384,6 +2837,18 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline reg sub<uint16_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_subs_epu16(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg sub<uint8_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_subs_epu8(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ mul
 	template <>
 	inline reg mul<float>(const reg v1, const reg v2) {
@@ -2446,6 +2911,29 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline reg min<uint64_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(v1), _mm256_castps_si256(v2),
+		                                               mipp::cmpgt<uint64_t>(v1, v2)));
+	}
+
+	template <>
+	inline reg min<uint32_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_min_epu32(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg min<uint16_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_min_epu16(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg min<uint8_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_min_epu8(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ max
 	template <>
 	inline reg max<float>(const reg v1, const reg v2) {
@@ -2474,6 +2962,29 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline reg max<uint64_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(v2), _mm256_castps_si256(v1),
+		                                               mipp::cmpgt<uint64_t>(v1, v2)));
+	}
+
+	template <>
+	inline reg max<uint32_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_max_epu32(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg max<uint16_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_max_epu16(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+
+	template <>
+	inline reg max<uint8_t>(const reg v1, const reg v2) {
+		return _mm256_castsi256_ps(_mm256_max_epu8(_mm256_castps_si256(v1), _mm256_castps_si256(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ msb
 	template <>
 	inline reg msb<float>(const reg v1) {
@@ -2726,6 +3237,11 @@
 		auto v_bis = v;
 		return log256_ps(v_bis);
 	}
+
+	template <>
+	inline reg log<double>(const reg v) {
+		return _mm256_castpd_ps(log256_pd(_mm256_castps_pd(v)));
+	}
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ exp
@@ -2745,6 +3261,11 @@
 		auto v_bis = v;
 		return exp256_ps(v_bis);
 	}
+
+	template <>
+	inline reg exp<double>(const reg v) {
+		return _mm256_castpd_ps(exp256_pd(_mm256_castps_pd(v)));
+	}
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ sin
@@ -2764,6 +3285,11 @@
 		auto v_bis = v;
 		return sin256_ps(v_bis);
 	}
+
+	template <>
+	inline reg sin<double>(const reg v) {
+		return _mm256_castpd_ps(sin256_pd(_mm256_castps_pd(v)));
+	}
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ cos
@@ -2783,6 +3309,11 @@
 		auto v_bis = v;
 		return cos256_ps(v_bis);
 	}
+
+	template <>
+	inline reg cos<double>(const reg v) {
+		return _mm256_castpd_ps(cos256_pd(_mm256_castps_pd(v)));
+	}
 #endif
 
 	// --------------------------------------------------------------------------------------------------------- sincos
@@ -2801,6 +3332,11 @@
 	inline void sincos<float>(const reg x, reg &s, reg &c) {
 		sincos256_ps(x, &s, &c);
 	}
+
+	template <>
+	inline void sincos<double>(const reg x, reg &s, reg &c) {
+		sincos256_pd(_mm256_castps_pd(x), (__m256d*)&s, (__m256d*)&c);
+	}
 #endif
 
 	// ---------------------------------------------------------------------------------------------------------- fmadd
@@ -3284,6 +3820,23 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	template <>
+	inline reg cvt<uint8_t,uint16_t>(const reg_2 v) {
+		return _mm256_castsi256_ps(_mm256_cvtepu8_epi16(_mm_castps_si128(v)));
+	}
+
+	template <>
+	inline reg cvt<uint16_t,uint32_t>(const reg_2 v) {
+		return _mm256_castsi256_ps(_mm256_cvtepu16_epi32(_mm_castps_si128(v)));
+	}
+
+	template <>
+	inline reg cvt<uint32_t,uint64_t>(const reg_2 v) {
+		return _mm256_castsi256_ps(_mm256_cvtepu32_epi64(_mm_castps_si128(v)));
+	}
+#endif
+
 	// ----------------------------------------------------------------------------------------------------------- pack
 #ifdef __AVX2__
 	template <>
@@ -3301,6 +3854,25 @@
 	}
 #endif
 
+#ifdef __AVX2__
+	// 'packus' takes signed inputs, the values are first saturated to the output range
+	template <>
+	inline reg pack<uint32_t,uint16_t>(const reg v1, const reg v2) {
+		const __m256i max = _mm256_set1_epi32(0xFFFF);
+		const __m256i sat1 = _mm256_min_epu32(_mm256_castps_si256(v1), max);
+		const __m256i sat2 = _mm256_min_epu32(_mm256_castps_si256(v2), max);
+		return _mm256_castsi256_ps(_mm256_permute4x64_epi64(_mm256_packus_epi32(sat1, sat2), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+
+	template <>
+	inline reg pack<uint16_t,uint8_t>(const reg v1, const reg v2) {
+		const __m256i max = _mm256_set1_epi16(0xFF);
+		const __m256i sat1 = _mm256_min_epu16(_mm256_castps_si256(v1), max);
+		const __m256i sat2 = _mm256_min_epu16(_mm256_castps_si256(v2), max);
+		return _mm256_castsi256_ps(_mm256_permute4x64_epi64(_mm256_packus_epi16(sat1, sat2), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- testz
 	template <>
 	inline bool testz<float>(const reg v1, const reg v2) {
@@ -3403,6 +3975,83 @@
 		return testz<32>(v1, _mm256_castps_si256(mipp::set1<int8_t>(-1)));
 	}
 
+	// -------------------------------------------------------------------------------------------------------- to_bits
+	template <>
+	inline uint64_t to_bits<4>(const msk m) {
+		return (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(m));
+	}
+
+	template <>
+	inline uint64_t to_bits<8>(const msk m) {
+		return (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(m));
+	}
+
+	template <>
+	inline uint64_t to_bits<16>(const msk m) {
+		const auto packed = _mm_packs_epi16(_mm256_castsi256_si128(m), _mm256_extractf128_si256(m, 1));
+		return (uint64_t)_mm_movemask_epi8(packed);
+	}
+
+	template <>
+	inline uint64_t to_bits<32>(const msk m) {
+#ifdef __AVX2__
+		return (uint64_t)(uint32_t)_mm256_movemask_epi8(m);
+#else
+		return (uint64_t)_mm_movemask_epi8(_mm256_castsi256_si128(m)) |
+		      ((uint64_t)_mm_movemask_epi8(_mm256_extractf128_si256(m, 1)) << 16);
+#endif
+	}
+
+	// ---------------------------------------------------------------------------------------------- compress / expand
+#ifdef __AVX2__
+	// 'vpermd' indexes from the positions given by '_compress_lut' or '_expand_lut', the unused positions are negative
+	// (sign extension of 0xFF) and the corresponding elements are zeroed with a 'blendv'
+	inline reg _permute_or_zero(const reg v, const uint64_t *pos) {
+		const auto idx = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)pos));
+		return _mm256_blendv_ps(_mm256_permutevar8x32_ps(v, idx), _mm256_setzero_ps(), _mm256_castsi256_ps(idx));
+	}
+
+	template <>
+	inline reg compress<double>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<float>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_compress_lut() + to_bits<8>(m));
+	}
+
+	template <>
+	inline reg compress<int64_t>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<int32_t>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_compress_lut() + to_bits<8>(m));
+	}
+
+	template <>
+	inline reg expand<double>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<float>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_expand_lut() + to_bits<8>(m));
+	}
+
+	template <>
+	inline reg expand<int64_t>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<int32_t>(const reg v, const msk m) {
+		return _permute_or_zero(v, mipp::_expand_lut() + to_bits<8>(m));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------ reduction
 	template <red_op<double> OP>
 	struct _reduction<double,OP>
@@ -3591,4 +4240,60 @@
 		}
 	};
 #endif
+
+	// ----------------------------------------------------------------------------------------------------------- scan
+	// the elements that cross the middle of the register come from the low lane moved in the high lane
+#ifdef __AVX2__
+#define MIPP_AVX_SCAN_SHIFT(T)                                                                                         \
+	template <int S>                                                                                                   \
+	struct _scan_shift<T,S>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) {                                                                                \
+			constexpr int B = S * (int)sizeof(T);                                                                      \
+			const __m256i a = _mm256_castps_si256(v);                                                                  \
+			const __m256i l = _mm256_permute2x128_si256(a, a, 0x08); /* (0, low lane of 'a') */                        \
+			return _mm256_castsi256_ps(B <= 16 ? _mm256_alignr_epi8(a, l, (16 - B) & 15)                               \
+			                                   : _mm256_slli_si256 (l, (B - 16) & 15));                                \
+		}                                                                                                              \
+	};
+
+	MIPP_AVX_SCAN_SHIFT(double)
+	MIPP_AVX_SCAN_SHIFT(float)
+	MIPP_AVX_SCAN_SHIFT(int64_t)
+	MIPP_AVX_SCAN_SHIFT(int32_t)
+	MIPP_AVX_SCAN_SHIFT(int16_t)
+	MIPP_AVX_SCAN_SHIFT(int8_t)
+	MIPP_AVX_SCAN_SHIFT(uint64_t)
+	MIPP_AVX_SCAN_SHIFT(uint32_t)
+	MIPP_AVX_SCAN_SHIFT(uint16_t)
+	MIPP_AVX_SCAN_SHIFT(uint8_t)
+
+#undef MIPP_AVX_SCAN_SHIFT
+#endif
+
+	// ------------------------------------------------------------------------------------------------------------ dot
+#ifdef __AVX2__
+	template <>
+	struct _dot_acc<int16_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m256i p = _mm256_madd_epi16(_mm256_castps_si256(a), _mm256_castps_si256(b));
+			return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(acc), p));
+		}
+	};
+
+	// the even and the odd bytes are sign extended in 16-bit elements ('pmaddubsw' multiplies unsigned bytes by signed
+	// bytes and saturates)
+	template <>
+	struct _dot_acc<int8_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m256i ai = _mm256_castps_si256(a), bi = _mm256_castps_si256(b);
+			const __m256i ae = _mm256_srai_epi16(_mm256_slli_epi16(ai, 8), 8), ao = _mm256_srai_epi16(ai, 8);
+			const __m256i be = _mm256_srai_epi16(_mm256_slli_epi16(bi, 8), 8), bo = _mm256_srai_epi16(bi, 8);
+			const __m256i p = _mm256_add_epi32(_mm256_madd_epi16(ae, be), _mm256_madd_epi16(ao, bo));
+			return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(acc), p));
+		}
+	};
+#endif
 #endif
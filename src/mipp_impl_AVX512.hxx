@@ -231,6 +231,222 @@
 	}
 #endif
 
+	// ---------------------------------------------------------------------------------------------------------- mask_n
+	template <>
+	inline msk mask_n<8>(const uint32_t n) {
+		return (msk)(n >= 8 ? 0xFF : (1u << n) -1);
+	}
+
+	template <>
+	inline msk mask_n<16>(const uint32_t n) {
+		return (msk)(n >= 16 ? 0xFFFF : (1u << n) -1);
+	}
+
+#if defined(__AVX512BW__)
+	template <>
+	inline msk mask_n<32>(const uint32_t n) {
+		return (msk)(n >= 32 ? 0xFFFFFFFFu : (1u << n) -1);
+	}
+
+	template <>
+	inline msk mask_n<64>(const uint32_t n) {
+		return (msk)(n >= 64 ? ~0ull : (1ull << n) -1);
+	}
+#endif
+
+	// --------------------------------------------------------------------------------------------------------- loadu_n
+#if defined(__AVX512F__)
+	template <>
+	inline reg loadu_n<float>(const float *mem_addr, const uint32_t n) {
+		return _mm512_maskz_loadu_ps((__mmask16)mask_n<16>(n), mem_addr);
+	}
+
+	template <>
+	inline reg loadu_n<double>(const double *mem_addr, const uint32_t n) {
+		return _mm512_castpd_ps(_mm512_maskz_loadu_pd((__mmask8)mask_n<8>(n), mem_addr));
+	}
+
+	template <>
+	inline reg loadu_n<int64_t>(const int64_t *mem_addr, const uint32_t n) {
+		return _mm512_castsi512_ps(_mm512_maskz_loadu_epi64((__mmask8)mask_n<8>(n), mem_addr));
+	}
+
+	template <>
+	inline reg loadu_n<int32_t>(const int32_t *mem_addr, const uint32_t n) {
+		return _mm512_castsi512_ps(_mm512_maskz_loadu_epi32((__mmask16)mask_n<16>(n), mem_addr));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline reg loadu_n<int16_t>(const int16_t *mem_addr, const uint32_t n) {
+		return _mm512_castsi512_ps(_mm512_maskz_loadu_epi16((__mmask32)mask_n<32>(n), mem_addr));
+	}
+
+	template <>
+	inline reg loadu_n<int8_t>(const int8_t *mem_addr, const uint32_t n) {
+		return _mm512_castsi512_ps(_mm512_maskz_loadu_epi8((__mmask64)mask_n<64>(n), mem_addr));
+	}
+#endif
+
+	// -------------------------------------------------------------------------------------------------------- storeu_n
+#if defined(__AVX512F__)
+	template <>
+	inline void storeu_n<float>(float *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_ps(mem_addr, (__mmask16)mask_n<16>(n), v);
+	}
+
+	template <>
+	inline void storeu_n<double>(double *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_pd(mem_addr, (__mmask8)mask_n<8>(n), _mm512_castps_pd(v));
+	}
+
+	template <>
+	inline void storeu_n<int64_t>(int64_t *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_epi64(mem_addr, (__mmask8)mask_n<8>(n), _mm512_castps_si512(v));
+	}
+
+	template <>
+	inline void storeu_n<int32_t>(int32_t *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_epi32(mem_addr, (__mmask16)mask_n<16>(n), _mm512_castps_si512(v));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline void storeu_n<int16_t>(int16_t *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_epi16(mem_addr, (__mmask32)mask_n<32>(n), _mm512_castps_si512(v));
+	}
+
+	template <>
+	inline void storeu_n<int8_t>(int8_t *mem_addr, const reg v, const uint32_t n) {
+		_mm512_mask_storeu_epi8(mem_addr, (__mmask64)mask_n<64>(n), _mm512_castps_si512(v));
+	}
+#endif
+
+	// --------------------------------------------------------------------------------------------------------- stream
+	// the non-temporal stores require 'mem_addr' to be aligned on 64 bytes (even if 'MIPP_ALIGNED_LOADS' is not defined)
+#if defined(__AVX512F__)
+	template <>
+	inline void stream<float>(float *mem_addr, const reg v) {
+		_mm512_stream_ps(mem_addr, v);
+	}
+
+	template <>
+	inline void stream<double>(double *mem_addr, const reg v) {
+		_mm512_stream_pd(mem_addr, _mm512_castps_pd(v));
+	}
+
+	template <>
+	inline void stream<int64_t>(int64_t *mem_addr, const reg v) {
+		_mm512_stream_si512((__m512i*)mem_addr, _mm512_castps_si512(v));
+	}
+
+	template <>
+	inline void stream<int32_t>(int32_t *mem_addr, const reg v) {
+		_mm512_stream_si512((__m512i*)mem_addr, _mm512_castps_si512(v));
+	}
+
+	template <>
+	inline void stream<int16_t>(int16_t *mem_addr, const reg v) {
+		_mm512_stream_si512((__m512i*)mem_addr, _mm512_castps_si512(v));
+	}
+
+	template <>
+	inline void stream<int8_t>(int8_t *mem_addr, const reg v) {
+		_mm512_stream_si512((__m512i*)mem_addr, _mm512_castps_si512(v));
+	}
+#endif
+
+	// ---------------------------------------------------------------------------------------------------------- gather
+#if defined(__AVX512F__)
+	template <>
+	inline reg gather<double,int64_t>(const double *mem_addr, const reg idx) {
+		return _mm512_castpd_ps(_mm512_i64gather_pd(_mm512_castps_si512(idx), mem_addr, 8));
+	}
+
+	template <>
+	inline reg gather<float,int32_t>(const float *mem_addr, const reg idx) {
+		return _mm512_i32gather_ps(_mm512_castps_si512(idx), mem_addr, 4);
+	}
+
+	template <>
+	inline reg gather<int64_t,int64_t>(const int64_t *mem_addr, const reg idx) {
+		return _mm512_castsi512_ps(_mm512_i64gather_epi64(_mm512_castps_si512(idx), mem_addr, 8));
+	}
+
+	template <>
+	inline reg gather<int32_t,int32_t>(const int32_t *mem_addr, const reg idx) {
+		return _mm512_castsi512_ps(_mm512_i32gather_epi32(_mm512_castps_si512(idx), mem_addr, 4));
+	}
+
+	template <>
+	inline reg gather<double,int64_t>(const msk m, const reg src, const double *mem_addr, const reg idx) {
+		return _mm512_castpd_ps(_mm512_mask_i64gather_pd(_mm512_castps_pd(src), (__mmask8)m, _mm512_castps_si512(idx),
+		                                                 mem_addr, 8));
+	}
+
+	template <>
+	inline reg gather<float,int32_t>(const msk m, const reg src, const float *mem_addr, const reg idx) {
+		return _mm512_mask_i32gather_ps(src, (__mmask16)m, _mm512_castps_si512(idx), mem_addr, 4);
+	}
+
+	template <>
+	inline reg gather<int64_t,int64_t>(const msk m, const reg src, const int64_t *mem_addr, const reg idx) {
+		return _mm512_castsi512_ps(_mm512_mask_i64gather_epi64(_mm512_castps_si512(src), (__mmask8)m,
+		                                                       _mm512_castps_si512(idx), mem_addr, 8));
+	}
+
+	template <>
+	inline reg gather<int32_t,int32_t>(const msk m, const reg src, const int32_t *mem_addr, const reg idx) {
+		return _mm512_castsi512_ps(_mm512_mask_i32gather_epi32(_mm512_castps_si512(src), (__mmask16)m,
+		                                                       _mm512_castps_si512(idx), mem_addr, 4));
+	}
+#endif
+
+	// --------------------------------------------------------------------------------------------------------- scatter
+#if defined(__AVX512F__)
+	template <>
+	inline void scatter<double,int64_t>(double *mem_addr, const reg idx, const reg r) {
+		_mm512_i64scatter_pd(mem_addr, _mm512_castps_si512(idx), _mm512_castps_pd(r), 8);
+	}
+
+	template <>
+	inline void scatter<float,int32_t>(float *mem_addr, const reg idx, const reg r) {
+		_mm512_i32scatter_ps(mem_addr, _mm512_castps_si512(idx), r, 4);
+	}
+
+	template <>
+	inline void scatter<int64_t,int64_t>(int64_t *mem_addr, const reg idx, const reg r) {
+		_mm512_i64scatter_epi64(mem_addr, _mm512_castps_si512(idx), _mm512_castps_si512(r), 8);
+	}
+
+	template <>
+	inline void scatter<int32_t,int32_t>(int32_t *mem_addr, const reg idx, const reg r) {
+		_mm512_i32scatter_epi32(mem_addr, _mm512_castps_si512(idx), _mm512_castps_si512(r), 4);
+	}
+
+	template <>
+	inline void scatter<double,int64_t>(const msk m, double *mem_addr, const reg idx, const reg r) {
+		_mm512_mask_i64scatter_pd(mem_addr, (__mmask8)m, _mm512_castps_si512(idx), _mm512_castps_pd(r), 8);
+	}
+
+	template <>
+	inline void scatter<float,int32_t>(const msk m, float *mem_addr, const reg idx, const reg r) {
+		_mm512_mask_i32scatter_ps(mem_addr, (__mmask16)m, _mm512_castps_si512(idx), r, 4);
+	}
+
+	template <>
+	inline void scatter<int64_t,int64_t>(const msk m, int64_t *mem_addr, const reg idx, const reg r) {
+		_mm512_mask_i64scatter_epi64(mem_addr, (__mmask8)m, _mm512_castps_si512(idx), _mm512_castps_si512(r), 8);
+	}
+
+	template <>
+	inline void scatter<int32_t,int32_t>(const msk m, int32_t *mem_addr, const reg idx, const reg r) {
+		_mm512_mask_i32scatter_epi32(mem_addr, (__mmask16)m, _mm512_castps_si512(idx), _mm512_castps_si512(r), 4);
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmpeq
 	template <>
 	inline msk cmpeq<double>(const reg v1, const reg v2) {
@@ -742,6 +958,238 @@
 #endif
 
 
+	// -------------------------------------------------------------------------------------------------------- extract
+#if defined(__AVX512F__)
+	template <int I>
+	struct _extract<double,I> {
+		static double apply(const reg r) {
+			const auto quarter = _mm_castps_pd(_mm512_extractf32x4_ps(r, I / 2));
+			return _mm_cvtsd_f64(_mm_shuffle_pd(quarter, quarter, I % 2));
+		}
+	};
+
+	template <int I>
+	struct _extract<float,I> {
+		static float apply(const reg r) {
+			const auto quarter = _mm512_extractf32x4_ps(r, I / 4);
+			return _mm_cvtss_f32(_mm_shuffle_ps(quarter, quarter, _MM_SHUFFLE(0, 0, 0, I % 4)));
+		}
+	};
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <int I>
+	struct _extract<int64_t,I> {
+		static int64_t apply(const reg r) {
+			return (int64_t)_mm_extract_epi64(_mm512_extracti32x4_epi32(_mm512_castps_si512(r), I / 2), I % 2);
+		}
+	};
+#endif
+
+	template <int I>
+	struct _extract<int32_t,I> {
+		static int32_t apply(const reg r) {
+			return (int32_t)_mm_extract_epi32(_mm512_extracti32x4_epi32(_mm512_castps_si512(r), I / 4), I % 4);
+		}
+	};
+
+	template <int I>
+	struct _extract<int16_t,I> {
+		static int16_t apply(const reg r) {
+			return (int16_t)_mm_extract_epi16(_mm512_extracti32x4_epi32(_mm512_castps_si512(r), I / 8), I % 8);
+		}
+	};
+
+	template <int I>
+	struct _extract<int8_t,I> {
+		static int8_t apply(const reg r) {
+			return (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(_mm512_castps_si512(r), I / 16), I % 16);
+		}
+	};
+
+	// the element (or the 32-bit element holding the element) 'index' is moved in the first element of the register
+	template <>
+	inline double extract<double>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)index));
+		return _mm_cvtsd_f64(_mm512_castpd512_pd128(_mm512_permutexvar_pd(idx, _mm512_castps_pd(r))));
+	}
+
+	template <>
+	inline float extract<float>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)index));
+		return _mm_cvtss_f32(_mm512_castps512_ps128(_mm512_permutexvar_ps(idx, r)));
+	}
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <>
+	inline int64_t extract<int64_t>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)index));
+		return (int64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(_mm512_permutexvar_epi64(idx, _mm512_castps_si512(r))));
+	}
+#endif
+
+	template <>
+	inline int32_t extract<int32_t>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)index));
+		return (int32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(_mm512_permutexvar_epi32(idx, _mm512_castps_si512(r))));
+	}
+
+	template <>
+	inline int16_t extract<int16_t>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)(index / 2)));
+		const auto p   = _mm512_permutexvar_epi32(idx, _mm512_castps_si512(r));
+		return (int16_t)(_mm_cvtsi128_si32(_mm512_castsi512_si128(p)) >> (16 * (index % 2)));
+	}
+
+	template <>
+	inline int8_t extract<int8_t>(const reg r, const uint32_t index) {
+		const auto idx = _mm512_castsi128_si512(_mm_cvtsi32_si128((int)(index / 4)));
+		const auto p   = _mm512_permutexvar_epi32(idx, _mm512_castps_si512(r));
+		return (int8_t)(_mm_cvtsi128_si32(_mm512_castsi512_si128(p)) >> (8 * (index % 4)));
+	}
+#endif
+
+	// -------------------------------------------------------------------------------------------------------- permute
+	// the patterns repeated in the 128-bit or 256-bit lanes are immediate shuffles, the rotations are 'valignd' /
+	// 'valignq' and the other permutations are the variable 'vpermps' / 'vpermpd'
+#if defined(__AVX512F__)
+	template <int... I>
+	struct _permute<float,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lane(4) ? 1 : P::rotation() ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+			return mipp::_permute_shuff<float,I...>(r);
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			constexpr int imm = P::imm(4, 2);
+			return _mm512_permute_ps(r, imm);
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+			const __m512i v = _mm512_castps_si512(r);
+			constexpr int imm = P::rot();
+			return _mm512_castsi512_ps(_mm512_alignr_epi32(v, v, imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int32_t,I...> {
+		static reg apply(const reg r) {
+			return _permute<float,I...>::apply(r);
+		}
+	};
+
+	template <int... I>
+	struct _permute<double,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lanes(2) ? 1 : P::in_lane(4) ? 2 : P::rotation() ? 3 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+			return mipp::_permute_shuff<double,I...>(r);
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			constexpr int imm = P::odd_bits();
+			return _mm512_castpd_ps(_mm512_permute_pd(_mm512_castps_pd(r), imm));
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+			constexpr int imm = P::imm(4, 2);
+			return _mm512_castpd_ps(_mm512_permutex_pd(_mm512_castps_pd(r), imm));
+		}
+
+		static reg apply(const reg r, _perm_case<3>) {
+			const __m512i v = _mm512_castps_si512(r);
+			constexpr int imm = P::rot();
+			return _mm512_castsi512_ps(_mm512_alignr_epi64(v, v, imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int64_t,I...> {
+		static reg apply(const reg r) {
+			return _permute<double,I...>::apply(r);
+		}
+	};
+#endif
+
+#if defined(__AVX512BW__)
+	// the permutations inside the 128-bit lanes are 'vpshufb', the rotations by multiples of 4 bytes 'valignd'
+	template <int... I>
+	struct _permute<int16_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lanes(8) ? 1 : (P::rotation() && P::rot() % 2 == 0) ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+			return mipp::_permute_shuff<int16_t,I...>(r);
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			static const int16_t c[32] = { (int16_t)(((I % 8) * 2) | (((I % 8) * 2 + 1) << 8))... };
+			return _mm512_castsi512_ps(_mm512_shuffle_epi8(_mm512_castps_si512(r), _mm512_loadu_si512(c)));
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+			const __m512i v = _mm512_castps_si512(r);
+			constexpr int imm = P::rot() / 2;
+			return _mm512_castsi512_ps(_mm512_alignr_epi32(v, v, imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int8_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lanes(16) ? 1 : (P::rotation() && P::rot() % 4 == 0) ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+#if defined(__AVX512VBMI__)
+			return mipp::_permute_shuff<int8_t,I...>(r);
+#else
+			return apply(r, typename _perm_make_seq<32>::type());
+#endif
+		}
+
+		// without 'vpermb': the words holding the even and the odd destination bytes are gathered with 'vpermw', then
+		// 'vpshufb' selects the byte in each word and the two results are blended
+		template <int... K>
+		static reg apply(const reg r, _perm_seq<K...>) {
+			static const int16_t we[32] = { (int16_t)(P::get(2 * K    ) / 2)... };
+			static const int16_t wo[32] = { (int16_t)(P::get(2 * K + 1) / 2)... };
+			static const int16_t c [32] = { (int16_t)(((2 * K) % 16 | (P::get(2 * K) & 1)) |
+			                                          (((2 * K) % 16 | (P::get(2 * K + 1) & 1)) << 8))... };
+			const __m512i v  = _mm512_castps_si512(r);
+			const __m512i vc = _mm512_loadu_si512(c);
+			const __m512i e  = _mm512_shuffle_epi8(_mm512_permutexvar_epi16(_mm512_loadu_si512(we), v), vc);
+			const __m512i o  = _mm512_shuffle_epi8(_mm512_permutexvar_epi16(_mm512_loadu_si512(wo), v), vc);
+			return _mm512_castsi512_ps(_mm512_mask_blend_epi8((__mmask64)0xAAAAAAAAAAAAAAAAULL, e, o));
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			static const int8_t c[64] = { (int8_t)(I % 16)... };
+			return _mm512_castsi512_ps(_mm512_shuffle_epi8(_mm512_castps_si512(r), _mm512_loadu_si512(c)));
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+			const __m512i v = _mm512_castps_si512(r);
+			constexpr int imm = P::rot() / 4;
+			return _mm512_castsi512_ps(_mm512_alignr_epi32(v, v, imm));
+		}
+	};
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ low
 #if defined(__AVX512F__)
 	template <>
@@ -2385,12 +2833,12 @@
 	// --------------------------------------------------------------------------------------------------------- cmpneq
 	template <>
 	inline msk cmpneq<double>(const reg v1, const reg v2) {
-		return (msk) _mm512_cmp_pd_mask(_mm512_castps_pd(v1), _mm512_castps_pd(v2), _CMP_NEQ_OQ);
+		return (msk) _mm512_cmp_pd_mask(_mm512_castps_pd(v1), _mm512_castps_pd(v2), _CMP_NEQ_UQ);
 	}
 
 	template <>
 	inline msk cmpneq<float>(const reg v1, const reg v2) {
-		return (msk) _mm512_cmp_ps_mask(v1, v2, _CMP_NEQ_OQ);
+		return (msk) _mm512_cmp_ps_mask(v1, v2, _CMP_NEQ_UQ);
 	}
 
 #if defined(__AVX512F__)
@@ -2452,6 +2900,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline msk cmplt<uint64_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmplt_epu64_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmplt<uint32_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmplt_epu32_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline msk cmplt<uint16_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmplt_epu16_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmplt<uint8_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmplt_epu8_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmple
 	template <>
 	inline msk cmple<double>(const reg v1, const reg v2) {
@@ -2487,6 +2959,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline msk cmple<uint64_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmple_epu64_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmple<uint32_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmple_epu32_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline msk cmple<uint16_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmple_epu16_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmple<uint8_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmple_epu8_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmpgt
 	template <>
 	inline msk cmpgt<double>(const reg v1, const reg v2) {
@@ -2522,6 +3018,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline msk cmpgt<uint64_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpgt_epu64_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmpgt<uint32_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpgt_epu32_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline msk cmpgt<uint16_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpgt_epu16_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmpgt<uint8_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpgt_epu8_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmpge
 	template <>
 	inline msk cmpge<double>(const reg v1, const reg v2) {
@@ -2557,6 +3077,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline msk cmpge<uint64_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpge_epu64_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmpge<uint32_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpge_epu32_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline msk cmpge<uint16_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpge_epu16_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+
+	template <>
+	inline msk cmpge<uint8_t>(const reg v1, const reg v2) {
+		return (msk) _mm512_cmpge_epu8_mask(_mm512_castps_si512(v1), _mm512_castps_si512(v2));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ add
 	// ------------------ double
 	template <>
@@ -2724,6 +3268,20 @@
 	}
 #endif
 
+#if defined(__AVX512BW__)
+	// ------------------ uint16
+	template <>
+	inline reg add<uint16_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_adds_epu16(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	// ------------------ uint8
+	template <>
+	inline reg add<uint8_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_adds_epu8(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ sub
 	template <>
 	inline reg sub<double>(const reg v1, const reg v2) {
@@ -2759,6 +3317,20 @@
 	}
 #endif
 
+#if defined(__AVX512BW__)
+	// ------------------ uint16
+	template <>
+	inline reg sub<uint16_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_subs_epu16(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	// ------------------ uint8
+	template <>
+	inline reg sub<uint8_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_subs_epu8(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ mul
 	template <>
 	inline reg mul<double>(const reg v1, const reg v2) {
@@ -2841,6 +3413,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline reg min<uint64_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_min_epu64(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	template <>
+	inline reg min<uint32_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_min_epu32(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline reg min<uint16_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_min_epu16(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	template <>
+	inline reg min<uint8_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_min_epu8(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ max
 #if defined(__AVX512F__)
 	template <>
@@ -2887,6 +3483,30 @@
 	}
 #endif
 
+#if defined(__AVX512F__)
+	template <>
+	inline reg max<uint64_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_max_epu64(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	template <>
+	inline reg max<uint32_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_max_epu32(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline reg max<uint16_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_max_epu16(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+
+	template <>
+	inline reg max<uint8_t>(const reg v1, const reg v2) {
+		return _mm512_castsi512_ps(_mm512_max_epu8(_mm512_castps_si512(v1), _mm512_castps_si512(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ msb
 	template <>
 	inline reg msb<double>(const reg v1) {
@@ -3195,6 +3815,11 @@
 		auto v_bis = v;
 		return log512_ps(v_bis);
 	}
+
+	template <>
+	inline reg log<double>(const reg v) {
+		return _mm512_castpd_ps(log512_pd(_mm512_castps_pd(v)));
+	}
 #endif
 #endif
 
@@ -3216,6 +3841,11 @@
 		auto v_bis = v;
 		return exp512_ps(v_bis);
 	}
+
+	template <>
+	inline reg exp<double>(const reg v) {
+		return _mm512_castpd_ps(exp512_pd(_mm512_castps_pd(v)));
+	}
 #endif
 #endif
 
@@ -3237,6 +3867,11 @@
 		auto v_bis = v;
 		return sin512_ps(v_bis);
 	}
+
+	template <>
+	inline reg sin<double>(const reg v) {
+		return _mm512_castpd_ps(sin512_pd(_mm512_castps_pd(v)));
+	}
 #endif
 #endif
 
@@ -3258,6 +3893,11 @@
 		auto v_bis = v;
 		return cos512_ps(v_bis);
 	}
+
+	template <>
+	inline reg cos<double>(const reg v) {
+		return _mm512_castpd_ps(cos512_pd(_mm512_castps_pd(v)));
+	}
 #endif
 #endif
 
@@ -3278,6 +3918,11 @@
 	inline void sincos<float>(const reg x, reg &s, reg &c) {
 		sincos512_ps(x, &s, &c);
 	}
+
+	template <>
+	inline void sincos<double>(const reg x, reg &s, reg &c) {
+		sincos512_pd(_mm512_castps_pd(x), (__m512d*)&s, (__m512d*)&c);
+	}
 #endif
 #endif
 
@@ -3644,6 +4289,25 @@
 	}
 #endif
 
+#ifdef __AVX512F__
+	template <>
+	inline reg cvt<uint16_t,uint32_t>(const reg_2 v) {
+		return _mm512_castsi512_ps(_mm512_cvtepu16_epi32(_mm256_castps_si256(v)));
+	}
+
+	template <>
+	inline reg cvt<uint32_t,uint64_t>(const reg_2 v) {
+		return _mm512_castsi512_ps(_mm512_cvtepu32_epi64(_mm256_castps_si256(v)));
+	}
+#endif
+
+#ifdef __AVX512BW__
+	template <>
+	inline reg cvt<uint8_t,uint16_t>(const reg_2 v) {
+		return _mm512_castsi512_ps(_mm512_cvtepu8_epi16(_mm256_castps_si256(v)));
+	}
+#endif
+
 	// ----------------------------------------------------------------------------------------------------------- pack
 #ifdef __AVX512BW__
 	template <>
@@ -3661,6 +4325,27 @@
 	}
 #endif
 
+#ifdef __AVX512BW__
+	// 'packus' takes signed inputs, the values are first saturated to the output range
+	template <>
+	inline reg pack<uint32_t,uint16_t>(const reg v1, const reg v2) {
+		auto mask =_mm512_set_epi64(7,5,3,1,6,4,2,0);
+		auto max = _mm512_set1_epi32(0xFFFF);
+		auto sat1 = _mm512_min_epu32(_mm512_castps_si512(v1), max);
+		auto sat2 = _mm512_min_epu32(_mm512_castps_si512(v2), max);
+		return _mm512_castsi512_ps(_mm512_permutexvar_epi64(mask, _mm512_packus_epi32(sat1, sat2)));
+	}
+
+	template <>
+	inline reg pack<uint16_t,uint8_t>(const reg v1, const reg v2) {
+		auto mask =_mm512_set_epi64(7,5,3,1,6,4,2,0);
+		auto max = _mm512_set1_epi16(0xFF);
+		auto sat1 = _mm512_min_epu16(_mm512_castps_si512(v1), max);
+		auto sat2 = _mm512_min_epu16(_mm512_castps_si512(v2), max);
+		return _mm512_castsi512_ps(_mm512_permutexvar_epi64(mask, _mm512_packus_epi16(sat1, sat2)));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- testz
 #if defined(__AVX512F__) || defined(__MIC__) || defined(__KNCNI__)
 	template <>
@@ -3767,6 +4452,101 @@
 	}
 #endif
 
+	// -------------------------------------------------------------------------------------------------------- to_bits
+	// the masks are already bit masks, the other bits of the 'k' register are cleared. The 'k' register is read with
+	// 'kmov' (and not with a plain integer conversion): GCC 12 can spill a zero-extended 8-bit mask with 'kmovb' and
+	// reload it as a 64-bit integer, the upper bits are then garbage
+#if defined(__AVX512F__)
+	template <>
+	inline uint64_t to_bits<8>(const msk m) {
+		return (uint64_t)(_cvtmask16_u32((__mmask16)m) & 0xFF);
+	}
+
+	template <>
+	inline uint64_t to_bits<16>(const msk m) {
+		return (uint64_t)_cvtmask16_u32((__mmask16)m);
+	}
+#endif
+
+#if defined(__AVX512BW__)
+	template <>
+	inline uint64_t to_bits<32>(const msk m) {
+		return (uint64_t)_cvtmask32_u32((__mmask32)m);
+	}
+
+	template <>
+	inline uint64_t to_bits<64>(const msk m) {
+		return (uint64_t)m;
+	}
+#endif
+
+	// ---------------------------------------------------------------------------------------------- compress / expand
+	// the register versions are used ('compress_store' is built with a masked store), the memory versions of
+	// 'vcompress' are very slow on some CPUs
+#if defined(__AVX512F__)
+	template <>
+	inline reg compress<double>(const reg v, const msk m) {
+		return _mm512_castpd_ps(_mm512_maskz_compress_pd((__mmask8)m, _mm512_castps_pd(v)));
+	}
+
+	template <>
+	inline reg compress<float>(const reg v, const msk m) {
+		return _mm512_maskz_compress_ps((__mmask16)m, v);
+	}
+
+	template <>
+	inline reg compress<int64_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_compress_epi64((__mmask8)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg compress<int32_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_compress_epi32((__mmask16)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg expand<double>(const reg v, const msk m) {
+		return _mm512_castpd_ps(_mm512_maskz_expand_pd((__mmask8)m, _mm512_castps_pd(v)));
+	}
+
+	template <>
+	inline reg expand<float>(const reg v, const msk m) {
+		return _mm512_maskz_expand_ps((__mmask16)m, v);
+	}
+
+	template <>
+	inline reg expand<int64_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_expand_epi64((__mmask8)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg expand<int32_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_expand_epi32((__mmask16)m, _mm512_castps_si512(v)));
+	}
+#endif
+
+#if defined(__AVX512VBMI2__)
+	template <>
+	inline reg compress<int16_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_compress_epi16((__mmask32)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg compress<int8_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_compress_epi8((__mmask64)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg expand<int16_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_expand_epi16((__mmask32)m, _mm512_castps_si512(v)));
+	}
+
+	template <>
+	inline reg expand<int8_t>(const reg v, const msk m) {
+		return _mm512_castsi512_ps(_mm512_maskz_expand_epi8((__mmask64)m, _mm512_castps_si512(v)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------ reduction
 #if defined(__AVX512F__)
 	template <red_op<double> OP>
@@ -3985,4 +4765,101 @@
 #endif
 #endif
 
+	// ----------------------------------------------------------------------------------------------------------- scan
+	// 'valignd' shifts the whole register by 4-byte elements, the 1-byte and 2-byte shifts combine 'valignd' and the
+	// per lane 'vpalignr'
+#if defined(__AVX512F__)
+#define MIPP_AVX512_SCAN_SHIFT(T)                                                                                      \
+	template <int S>                                                                                                   \
+	struct _scan_shift<T,S>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) {                                                                                \
+			constexpr int B = S * (int)sizeof(T);                                                                      \
+			const __m512i a = _mm512_castps_si512(v);                                                                  \
+			return _mm512_castsi512_ps(_mm512_alignr_epi32(a, _mm512_setzero_si512(), (16 - B / 4) & 15));             \
+		}                                                                                                              \
+	};
+
+	MIPP_AVX512_SCAN_SHIFT(double)
+	MIPP_AVX512_SCAN_SHIFT(float)
+	MIPP_AVX512_SCAN_SHIFT(int64_t)
+	MIPP_AVX512_SCAN_SHIFT(int32_t)
+	MIPP_AVX512_SCAN_SHIFT(uint64_t)
+	MIPP_AVX512_SCAN_SHIFT(uint32_t)
+
+#undef MIPP_AVX512_SCAN_SHIFT
+#endif
+
+#if defined(__AVX512BW__)
+#define MIPP_AVX512BW_SCAN_SHIFT(T)                                                                                    \
+	template <int S>                                                                                                   \
+	struct _scan_shift<T,S>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) {                                                                                \
+			constexpr int B = S * (int)sizeof(T);                                                                      \
+			const __m512i a = _mm512_castps_si512(v);                                                                  \
+			const __m512i l = _mm512_alignr_epi32(a, _mm512_setzero_si512(), (16 - B / 4) & 15);                       \
+			if (B % 4 == 0)                                                                                            \
+				return _mm512_castsi512_ps(l);                                                                         \
+			const __m512i p = _mm512_alignr_epi32(a, _mm512_setzero_si512(), 12); /* lanes shifted by one */           \
+			return _mm512_castsi512_ps(_mm512_alignr_epi8(a, p, (16 - B) & 15));                                       \
+		}                                                                                                              \
+	};
+
+	MIPP_AVX512BW_SCAN_SHIFT(int16_t)
+	MIPP_AVX512BW_SCAN_SHIFT(int8_t)
+	MIPP_AVX512BW_SCAN_SHIFT(uint16_t)
+	MIPP_AVX512BW_SCAN_SHIFT(uint8_t)
+
+#undef MIPP_AVX512BW_SCAN_SHIFT
+#endif
+
+	// ------------------------------------------------------------------------------------------------------------ dot
+#if defined(__AVX512BW__)
+#if defined(__AVX512VNNI__)
+	template <>
+	struct _dot_acc<int16_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			return _mm512_castsi512_ps(_mm512_dpwssd_epi32(_mm512_castps_si512(acc), _mm512_castps_si512(a),
+			                                               _mm512_castps_si512(b)));
+		}
+	};
+
+	// 'vpdpbusd' multiplies unsigned bytes by signed bytes: 'a + 128' is multiplied by 'b' then '128 * b' is subtracted
+	// (no saturation)
+	template <>
+	struct _dot_acc<int8_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m512i ai = _mm512_castps_si512(a), bi = _mm512_castps_si512(b), o = _mm512_set1_epi8((char)0x80);
+			const __m512i p = _mm512_dpbusd_epi32(_mm512_castps_si512(acc), _mm512_xor_si512(ai, o), bi);
+			return _mm512_castsi512_ps(_mm512_sub_epi32(p, _mm512_dpbusd_epi32(_mm512_setzero_si512(), o, bi)));
+		}
+	};
+#else
+	template <>
+	struct _dot_acc<int16_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m512i p = _mm512_madd_epi16(_mm512_castps_si512(a), _mm512_castps_si512(b));
+			return _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(acc), p));
+		}
+	};
+
+	// the even and the odd bytes are sign extended in 16-bit elements ('pmaddubsw' multiplies unsigned bytes by signed
+	// bytes and saturates)
+	template <>
+	struct _dot_acc<int8_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m512i ai = _mm512_castps_si512(a), bi = _mm512_castps_si512(b);
+			const __m512i ae = _mm512_srai_epi16(_mm512_slli_epi16(ai, 8), 8), ao = _mm512_srai_epi16(ai, 8);
+			const __m512i be = _mm512_srai_epi16(_mm512_slli_epi16(bi, 8), 8), bo = _mm512_srai_epi16(bi, 8);
+			const __m512i p = _mm512_add_epi32(_mm512_madd_epi16(ae, be), _mm512_madd_epi16(ao, bo));
+			return _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(acc), p));
+		}
+	};
+#endif
+#endif
 #endif
@@ -0,0 +1,794 @@
+#include "mipp.h"
+
+// ----------------------------------------------------------------------------------------------------------- EMULATED
+// --------------------------------------------------------------------------------------------------------------------
+#if defined(MIPP_EMU)
+
+	// The registers are byte arrays and the operations are scalar loops over their elements: this is slow but it runs
+	// on any host with the number of elements of the wide instruction sets. The transpositions, the reductions, the
+	// interleavings... of the 512-bit (and 1024-bit) registers can be validated on a machine without AVX-512. The
+	// semantics are the ones of the x86 instructions: the 8-bit and 16-bit additions and subtractions saturate, the
+	// other integer operations wrap around, the interleavings work on the full register and the out of range
+	// conversions give the "integer indefinite" value.
+
+	// ------------------------------------------------------------------------------------------------------ utilities
+	// unsigned integer of the size of 'T', the wrapping arithmetic and the shifts are computed on it
+	template <typename T> struct _emu_uint         { using type = typename std::make_unsigned<T>::type; };
+	template <>           struct _emu_uint<double> { using type = uint64_t; };
+	template <>           struct _emu_uint<float > { using type = uint32_t; };
+
+	template <typename T>
+	using _emu_u = typename _emu_uint<T>::type;
+
+	template <typename T, typename R>
+	inline T _emu_get(const R &r, const int i) {
+		T v;
+		std::memcpy(&v, r.b.data() + i * sizeof(T), sizeof(T));
+		return v;
+	}
+
+	template <typename T, typename R>
+	inline void _emu_put(R &r, const int i, const T v) {
+		std::memcpy(r.b.data() + i * sizeof(T), &v, sizeof(T));
+	}
+
+	// element 'i' of a mask of 'T' elements (an element is set when all its bits are set)
+	template <typename T>
+	inline bool _emu_bit(const msk m, const int i) {
+		return m.b[i * sizeof(T)] != 0;
+	}
+
+	// element 'i' of a mask of 'N' elements
+	template <int N>
+	inline bool _emu_bitn(const msk m, const int i) {
+		return m.b[i * (sizeof(msk) / N)] != 0;
+	}
+
+	template <int N>
+	inline void _emu_putn(msk &m, const int i, const bool v) {
+		std::memset(m.b.data() + i * (sizeof(msk) / N), v ? 0xFF : 0x00, sizeof(msk) / N);
+	}
+
+	// 'r[i] = f(v[i])'
+	template <typename T, typename F>
+	inline reg _emu_map(const reg v, F f) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, (T)f(_emu_get<T>(v, i)));
+		return r;
+	}
+
+	// 'r[i] = f(v1[i], v2[i])'
+	template <typename T, typename F>
+	inline reg _emu_map(const reg v1, const reg v2, F f) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, (T)f(_emu_get<T>(v1, i), _emu_get<T>(v2, i)));
+		return r;
+	}
+
+	// 'r[i] = f(v1[i], v2[i], v3[i])'
+	template <typename T, typename F>
+	inline reg _emu_map(const reg v1, const reg v2, const reg v3, F f) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, (T)f(_emu_get<T>(v1, i), _emu_get<T>(v2, i), _emu_get<T>(v3, i)));
+		return r;
+	}
+
+	// 'm[i] = f(v1[i], v2[i])'
+	template <typename T, typename F>
+	inline msk _emu_cmp(const reg v1, const reg v2, F f) {
+		msk m;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_putn<nElReg<T>()>(m, i, f(_emu_get<T>(v1, i), _emu_get<T>(v2, i)));
+		return m;
+	}
+
+	// 'r[i] = v1v2[f(i)]' where 'v1v2' is the concatenation of 'v1' and 'v2'
+	template <typename T, typename F>
+	inline reg _emu_perm(const reg v1, const reg v2, F f) {
+		constexpr int n = nElReg<T>();
+		reg r;
+		for (auto i = 0; i < n; i++) {
+			const int j = f(i);
+			_emu_put<T>(r, i, j < n ? _emu_get<T>(v1, j) : _emu_get<T>(v2, j - n));
+		}
+		return r;
+	}
+
+	// bitwise operations, the registers and the masks are processed byte per byte
+	template <typename R, typename F>
+	inline R _emu_bytes(const R v1, const R v2, F f) {
+		R r;
+		for (size_t i = 0; i < r.b.size(); i++)
+			r.b[i] = (uint8_t)f(v1.b[i], v2.b[i]);
+		return r;
+	}
+
+	template <typename R>
+	inline bool _emu_zero(const R v) {
+		for (size_t i = 0; i < v.b.size(); i++)
+			if (v.b[i])
+				return false;
+		return true;
+	}
+
+	// 'v' clamped to the range of 'T'
+	template <typename T, typename TW>
+	inline T _emu_sat(const TW v) {
+		return (T)std::min<TW>(std::max<TW>(v, (TW)std::numeric_limits<T>::min()), (TW)std::numeric_limits<T>::max());
+	}
+
+	// 'v' rounded to the nearest integer, the out of range values and the NaNs give the "integer indefinite" value
+	template <typename TI, typename TF>
+	inline TI _emu_round_to(const TF v) {
+		const TF r = std::nearbyint(v);
+		const TF lo = (TF)std::numeric_limits<TI>::min();
+		return (r >= lo && r < -lo) ? (TI)r : std::numeric_limits<TI>::min();
+	}
+
+	// ---------------------------------------------------------------------------------------------- scalar arithmetic
+	// wrapping integer arithmetic, computed on the unsigned integers (no signed overflow)
+	template <typename T>
+	inline T _emu_wadd(const T a, const T b) {
+		return (T)(_emu_u<T>)((uint64_t)(_emu_u<T>)a + (uint64_t)(_emu_u<T>)b);
+	}
+
+	template <typename T>
+	inline T _emu_wsub(const T a, const T b) {
+		return (T)(_emu_u<T>)((uint64_t)(_emu_u<T>)a - (uint64_t)(_emu_u<T>)b);
+	}
+
+	template <typename T>
+	inline T _emu_mul(const T a, const T b) {
+		return (T)(_emu_u<T>)((uint64_t)(_emu_u<T>)a * (uint64_t)(_emu_u<T>)b);
+	}
+
+	inline double _emu_mul(const double a, const double b) { return a * b; }
+	inline float  _emu_mul(const float  a, const float  b) { return a * b; }
+
+	template <typename T>
+	inline T _emu_neg(const T a) {
+		return _emu_wsub<T>((T)0, a);
+	}
+
+	inline double _emu_neg(const double a) { return -a; }
+	inline float  _emu_neg(const float  a) { return -a; }
+
+	template <typename T>
+	inline T _emu_abs(const T a) {
+		return a < (T)0 ? _emu_neg(a) : a;
+	}
+
+	inline double _emu_abs(const double a) { return std::fabs(a); }
+	inline float  _emu_abs(const float  a) { return std::fabs(a); }
+
+	inline double   _emu_add(const double   a, const double   b) { return a + b;                                 }
+	inline float    _emu_add(const float    a, const float    b) { return a + b;                                 }
+	inline int64_t  _emu_add(const int64_t  a, const int64_t  b) { return _emu_wadd(a, b);                       }
+	inline int32_t  _emu_add(const int32_t  a, const int32_t  b) { return _emu_wadd(a, b);                       }
+	inline int16_t  _emu_add(const int16_t  a, const int16_t  b) { return _emu_sat<int16_t >((int32_t)a + b);    }
+	inline int8_t   _emu_add(const int8_t   a, const int8_t   b) { return _emu_sat<int8_t  >((int32_t)a + b);    }
+	inline uint16_t _emu_add(const uint16_t a, const uint16_t b) { return _emu_sat<uint16_t>((int32_t)a + b);    }
+	inline uint8_t  _emu_add(const uint8_t  a, const uint8_t  b) { return _emu_sat<uint8_t >((int32_t)a + b);    }
+
+	inline double   _emu_sub(const double   a, const double   b) { return a - b;                                 }
+	inline float    _emu_sub(const float    a, const float    b) { return a - b;                                 }
+	inline int64_t  _emu_sub(const int64_t  a, const int64_t  b) { return _emu_wsub(a, b);                       }
+	inline int32_t  _emu_sub(const int32_t  a, const int32_t  b) { return _emu_wsub(a, b);                       }
+	inline int16_t  _emu_sub(const int16_t  a, const int16_t  b) { return _emu_sat<int16_t >((int32_t)a - b);    }
+	inline int8_t   _emu_sub(const int8_t   a, const int8_t   b) { return _emu_sat<int8_t  >((int32_t)a - b);    }
+	inline uint16_t _emu_sub(const uint16_t a, const uint16_t b) { return _emu_sat<uint16_t>((int32_t)a - b);    }
+	inline uint8_t  _emu_sub(const uint8_t  a, const uint8_t  b) { return _emu_sat<uint8_t >((int32_t)a - b);    }
+
+	// ------------------------------------------------------------------------------------------- lane-wise operations
+	template <typename T>
+	inline reg _emu_loadu(const T *mem_addr) {
+		reg r;
+		std::memcpy(r.b.data(), mem_addr, sizeof(reg));
+		return r;
+	}
+
+	template <typename T>
+	inline reg _emu_load(const T *mem_addr) {
+		// same constraint as the real instruction sets: catches the misaligned accesses of the wide registers
+		assert(isAligned(mem_addr));
+		return _emu_loadu<T>(mem_addr);
+	}
+
+	template <typename T>
+	inline void _emu_storeu(T *mem_addr, const reg v) {
+		std::memcpy(mem_addr, v.b.data(), sizeof(reg));
+	}
+
+	template <typename T>
+	inline void _emu_store(T *mem_addr, const reg v) {
+		assert(isAligned(mem_addr));
+		_emu_storeu<T>(mem_addr, v);
+	}
+
+	template <typename T>
+	inline reg _emu_set1(const T val) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, val);
+		return r;
+	}
+
+	inline reg _emu_set0() {
+		reg r;
+		r.b.fill(0);
+		return r;
+	}
+
+	inline reg_2 _emu_low(const reg v) {
+		reg_2 r;
+		std::memcpy(r.b.data(), v.b.data(), sizeof(reg_2));
+		return r;
+	}
+
+	inline reg_2 _emu_high(const reg v) {
+		reg_2 r;
+		std::memcpy(r.b.data(), v.b.data() + sizeof(reg_2), sizeof(reg_2));
+		return r;
+	}
+
+	inline reg _emu_combine(const reg_2 v1, const reg_2 v2) {
+		reg r;
+		std::memcpy(r.b.data(),                 v1.b.data(), sizeof(reg_2));
+		std::memcpy(r.b.data() + sizeof(reg_2), v2.b.data(), sizeof(reg_2));
+		return r;
+	}
+
+	// the 'K' blocks of the register get the same 'nElReg<T>() / K' indexes
+	template <typename T, int K>
+	inline reg _emu_cmask(const uint32_t *val) {
+		using TI = typename std::make_signed<_emu_u<T>>::type;
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<TI>(r, i, (TI)val[i % (nElReg<T>() / K)]);
+		return r;
+	}
+
+	// the shuffles are done inside the 'K' blocks of the register
+	template <typename T, int K>
+	inline reg _emu_shuff(const reg v, const reg cm) {
+		constexpr int s = nElReg<T>() / K;
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, _emu_get<T>(v, (i / s) * s + (int)(_emu_get<_emu_u<T>>(cm, i) % s)));
+		return r;
+	}
+
+	// interleaves the low ('H = 0') or the high ('H = 1') halves of the 'K' blocks of 'v1' and 'v2'
+	template <typename T, int K, int H>
+	inline reg _emu_interleave(const reg v1, const reg v2) {
+		return _emu_perm<T>(v1, v2, [](const int i) {
+			constexpr int s = nElReg<T>() / K;
+			return (i / s) * s + H * (s / 2) + (i % s) / 2 + (i % 2) * nElReg<T>();
+		});
+	}
+
+	template <typename T>
+	inline regx2 _emu_deinterleave(const reg v1, const reg v2) {
+		regx2 r;
+		r.val[0] = _emu_perm<T>(v1, v2, [](const int i) { return 2 * i;     });
+		r.val[1] = _emu_perm<T>(v1, v2, [](const int i) { return 2 * i + 1; });
+		return r;
+	}
+
+	template <typename T>
+	inline regx2 _emu_interleavex2(const reg v1, const reg v2) {
+		regx2 r;
+		r.val[0] = _emu_perm<T>(v1, v2, [](const int i) { return i < nElReg<T>() / 2 ? i : i + nElReg<T>() / 2;  });
+		r.val[1] = _emu_perm<T>(v1, v2, [](const int i) { return i < nElReg<T>() / 2 ? i + nElReg<T>() / 2 :
+		                                                                               i + nElReg<T>();          });
+		return r;
+	}
+
+	// transposes the 'K' matrices of 'nElReg<T>() / K' x 'nElReg<T>() / K' elements stored in the blocks of 'tab'
+	template <typename T, int K>
+	inline void _emu_transpose(reg tab[nElReg<T>() / K]) {
+		constexpr int s = nElReg<T>() / K;
+		reg res[s];
+		for (auto k = 0; k < K; k++)
+			for (auto i = 0; i < s; i++)
+				for (auto j = 0; j < s; j++)
+					_emu_put<T>(res[i], k * s + j, _emu_get<T>(tab[j], k * s + i));
+		for (auto i = 0; i < s; i++)
+			tab[i] = res[i];
+	}
+
+	template <typename T>
+	inline reg _emu_lshift(const reg v, const uint32_t n) {
+		return _emu_map<_emu_u<T>>(v, [n](const _emu_u<T> a) {
+			return n < sizeof(T) * 8 ? (_emu_u<T>)(a << n) : (_emu_u<T>)0;
+		});
+	}
+
+	template <typename T>
+	inline reg _emu_rshift(const reg v, const uint32_t n) {
+		return _emu_map<_emu_u<T>>(v, [n](const _emu_u<T> a) {
+			return n < sizeof(T) * 8 ? (_emu_u<T>)(a >> n) : (_emu_u<T>)0;
+		});
+	}
+
+	template <typename T>
+	inline reg _emu_lshiftr(const reg v1, const reg v2) {
+		return _emu_map<_emu_u<T>>(v1, v2, [](const _emu_u<T> a, const _emu_u<T> n) {
+			return n < sizeof(T) * 8 ? (_emu_u<T>)(a << n) : (_emu_u<T>)0;
+		});
+	}
+
+	template <typename T>
+	inline reg _emu_rshiftr(const reg v1, const reg v2) {
+		return _emu_map<_emu_u<T>>(v1, v2, [](const _emu_u<T> a, const _emu_u<T> n) {
+			return n < sizeof(T) * 8 ? (_emu_u<T>)(a >> n) : (_emu_u<T>)0;
+		});
+	}
+
+	template <typename T>
+	inline reg _emu_msb(const reg v) {
+		return _emu_map<_emu_u<T>>(v, [](const _emu_u<T> a) {
+			return (_emu_u<T>)(a & ((_emu_u<T>)1 << (sizeof(T) * 8 -1)));
+		});
+	}
+
+	// 'v1' is negated where the sign bit of 'v2' is set
+	template <typename T>
+	inline reg _emu_neg(const reg v1, const reg v2) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, (_emu_get<_emu_u<T>>(v2, i) >> (sizeof(T) * 8 -1)) ? _emu_neg(_emu_get<T>(v1, i))
+			                                                                     :          _emu_get<T>(v1, i));
+		return r;
+	}
+
+	template <typename T>
+	inline reg _emu_neg(const reg v, const msk m) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, _emu_bit<T>(m, i) ? _emu_neg(_emu_get<T>(v, i)) : _emu_get<T>(v, i));
+		return r;
+	}
+
+	template <typename T>
+	inline reg _emu_blend(const reg v1, const reg v2, const msk m) {
+		reg r;
+		for (auto i = 0; i < nElReg<T>(); i++)
+			_emu_put<T>(r, i, _emu_bit<T>(m, i) ? _emu_get<T>(v1, i) : _emu_get<T>(v2, i));
+		return r;
+	}
+
+	template <typename T>
+	inline reg _emu_compress(const reg v, const msk m) {
+		reg r = _emu_set0();
+		for (auto i = 0, j = 0; i < nElReg<T>(); i++)
+			if (_emu_bit<T>(m, i))
+				_emu_put<T>(r, j++, _emu_get<T>(v, i));
+		return r;
+	}
+
+	template <typename T>
+	inline reg _emu_expand(const reg v, const msk m) {
+		reg r = _emu_set0();
+		for (auto i = 0, j = 0; i < nElReg<T>(); i++)
+			if (_emu_bit<T>(m, i))
+				_emu_put<T>(r, i, _emu_get<T>(v, j++));
+		return r;
+	}
+
+	// 'r[i] = (T2)v[i]', 'v' is a full register or a half register (widening conversions)
+	template <typename T1, typename T2, typename R>
+	inline reg _emu_cvt(const R v) {
+		reg r;
+		for (auto i = 0; i < nElReg<T2>(); i++)
+			_emu_put<T2>(r, i, (T2)_emu_get<T1>(v, i));
+		return r;
+	}
+
+	template <typename T1, typename T2>
+	inline reg _emu_cvt_round(const reg v) {
+		reg r;
+		for (auto i = 0; i < nElReg<T2>(); i++)
+			_emu_put<T2>(r, i, _emu_round_to<T2>(_emu_get<T1>(v, i)));
+		return r;
+	}
+
+	template <typename T1, typename T2>
+	inline reg _emu_pack(const reg v1, const reg v2) {
+		constexpr int n = nElReg<T1>();
+		reg r;
+		for (auto i = 0; i < n; i++) {
+			_emu_put<T2>(r, i,     _emu_sat<T2>(_emu_get<T1>(v1, i)));
+			_emu_put<T2>(r, n + i, _emu_sat<T2>(_emu_get<T1>(v2, i)));
+		}
+		return r;
+	}
+
+	// butterfly: after 'log2(nElReg<T>())' steps all the elements hold the reduction
+	template <typename T, red_op<T> OP>
+	inline reg _emu_reduction(const reg v) {
+		auto val = v;
+		for (auto s = nElReg<T>() / 2; s > 0; s /= 2)
+			val = OP(val, _emu_perm<T>(val, val, [s](const int i) { return i ^ s; }));
+		return val;
+	}
+
+	// ------------------------------------------------------------------------------------------------ specializations
+#define MIPP_EMU_ANY(T)                                                                                                \
+	template <> inline reg   load         <T>(const T *mem_addr          ) { return _emu_load<T>(mem_addr);            } \
+	template <> inline reg   loadu        <T>(const T *mem_addr          ) { return _emu_loadu<T>(mem_addr);           } \
+	template <> inline void  store        <T>(T *mem_addr, const reg v   ) { _emu_store<T>(mem_addr, v);               } \
+	template <> inline void  storeu       <T>(T *mem_addr, const reg v   ) { _emu_storeu<T>(mem_addr, v);              } \
+	template <> inline reg   set          <T>(const T vals[nElReg<T>()]  ) { return _emu_loadu<T>(vals);               } \
+	template <> inline reg   set1         <T>(const T val                ) { return _emu_set1<T>(val);                 } \
+	template <> inline reg   set0         <T>(                           ) { return _emu_set0();                       } \
+	template <> inline reg_2 low          <T>(const reg v                ) { return _emu_low(v);                       } \
+	template <> inline reg_2 high         <T>(const reg v                ) { return _emu_high(v);                      } \
+	template <> inline reg   combine      <T>(const reg_2 v1, const reg_2 v2) { return _emu_combine(v1, v2);           } \
+	template <> inline reg   cmask        <T>(const uint32_t val[nElReg<T>()  ]) { return _emu_cmask<T,1>(val);       } \
+	template <> inline reg   cmask2       <T>(const uint32_t val[nElReg<T>()/2]) { return _emu_cmask<T,2>(val);       } \
+	template <> inline reg   cmask4       <T>(const uint32_t val[nElReg<T>()/4]) { return _emu_cmask<T,4>(val);       } \
+	template <> inline reg   shuff        <T>(const reg v, const reg cm  ) { return _emu_shuff<T,1>(v, cm);            } \
+	template <> inline reg   shuff2       <T>(const reg v, const reg cm  ) { return _emu_shuff<T,2>(v, cm);            } \
+	template <> inline reg   shuff4       <T>(const reg v, const reg cm  ) { return _emu_shuff<T,4>(v, cm);            } \
+	template <> inline reg   interleavelo <T>(const reg v1, const reg v2 ) { return _emu_interleave<T,1,0>(v1, v2);    } \
+	template <> inline reg   interleavehi <T>(const reg v1, const reg v2 ) { return _emu_interleave<T,1,1>(v1, v2);    } \
+	template <> inline reg   interleavelo2<T>(const reg v1, const reg v2 ) { return _emu_interleave<T,2,0>(v1, v2);    } \
+	template <> inline reg   interleavehi2<T>(const reg v1, const reg v2 ) { return _emu_interleave<T,2,1>(v1, v2);    } \
+	template <> inline reg   interleavelo4<T>(const reg v1, const reg v2 ) { return _emu_interleave<T,4,0>(v1, v2);    } \
+	template <> inline reg   interleavehi4<T>(const reg v1, const reg v2 ) { return _emu_interleave<T,4,1>(v1, v2);    } \
+	template <> inline regx2 interleave   <T>(const reg v1, const reg v2 ) { return {{_emu_interleave<T,1,0>(v1, v2),   \
+	                                                                                  _emu_interleave<T,1,1>(v1, v2)}}; } \
+	template <> inline regx2 interleave2  <T>(const reg v1, const reg v2 ) { return {{_emu_interleave<T,2,0>(v1, v2),   \
+	                                                                                  _emu_interleave<T,2,1>(v1, v2)}}; } \
+	template <> inline regx2 interleave4  <T>(const reg v1, const reg v2 ) { return {{_emu_interleave<T,4,0>(v1, v2),   \
+	                                                                                  _emu_interleave<T,4,1>(v1, v2)}}; } \
+	template <> inline reg   interleave   <T>(const reg v                ) { return _emu_interleave<T,1,0>(v,            \
+	                                                                                _emu_perm<T>(v, v, [](const int i) {  \
+	                                                                                return i + nElReg<T>() / 2; }));   } \
+	template <> inline regx2 deinterleave <T>(const reg v1, const reg v2 ) { return _emu_deinterleave<T>(v1, v2);      } \
+	template <> inline regx2 interleavex2 <T>(const reg v1, const reg v2 ) { return _emu_interleavex2<T>(v1, v2);      } \
+	template <> inline void  transpose    <T>(reg tab[nElReg<T>()]       ) { _emu_transpose<T,1>(tab);                 } \
+	template <> inline void  transpose2   <T>(reg tab[nElReg<T>()/2]     ) { _emu_transpose<T,2>(tab);                 } \
+	template <> inline reg   andb         <T>(const reg v1, const reg v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a & b; });     } \
+	template <> inline reg   andnb        <T>(const reg v1, const reg v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return ~a & b; });    } \
+	template <> inline reg   notb         <T>(const reg v                ) { return _emu_bytes(v, v, [](uint8_t a,       \
+	                                                                                uint8_t) { return ~a; });          } \
+	template <> inline reg   orb          <T>(const reg v1, const reg v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a | b; });     } \
+	template <> inline reg   xorb         <T>(const reg v1, const reg v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a ^ b; });     } \
+	template <> inline reg   lshift       <T>(const reg v, const uint32_t n) { return _emu_lshift<T>(v, n);            } \
+	template <> inline reg   rshift       <T>(const reg v, const uint32_t n) { return _emu_rshift<T>(v, n);            } \
+	template <> inline reg   lshiftr      <T>(const reg v1, const reg v2 ) { return _emu_lshiftr<T>(v1, v2);           } \
+	template <> inline reg   rshiftr      <T>(const reg v1, const reg v2 ) { return _emu_rshiftr<T>(v1, v2);           } \
+	template <> inline msk   cmpeq        <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a == b; });               } \
+	template <> inline msk   cmpneq       <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a != b; });               } \
+	template <> inline msk   cmplt        <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a < b; });                } \
+	template <> inline msk   cmple        <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a <= b; });               } \
+	template <> inline msk   cmpgt        <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a > b; });                } \
+	template <> inline msk   cmpge        <T>(const reg v1, const reg v2 ) { return _emu_cmp<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a >= b; });               } \
+	template <> inline reg   add          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return _emu_add(a, b); });       } \
+	template <> inline reg   sub          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return _emu_sub(a, b); });       } \
+	template <> inline reg   mul          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return _emu_mul(a, b); });       } \
+	template <> inline reg   min          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return b < a ? b : a; });        } \
+	template <> inline reg   max          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return b > a ? b : a; });        } \
+	template <> inline reg   msb          <T>(const reg v                ) { return _emu_msb<T>(v);                    } \
+	template <> inline reg   msb          <T>(const reg v1, const reg v2 ) { return _emu_msb<T>(xorb<T>(v1, v2));      } \
+	template <> inline msk   sign         <T>(const reg v                ) { return cmplt<T>(v, _emu_set0());          } \
+	template <> inline reg   neg          <T>(const reg v1, const reg v2 ) { return _emu_neg<T>(v1, v2);               } \
+	template <> inline reg   neg          <T>(const reg v, const msk m   ) { return _emu_neg<T>(v, m);                 } \
+	template <> inline reg   abs          <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return _emu_abs(a); });          } \
+	template <> inline reg   fmadd        <T>(const reg v1, const reg v2, const reg v3) {                              \
+	                          return _emu_map<T>(v1, v2, v3, [](T a, T b, T c) { return _emu_add(_emu_mul(a, b), c); }); } \
+	template <> inline reg   fnmadd       <T>(const reg v1, const reg v2, const reg v3) {                              \
+	                          return _emu_map<T>(v1, v2, v3, [](T a, T b, T c) { return _emu_sub(c, _emu_mul(a, b)); }); } \
+	template <> inline reg   fmsub        <T>(const reg v1, const reg v2, const reg v3) {                              \
+	                          return _emu_map<T>(v1, v2, v3, [](T a, T b, T c) { return _emu_sub(_emu_mul(a, b), c); }); } \
+	template <> inline reg   fnmsub       <T>(const reg v1, const reg v2, const reg v3) {                              \
+	                          return _emu_map<T>(v1, v2, v3, [](T a, T b, T c) {                                       \
+	                                                       return _emu_sub(_emu_neg(_emu_mul(a, b)), c); });           } \
+	template <> inline reg   blend        <T>(const reg v1, const reg v2, const msk m) { return _emu_blend<T>(v1, v2, m); } \
+	template <> inline reg   lrot         <T>(const reg v                ) { return _emu_perm<T>(v, v, [](const int i)   \
+	                                                                                { return (i + 1) % nElReg<T>(); });} \
+	template <> inline reg   rrot         <T>(const reg v                ) { return _emu_perm<T>(v, v, [](const int i)   \
+	                                                              { return (i + nElReg<T>() -1) % nElReg<T>(); });     } \
+	template <> inline reg   sat          <T>(const reg v, T lo, T hi    ) { return _emu_map<T>(v, [lo, hi](T a)       \
+	                                                                                { return a < lo ? lo : a > hi ? hi : a; }); } \
+	template <> inline bool  testz        <T>(const reg v1, const reg v2 ) { return _emu_zero(andb<T>(v1, v2));        } \
+	template <> inline bool  testz        <T>(const reg v                ) { return _emu_zero(v);                      } \
+	template <> inline reg   compress     <T>(const reg v, const msk m   ) { return _emu_compress<T>(v, m);            } \
+	template <> inline reg   expand       <T>(const reg v, const msk m   ) { return _emu_expand<T>(v, m);              } \
+	template <red_op<T> OP>                                                                                            \
+	struct _reduction<T,OP>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) { return _emu_reduction<T,OP>(v); }                                              \
+	};                                                                                                                 \
+	template <Red_op<T> OP>                                                                                            \
+	struct _Reduction<T,OP>                                                                                            \
+	{                                                                                                                  \
+		static Reg<T> apply(const Reg<T> v) {                                                                          \
+			auto val = v;                                                                                              \
+			for (auto s = nElReg<T>() / 2; s > 0; s /= 2)                                                              \
+				val = OP(val, Reg<T>(_emu_perm<T>(val.r, val.r, [s](const int i) { return i ^ s; })));                 \
+			return val;                                                                                                \
+		}                                                                                                              \
+	};
+
+#define MIPP_EMU_FLOAT(T)                                                                                              \
+	template <> inline reg   div          <T>(const reg v1, const reg v2 ) { return _emu_map<T>(v1, v2, [](T a, T b)    \
+	                                                                                { return a / b; });                } \
+	template <> inline reg   div2         <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return a * (T)0.5; });           } \
+	template <> inline reg   div4         <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return a * (T)0.25; });          } \
+	template <> inline reg   sqrt         <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::sqrt(a); });         } \
+	template <> inline reg   rsqrt        <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return (T)1 / std::sqrt(a); });  } \
+	template <> inline reg   log          <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::log(a); });          } \
+	template <> inline reg   exp          <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::exp(a); });          } \
+	template <> inline reg   sin          <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::sin(a); });          } \
+	template <> inline reg   cos          <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::cos(a); });          } \
+	template <> inline void  sincos       <T>(const reg v, reg &s, reg &c) { s = sin<T>(v); c = cos<T>(v);             } \
+	template <> inline reg   round        <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return std::nearbyint(a); });    }
+
+#define MIPP_EMU_INT(T)                                                                                                \
+	template <> inline reg   div2         <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return a / 2; });                } \
+	template <> inline reg   div4         <T>(const reg v                ) { return _emu_map<T>(v, [](T a)             \
+	                                                                                { return a / 4; });                }
+
+// the other operations of the unsigned integers are forwarded to the signed integers in "mipp.h"
+#define MIPP_EMU_UNSIGNED(UT)                                                                                          \
+	template <> inline msk   cmplt        <UT>(const reg v1, const reg v2) { return _emu_cmp<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return a < b; });                } \
+	template <> inline msk   cmple        <UT>(const reg v1, const reg v2) { return _emu_cmp<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return a <= b; });               } \
+	template <> inline msk   cmpgt        <UT>(const reg v1, const reg v2) { return _emu_cmp<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return a > b; });                } \
+	template <> inline msk   cmpge        <UT>(const reg v1, const reg v2) { return _emu_cmp<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return a >= b; });               } \
+	template <> inline reg   min          <UT>(const reg v1, const reg v2) { return _emu_map<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return b < a ? b : a; });        } \
+	template <> inline reg   max          <UT>(const reg v1, const reg v2) { return _emu_map<UT>(v1, v2, [](UT a, UT b) \
+	                                                                                { return b > a ? b : a; });        }
+
+#define MIPP_EMU_MSK(N)                                                                                                \
+	template <> inline msk   set          <N>(const bool vals[N]         ) { msk m; for (auto i = 0; i < N; i++)       \
+	                                                                                _emu_putn<N>(m, i, vals[i]);       \
+	                                                                                return m;                          } \
+	template <> inline msk   set1         <N>(const bool val             ) { msk m; m.b.fill(val ? 0xFF : 0x00);       \
+	                                                                                return m;                          } \
+	template <> inline msk   set0         <N>(                           ) { msk m; m.b.fill(0); return m;             } \
+	template <> inline msk   andb         <N>(const msk v1, const msk v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a & b; });     } \
+	template <> inline msk   andnb        <N>(const msk v1, const msk v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return ~a & b; });    } \
+	template <> inline msk   notb         <N>(const msk v                ) { return _emu_bytes(v, v, [](uint8_t a,       \
+	                                                                                uint8_t) { return ~a; });          } \
+	template <> inline msk   orb          <N>(const msk v1, const msk v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a | b; });     } \
+	template <> inline msk   xorb         <N>(const msk v1, const msk v2 ) { return _emu_bytes(v1, v2, [](uint8_t a,     \
+	                                                                                uint8_t b) { return a ^ b; });     } \
+	template <> inline msk   lshift       <N>(const msk v, const uint32_t n) { msk m; for (auto i = 0; i < N; i++)     \
+	                                               _emu_putn<N>(m, i, (uint32_t)i >= n && _emu_bitn<N>(v, i - n));     \
+	                                                                                return m;                          } \
+	template <> inline msk   rshift       <N>(const msk v, const uint32_t n) { msk m; for (auto i = 0; i < N; i++)     \
+	                                               _emu_putn<N>(m, i, (uint32_t)i + n < N && _emu_bitn<N>(v, i + n));  \
+	                                                                                return m;                          } \
+	template <> inline bool  testz        <N>(const msk v1, const msk v2 ) { return _emu_zero(andb<N>(v1, v2));        } \
+	template <> inline bool  testz        <N>(const msk v                ) { return _emu_zero(v);                      }
+
+	MIPP_EMU_ANY(double)
+	MIPP_EMU_ANY(float)
+	MIPP_EMU_ANY(int64_t)
+	MIPP_EMU_ANY(int32_t)
+	MIPP_EMU_ANY(int16_t)
+	MIPP_EMU_ANY(int8_t)
+
+	MIPP_EMU_FLOAT(double)
+	MIPP_EMU_FLOAT(float)
+
+	MIPP_EMU_INT(int64_t)
+	MIPP_EMU_INT(int32_t)
+	MIPP_EMU_INT(int16_t)
+	MIPP_EMU_INT(int8_t)
+
+	MIPP_EMU_UNSIGNED(uint64_t)
+	MIPP_EMU_UNSIGNED(uint32_t)
+	MIPP_EMU_UNSIGNED(uint16_t)
+	MIPP_EMU_UNSIGNED(uint8_t)
+
+	MIPP_EMU_MSK(nElReg<int64_t>())
+	MIPP_EMU_MSK(nElReg<int32_t>())
+	MIPP_EMU_MSK(nElReg<int16_t>())
+	MIPP_EMU_MSK(nElReg<int8_t >())
+
+	// the unsigned additions and subtractions saturate for the 8-bit and 16-bit integers (see "mipp.h" for the 32-bit
+	// and 64-bit ones)
+	template <>
+	inline reg add<uint16_t>(const reg v1, const reg v2) {
+		return _emu_map<uint16_t>(v1, v2, [](uint16_t a, uint16_t b) { return _emu_add(a, b); });
+	}
+
+	template <>
+	inline reg add<uint8_t>(const reg v1, const reg v2) {
+		return _emu_map<uint8_t>(v1, v2, [](uint8_t a, uint8_t b) { return _emu_add(a, b); });
+	}
+
+	template <>
+	inline reg sub<uint16_t>(const reg v1, const reg v2) {
+		return _emu_map<uint16_t>(v1, v2, [](uint16_t a, uint16_t b) { return _emu_sub(a, b); });
+	}
+
+	template <>
+	inline reg sub<uint8_t>(const reg v1, const reg v2) {
+		return _emu_map<uint8_t>(v1, v2, [](uint8_t a, uint8_t b) { return _emu_sub(a, b); });
+	}
+
+	// ------------------------------------------------------------------------------------------------------------ cvt
+	template <>
+	inline reg cvt<float,int32_t>(const reg v) {
+		return _emu_cvt_round<float,int32_t>(v);
+	}
+
+	template <>
+	inline reg cvt<double,int64_t>(const reg v) {
+		return _emu_cvt_round<double,int64_t>(v);
+	}
+
+	template <>
+	inline reg cvt<int32_t,float>(const reg v) {
+		return _emu_cvt<int32_t,float>(v);
+	}
+
+	template <>
+	inline reg cvt<int64_t,double>(const reg v) {
+		return _emu_cvt<int64_t,double>(v);
+	}
+
+	template <>
+	inline reg cvt<int32_t,int64_t>(const reg_2 v) {
+		return _emu_cvt<int32_t,int64_t>(v);
+	}
+
+	template <>
+	inline reg cvt<int16_t,int32_t>(const reg_2 v) {
+		return _emu_cvt<int16_t,int32_t>(v);
+	}
+
+	template <>
+	inline reg cvt<int8_t,int16_t>(const reg_2 v) {
+		return _emu_cvt<int8_t,int16_t>(v);
+	}
+
+	template <>
+	inline reg cvt<uint32_t,uint64_t>(const reg_2 v) {
+		return _emu_cvt<uint32_t,uint64_t>(v);
+	}
+
+	template <>
+	inline reg cvt<uint16_t,uint32_t>(const reg_2 v) {
+		return _emu_cvt<uint16_t,uint32_t>(v);
+	}
+
+	template <>
+	inline reg cvt<uint8_t,uint16_t>(const reg_2 v) {
+		return _emu_cvt<uint8_t,uint16_t>(v);
+	}
+
+	// ----------------------------------------------------------------------------------------------------------- pack
+	template <>
+	inline reg pack<int32_t,int16_t>(const reg v1, const reg v2) {
+		return _emu_pack<int32_t,int16_t>(v1, v2);
+	}
+
+	template <>
+	inline reg pack<int16_t,int8_t>(const reg v1, const reg v2) {
+		return _emu_pack<int16_t,int8_t>(v1, v2);
+	}
+
+	template <>
+	inline reg pack<uint32_t,uint16_t>(const reg v1, const reg v2) {
+		return _emu_pack<uint32_t,uint16_t>(v1, v2);
+	}
+
+	template <>
+	inline reg pack<uint16_t,uint8_t>(const reg v1, const reg v2) {
+		return _emu_pack<uint16_t,uint8_t>(v1, v2);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- to_bits
+	template <>
+	inline uint64_t to_bits<nElReg<int64_t>()>(const msk m) {
+		uint64_t bits = 0;
+		for (auto i = 0; i < nElReg<int64_t>(); i++)
+			bits |= (uint64_t)_emu_bitn<nElReg<int64_t>()>(m, i) << i;
+		return bits;
+	}
+
+	template <>
+	inline uint64_t to_bits<nElReg<int32_t>()>(const msk m) {
+		uint64_t bits = 0;
+		for (auto i = 0; i < nElReg<int32_t>(); i++)
+			bits |= (uint64_t)_emu_bitn<nElReg<int32_t>()>(m, i) << i;
+		return bits;
+	}
+
+	template <>
+	inline uint64_t to_bits<nElReg<int16_t>()>(const msk m) {
+		uint64_t bits = 0;
+		for (auto i = 0; i < nElReg<int16_t>(); i++)
+			bits |= (uint64_t)_emu_bitn<nElReg<int16_t>()>(m, i) << i;
+		return bits;
+	}
+
+#if MIPP_REGISTER_SIZE <= 512
+	template <>
+	inline uint64_t to_bits<nElReg<int8_t>()>(const msk m) {
+		uint64_t bits = 0;
+		for (auto i = 0; i < nElReg<int8_t>(); i++)
+			bits |= (uint64_t)_emu_bitn<nElReg<int8_t>()>(m, i) << i;
+		return bits;
+	}
+#else
+	// the 128 elements do not fit in 'to_bits', the mask utilities read the elements directly
+	template <>
+	inline uint32_t popcnt<128>(const msk m) {
+		uint32_t n = 0;
+		for (auto i = 0; i < 128; i++)
+			n += _emu_bitn<128>(m, i) ? 1 : 0;
+		return n;
+	}
+
+	template <>
+	inline uint32_t ctz<128>(const msk m) {
+		for (auto i = 0; i < 128; i++)
+			if (_emu_bitn<128>(m, i))
+				return (uint32_t)i;
+		return 128;
+	}
+
+	template <>
+	inline uint32_t clz<128>(const msk m) {
+		for (auto i = 127; i >= 0; i--)
+			if (_emu_bitn<128>(m, i))
+				return (uint32_t)(127 - i);
+		return 128;
+	}
+
+	template <>
+	inline bool any<128>(const msk m) {
+		return !_emu_zero(m);
+	}
+
+	template <>
+	inline bool all<128>(const msk m) {
+		return popcnt<128>(m) == 128;
+	}
+#endif
+
+#endif
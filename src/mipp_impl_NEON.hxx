@@ -208,6 +208,34 @@
 	}
 #endif
 
+	// ---------------------------------------------------------------------------------------------------------- mask_n
+	// there is no masked load/store in NEON, the generic 'loadu_n' and 'storeu_n' implementations are used
+#ifdef __aarch64__
+	template <>
+	inline msk mask_n<2>(const uint32_t n) {
+		const uint64_t iota[2] = {0, 1};
+		return vreinterpretq_u32_u64(vcltq_u64(vld1q_u64(iota), vdupq_n_u64((uint64_t)n)));
+	}
+#endif
+
+	template <>
+	inline msk mask_n<4>(const uint32_t n) {
+		const uint32_t iota[4] = {0, 1, 2, 3};
+		return vcltq_u32(vld1q_u32(iota), vdupq_n_u32(n));
+	}
+
+	template <>
+	inline msk mask_n<8>(const uint32_t n) {
+		const uint16_t iota[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+		return vreinterpretq_u32_u16(vcltq_u16(vld1q_u16(iota), vdupq_n_u16((uint16_t)(n > 8 ? 8 : n))));
+	}
+
+	template <>
+	inline msk mask_n<16>(const uint32_t n) {
+		const uint8_t iota[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+		return vreinterpretq_u32_u8(vcltq_u8(vld1q_u8(iota), vdupq_n_u8((uint8_t)(n > 16 ? 16 : n))));
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ set
 	template <>
 	inline reg set<double>(const double vals[nElReg<double>()]) {
@@ -394,6 +422,92 @@
 		return (msk) vdupq_n_u8(0);
 	}
 
+	// -------------------------------------------------------------------------------------------------------- extract
+#ifdef __aarch64__
+	template <int I>
+	struct _extract<double,I> {
+		static double apply(const reg r) {
+			return vgetq_lane_f64((float64x2_t) r, I);
+		}
+	};
+#endif
+
+	template <int I>
+	struct _extract<float,I> {
+		static float apply(const reg r) {
+			return vgetq_lane_f32(r, I);
+		}
+	};
+
+	template <int I>
+	struct _extract<int64_t,I> {
+		static int64_t apply(const reg r) {
+			return vgetq_lane_s64((int64x2_t) r, I);
+		}
+	};
+
+	template <int I>
+	struct _extract<int32_t,I> {
+		static int32_t apply(const reg r) {
+			return vgetq_lane_s32((int32x4_t) r, I);
+		}
+	};
+
+	template <int I>
+	struct _extract<int16_t,I> {
+		static int16_t apply(const reg r) {
+			return vgetq_lane_s16((int16x8_t) r, I);
+		}
+	};
+
+	template <int I>
+	struct _extract<int8_t,I> {
+		static int8_t apply(const reg r) {
+			return vgetq_lane_s8((int8x16_t) r, I);
+		}
+	};
+
+#ifdef __aarch64__
+	// the bytes of the element 'index' are moved in the first bytes of the register (the other bytes are garbage)
+	template <typename T>
+	inline uint8x16_t _extract_shuffle(const reg r, const uint32_t index) {
+		const uint8_t iota[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+		const auto bytes = vandq_u8(vaddq_u8(vdupq_n_u8((uint8_t)((index % nElReg<T>()) * sizeof(T))), vld1q_u8(iota)),
+		                            vdupq_n_u8(15));
+		return vqtbl1q_u8((uint8x16_t) r, bytes);
+	}
+
+	template <>
+	inline double extract<double>(const reg r, const uint32_t index) {
+		return vgetq_lane_f64((float64x2_t) _extract_shuffle<double>(r, index), 0);
+	}
+
+	template <>
+	inline float extract<float>(const reg r, const uint32_t index) {
+		return vgetq_lane_f32((float32x4_t) _extract_shuffle<float>(r, index), 0);
+	}
+
+	template <>
+	inline int64_t extract<int64_t>(const reg r, const uint32_t index) {
+		return vgetq_lane_s64((int64x2_t) _extract_shuffle<int64_t>(r, index), 0);
+	}
+
+	template <>
+	inline int32_t extract<int32_t>(const reg r, const uint32_t index) {
+		return vgetq_lane_s32((int32x4_t) _extract_shuffle<int32_t>(r, index), 0);
+	}
+
+	template <>
+	inline int16_t extract<int16_t>(const reg r, const uint32_t index) {
+		return vgetq_lane_s16((int16x8_t) _extract_shuffle<int16_t>(r, index), 0);
+	}
+
+	template <>
+	inline int8_t extract<int8_t>(const reg r, const uint32_t index) {
+		return vgetq_lane_s8((int8x16_t) _extract_shuffle<int8_t>(r, index), 0);
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ low
 #ifdef __aarch64__
 	template <>
@@ -1834,6 +1948,28 @@
 		return (msk) vcltq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline msk cmplt<uint64_t>(const reg v1, const reg v2) {
+		return (msk) vcltq_u64((uint64x2_t) v1, (uint64x2_t) v2);
+	}
+#endif
+
+	template <>
+	inline msk cmplt<uint32_t>(const reg v1, const reg v2) {
+		return (msk) vcltq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline msk cmplt<uint16_t>(const reg v1, const reg v2) {
+		return (msk) vcltq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline msk cmplt<uint8_t>(const reg v1, const reg v2) {
+		return (msk) vcltq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmple
 #ifdef __aarch64__
 	template <>
@@ -1869,6 +2005,28 @@
 		return (msk) vcleq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline msk cmple<uint64_t>(const reg v1, const reg v2) {
+		return (msk) vcleq_u64((uint64x2_t) v1, (uint64x2_t) v2);
+	}
+#endif
+
+	template <>
+	inline msk cmple<uint32_t>(const reg v1, const reg v2) {
+		return (msk) vcleq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline msk cmple<uint16_t>(const reg v1, const reg v2) {
+		return (msk) vcleq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline msk cmple<uint8_t>(const reg v1, const reg v2) {
+		return (msk) vcleq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmpgt
 #ifdef __aarch64__
 	template <>
@@ -1904,6 +2062,28 @@
 		return (msk) vcgtq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline msk cmpgt<uint64_t>(const reg v1, const reg v2) {
+		return (msk) vcgtq_u64((uint64x2_t) v1, (uint64x2_t) v2);
+	}
+#endif
+
+	template <>
+	inline msk cmpgt<uint32_t>(const reg v1, const reg v2) {
+		return (msk) vcgtq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline msk cmpgt<uint16_t>(const reg v1, const reg v2) {
+		return (msk) vcgtq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline msk cmpgt<uint8_t>(const reg v1, const reg v2) {
+		return (msk) vcgtq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmpge
 #ifdef __aarch64__
 	template <>
@@ -1939,6 +2119,28 @@
 		return (msk) vcgeq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline msk cmpge<uint64_t>(const reg v1, const reg v2) {
+		return (msk) vcgeq_u64((uint64x2_t) v1, (uint64x2_t) v2);
+	}
+#endif
+
+	template <>
+	inline msk cmpge<uint32_t>(const reg v1, const reg v2) {
+		return (msk) vcgeq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline msk cmpge<uint16_t>(const reg v1, const reg v2) {
+		return (msk) vcgeq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline msk cmpge<uint8_t>(const reg v1, const reg v2) {
+		return (msk) vcgeq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ add
 #ifdef __aarch64__
 	template <>
@@ -1974,6 +2176,16 @@
 		return (reg) vqaddq_s8((int8x16_t) v1, (int8x16_t)v2);
 	}
 
+	template <>
+	inline reg add<uint16_t>(const reg v1, const reg v2) {
+		return (reg) vqaddq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline reg add<uint8_t>(const reg v1, const reg v2) {
+		return (reg) vqaddq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ sub
 #ifdef __aarch64__
 	template <>
@@ -2009,6 +2221,16 @@
 		return (reg) vqsubq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+	template <>
+	inline reg sub<uint16_t>(const reg v1, const reg v2) {
+		return (reg) vqsubq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline reg sub<uint8_t>(const reg v1, const reg v2) {
+		return (reg) vqsubq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ mul
 #ifdef __aarch64__
 	template <>
@@ -2085,6 +2307,28 @@
 		return (reg) vminq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg min<uint64_t>(const reg v1, const reg v2) {
+		return (reg) vbslq_u64(vcgtq_u64((uint64x2_t) v1, (uint64x2_t) v2), (uint64x2_t) v2, (uint64x2_t) v1);
+	}
+#endif
+
+	template <>
+	inline reg min<uint32_t>(const reg v1, const reg v2) {
+		return (reg) vminq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline reg min<uint16_t>(const reg v1, const reg v2) {
+		return (reg) vminq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline reg min<uint8_t>(const reg v1, const reg v2) {
+		return (reg) vminq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ max
 #ifdef __aarch64__
 	template <>
@@ -2113,6 +2357,28 @@
 		return (reg) vmaxq_s8((int8x16_t) v1, (int8x16_t) v2);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg max<uint64_t>(const reg v1, const reg v2) {
+		return (reg) vbslq_u64(vcgtq_u64((uint64x2_t) v1, (uint64x2_t) v2), (uint64x2_t) v1, (uint64x2_t) v2);
+	}
+#endif
+
+	template <>
+	inline reg max<uint32_t>(const reg v1, const reg v2) {
+		return (reg) vmaxq_u32((uint32x4_t) v1, (uint32x4_t) v2);
+	}
+
+	template <>
+	inline reg max<uint16_t>(const reg v1, const reg v2) {
+		return (reg) vmaxq_u16((uint16x8_t) v1, (uint16x8_t) v2);
+	}
+
+	template <>
+	inline reg max<uint8_t>(const reg v1, const reg v2) {
+		return (reg) vmaxq_u8((uint8x16_t) v1, (uint8x16_t) v2);
+	}
+
 	// ----------------------------------------------------------------------------------------------------------- msb
 #ifdef __aarch64__
 	template <>
@@ -2390,6 +2656,13 @@
 		return (reg) log_ps(v_bis);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg log<double>(const reg v) {
+		return (reg) log_pd((float64x2_t) v);
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ exp
 	template <>
 	inline reg exp<float>(const reg v) {
@@ -2397,6 +2670,13 @@
 		return (reg) exp_ps(v_bis);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg exp<double>(const reg v) {
+		return (reg) exp_pd((float64x2_t) v);
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ sin
 	template <>
 	inline reg sin<float>(const reg v) {
@@ -2404,6 +2684,13 @@
 		return (reg) sin_ps(v_bis);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg sin<double>(const reg v) {
+		return (reg) sin_pd((float64x2_t) v);
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ cos
 	template <>
 	inline reg cos<float>(const reg v) {
@@ -2411,12 +2698,26 @@
 		return (reg) cos_ps(v_bis);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline reg cos<double>(const reg v) {
+		return (reg) cos_pd((float64x2_t) v);
+	}
+#endif
+
 	// --------------------------------------------------------------------------------------------------------- sincos
 	template <>
 	inline void sincos<float>(const reg x, reg &s, reg &c) {
 		sincos_ps(x, &s, &c);
 	}
 
+#ifdef __aarch64__
+	template <>
+	inline void sincos<double>(const reg x, reg &s, reg &c) {
+		sincos_pd((float64x2_t) x, (float64x2_t*) &s, (float64x2_t*) &c);
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- fmadd
 #ifdef __aarch64__
 	template <>
@@ -2727,6 +3028,21 @@
 		return (reg) vmovl_s32((int32x2_t) v);
 	}
 
+	template <>
+	inline reg cvt<uint8_t,uint16_t>(const reg_2 v) {
+		return (reg) vmovl_u8((uint8x8_t) v);
+	}
+
+	template <>
+	inline reg cvt<uint16_t,uint32_t>(const reg_2 v) {
+		return (reg) vmovl_u16((uint16x4_t) v);
+	}
+
+	template <>
+	inline reg cvt<uint32_t,uint64_t>(const reg_2 v) {
+		return (reg) vmovl_u32((uint32x2_t) v);
+	}
+
 	// ----------------------------------------------------------------------------------------------------------- pack
 	template <>
 	inline reg pack<int64_t,int32_t>(const reg v1, const reg v2) {
@@ -2743,6 +3059,21 @@
 		return (reg) vcombine_s8(vqmovn_s16((int16x8_t) v1), vqmovn_s16((int16x8_t) v2));
 	}
 
+	template <>
+	inline reg pack<uint64_t,uint32_t>(const reg v1, const reg v2) {
+		return (reg) vcombine_u32(vqmovn_u64((uint64x2_t) v1), vqmovn_u64((uint64x2_t) v2));
+	}
+
+	template <>
+	inline reg pack<uint32_t,uint16_t>(const reg v1, const reg v2) {
+		return (reg) vcombine_u16(vqmovn_u32((uint32x4_t) v1), vqmovn_u32((uint32x4_t) v2));
+	}
+
+	template <>
+	inline reg pack<uint16_t,uint8_t>(const reg v1, const reg v2) {
+		return (reg) vcombine_u8(vqmovn_u16((uint16x8_t) v1), vqmovn_u16((uint16x8_t) v2));
+	}
+
 	// ------------------------------------------------------------------------------------------------------ reduction
 #ifdef __aarch64__
 	template <red_op<double> OP>
@@ -2948,6 +3279,31 @@
 		}
 	};
 
+	// ----------------------------------------------------------------------------------------------------------- scan
+#define MIPP_NEON_SCAN_SHIFT(T)                                                                                        \
+	template <int S>                                                                                                   \
+	struct _scan_shift<T,S>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) {                                                                                \
+			return (reg) vextq_u8(vdupq_n_u8(0), (uint8x16_t)v, (16 - S * (int)sizeof(T)) & 15);                       \
+		}                                                                                                              \
+	};
+
+	MIPP_NEON_SCAN_SHIFT(float)
+	MIPP_NEON_SCAN_SHIFT(int32_t)
+	MIPP_NEON_SCAN_SHIFT(int16_t)
+	MIPP_NEON_SCAN_SHIFT(int8_t)
+	MIPP_NEON_SCAN_SHIFT(uint32_t)
+	MIPP_NEON_SCAN_SHIFT(uint16_t)
+	MIPP_NEON_SCAN_SHIFT(uint8_t)
+#ifdef __aarch64__
+	MIPP_NEON_SCAN_SHIFT(double)
+	MIPP_NEON_SCAN_SHIFT(int64_t)
+	MIPP_NEON_SCAN_SHIFT(uint64_t)
+#endif
+
+#undef MIPP_NEON_SCAN_SHIFT
+
 	// ---------------------------------------------------------------------------------------------------------- testz
 #ifdef __aarch64__
 	template <>
@@ -3090,6 +3446,145 @@
 	}
 #endif
 
+	// -------------------------------------------------------------------------------------------------------- to_bits
+	// each element is narrowed to its bit weight, then the weights are summed with pairwise additions
+	template <>
+	inline uint64_t to_bits<2>(const msk m) {
+		const uint64_t weights[2] = {1, 2};
+		const auto bits = vandq_u64((uint64x2_t) m, vld1q_u64(weights));
+		return vgetq_lane_u64(bits, 0) | vgetq_lane_u64(bits, 1);
+	}
+
+	template <>
+	inline uint64_t to_bits<4>(const msk m) {
+		const uint32_t weights[4] = {1, 2, 4, 8};
+		const auto bits = vandq_u32(m, vld1q_u32(weights));
+		auto sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+		sum = vpadd_u32(sum, sum);
+		return (uint64_t)vget_lane_u32(sum, 0);
+	}
+
+	template <>
+	inline uint64_t to_bits<8>(const msk m) {
+		const uint16_t weights[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+		const auto bits = vandq_u16((uint16x8_t) m, vld1q_u16(weights));
+		auto sum = vpadd_u16(vget_low_u16(bits), vget_high_u16(bits));
+		sum = vpadd_u16(sum, sum);
+		sum = vpadd_u16(sum, sum);
+		return (uint64_t)vget_lane_u16(sum, 0);
+	}
+
+	template <>
+	inline uint64_t to_bits<16>(const msk m) {
+		const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+		const auto bits = vandq_u8((uint8x16_t) m, vld1q_u8(weights));
+		auto sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+		sum = vpadd_u8(sum, sum);
+		sum = vpadd_u8(sum, sum);
+		return (uint64_t)vget_lane_u8(sum, 0) | ((uint64_t)vget_lane_u8(sum, 1) << 8);
+	}
+
+	// ---------------------------------------------------------------------------------------------- compress / expand
+#if defined(__aarch64__)
+	// 'tbl' indexes of the 16-bit and the 32-bit elements from the positions given by '_compress_lut' or '_expand_lut'
+	// (the unused positions stay greater than 15 and 'tbl' writes zeros)
+	inline uint8x16_t _shuffle_idx_u16(const uint64_t *pos) {
+		auto idx = vcombine_u8(vcreate_u8(*pos), vdup_n_u8(0xFF));
+		idx = vzip1q_u8(idx, idx);
+		idx = vaddq_u8(idx, idx);
+		return vaddq_u8(idx, vreinterpretq_u8_u16(vdupq_n_u16(0x0100)));
+	}
+
+	inline uint8x16_t _shuffle_idx_u32(const uint64_t *pos) {
+		auto idx = vcombine_u8(vcreate_u8(*pos), vdup_n_u8(0xFF));
+		idx = vzip1q_u8(idx, idx);
+		idx = vreinterpretq_u8_u16(vzip1q_u16(vreinterpretq_u16_u8(idx), vreinterpretq_u16_u8(idx)));
+		idx = vaddq_u8(idx, idx);
+		idx = vaddq_u8(idx, idx);
+		return vaddq_u8(idx, vreinterpretq_u8_u32(vdupq_n_u32(0x03020100)));
+	}
+
+	inline reg _shuffle_bytes(const reg v, const uint8x16_t idx) {
+		return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(v), idx));
+	}
+
+	template <>
+	inline reg compress<double>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg compress<float>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_compress_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<int64_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg compress<int32_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_compress_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<int16_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u16(mipp::_compress_lut() + to_bits<8>(m)));
+	}
+
+	// the two halves are compressed separately, then the indexes of the high half are shifted by the number of
+	// elements kept in the low half
+	template <>
+	inline reg compress<int8_t>(const reg v, const msk m) {
+		const uint8_t iota_vals[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+		const auto bits = (uint32_t)to_bits<16>(m);
+		const auto cnt  = vdupq_n_u8((uint8_t)mipp::_popcnt64(bits & 0xFF));
+		const auto iota = vld1q_u8(iota_vals);
+		const auto lut  = mipp::_compress_lut();
+
+		const auto lo = vcombine_u8(vcreate_u8(lut[bits & 0xFF]), vdup_n_u8(0xFF));
+		const auto hi = vqaddq_u8(vcombine_u8(vcreate_u8(lut[bits >> 8]), vdup_n_u8(0xFF)), vdupq_n_u8(8));
+		const auto hi_shifted = vqtbl1q_u8(hi, vsubq_u8(iota, cnt));
+		return _shuffle_bytes(v, vandq_u8(lo, vorrq_u8(hi_shifted, vcgtq_u8(cnt, iota))));
+	}
+
+	template <>
+	inline reg expand<double>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg expand<float>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_expand_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<int64_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg expand<int32_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u32(mipp::_expand_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<int16_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_u16(mipp::_expand_lut() + to_bits<8>(m)));
+	}
+
+	// the elements of the high half are starting after the ones of the low half (saturated add, 0xFF stays 0xFF)
+	template <>
+	inline reg expand<int8_t>(const reg v, const msk m) {
+		const auto bits = (uint32_t)to_bits<16>(m);
+		const auto cnt  = vdup_n_u8((uint8_t)mipp::_popcnt64(bits & 0xFF));
+		const auto lo   = vcreate_u8(mipp::_expand_lut()[bits & 0xFF]);
+		const auto hi   = vqadd_u8(vcreate_u8(mipp::_expand_lut()[bits >> 8]), cnt);
+		return _shuffle_bytes(v, vcombine_u8(lo, hi));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------ transpose
 	template <>
 	inline void transpose<int16_t>(reg tab[nElReg<int16_t>()]) {
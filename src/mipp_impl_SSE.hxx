@@ -200,6 +200,66 @@
 	}
 #endif
 
+	// ---------------------------------------------------------------------------------------------------------- mask_n
+	// there is no masked load/store in SSE ('_mm_maskmoveu_si128' is a non-temporal store), the generic 'loadu_n' and
+	// 'storeu_n' implementations are used
+#ifdef __SSE2__
+	template <>
+	inline msk mask_n<2>(const uint32_t n) {
+		return _mm_cmpgt_epi32(_mm_set1_epi32((int)(n > 2 ? 2 : n)), _mm_setr_epi32(0, 0, 1, 1));
+	}
+
+	template <>
+	inline msk mask_n<4>(const uint32_t n) {
+		return _mm_cmpgt_epi32(_mm_set1_epi32((int)(n > 4 ? 4 : n)), _mm_setr_epi32(0, 1, 2, 3));
+	}
+
+	template <>
+	inline msk mask_n<8>(const uint32_t n) {
+		return _mm_cmpgt_epi16(_mm_set1_epi16((int16_t)(n > 8 ? 8 : n)), _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7));
+	}
+
+	template <>
+	inline msk mask_n<16>(const uint32_t n) {
+		return _mm_cmpgt_epi8(_mm_set1_epi8((int8_t)(n > 16 ? 16 : n)),
+		                      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+	}
+#endif
+
+	// --------------------------------------------------------------------------------------------------------- stream
+	// the non-temporal stores require 'mem_addr' to be aligned on 16 bytes (even if 'MIPP_ALIGNED_LOADS' is not defined)
+#ifdef __SSE2__
+	template <>
+	inline void stream<float>(float *mem_addr, const reg v) {
+		_mm_stream_ps(mem_addr, v);
+	}
+
+	template <>
+	inline void stream<double>(double *mem_addr, const reg v) {
+		_mm_stream_pd(mem_addr, _mm_castps_pd(v));
+	}
+
+	template <>
+	inline void stream<int64_t>(int64_t *mem_addr, const reg v) {
+		_mm_stream_si128((__m128i*)mem_addr, _mm_castps_si128(v));
+	}
+
+	template <>
+	inline void stream<int32_t>(int32_t *mem_addr, const reg v) {
+		_mm_stream_si128((__m128i*)mem_addr, _mm_castps_si128(v));
+	}
+
+	template <>
+	inline void stream<int16_t>(int16_t *mem_addr, const reg v) {
+		_mm_stream_si128((__m128i*)mem_addr, _mm_castps_si128(v));
+	}
+
+	template <>
+	inline void stream<int8_t>(int8_t *mem_addr, const reg v) {
+		_mm_stream_si128((__m128i*)mem_addr, _mm_castps_si128(v));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ set
 #ifdef __SSE2__
 	template <>
@@ -381,6 +441,196 @@
 	}
 #endif
 
+	// -------------------------------------------------------------------------------------------------------- extract
+	template <int I>
+	struct _extract<float,I> {
+		static float apply(const reg r) {
+			return _mm_cvtss_f32(_mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, I)));
+		}
+	};
+
+#ifdef __SSE2__
+	template <int I>
+	struct _extract<double,I> {
+		static double apply(const reg r) {
+			return _mm_cvtsd_f64(_mm_shuffle_pd(_mm_castps_pd(r), _mm_castps_pd(r), I));
+		}
+	};
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <int I>
+	struct _extract<int64_t,I> {
+		static int64_t apply(const reg r) {
+#ifdef __SSE4_1__
+			return (int64_t)_mm_extract_epi64(_mm_castps_si128(r), I);
+#else
+			return (int64_t)_mm_cvtsi128_si64(_mm_shuffle_epi32(_mm_castps_si128(r), _MM_SHUFFLE(3, 2, 2*I+1, 2*I)));
+#endif
+		}
+	};
+#endif
+
+	template <int I>
+	struct _extract<int32_t,I> {
+		static int32_t apply(const reg r) {
+#ifdef __SSE4_1__
+			return (int32_t)_mm_extract_epi32(_mm_castps_si128(r), I);
+#else
+			return (int32_t)_mm_cvtsi128_si32(_mm_shuffle_epi32(_mm_castps_si128(r), _MM_SHUFFLE(0, 0, 0, I)));
+#endif
+		}
+	};
+
+	template <int I>
+	struct _extract<int16_t,I> {
+		static int16_t apply(const reg r) {
+			return (int16_t)_mm_extract_epi16(_mm_castps_si128(r), I);
+		}
+	};
+
+	template <int I>
+	struct _extract<int8_t,I> {
+		static int8_t apply(const reg r) {
+#ifdef __SSE4_1__
+			return (int8_t)_mm_extract_epi8(_mm_castps_si128(r), I);
+#else
+			return (int8_t)(_mm_extract_epi16(_mm_castps_si128(r), I / 2) >> (8 * (I % 2)));
+#endif
+		}
+	};
+#endif
+
+#ifdef __SSSE3__
+	// the bytes of the element 'index' are moved in the first bytes of the register (the other bytes are garbage)
+	template <typename T>
+	inline __m128i _extract_shuffle(const reg r, const uint32_t index) {
+		const auto offset = _mm_set1_epi8((int8_t)((index % nElReg<T>()) * sizeof(T)));
+		const auto bytes  = _mm_add_epi8(offset, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+		return _mm_shuffle_epi8(_mm_castps_si128(r), bytes);
+	}
+
+	template <>
+	inline double extract<double>(const reg r, const uint32_t index) {
+		return _mm_cvtsd_f64(_mm_castsi128_pd(_extract_shuffle<double>(r, index)));
+	}
+
+	template <>
+	inline float extract<float>(const reg r, const uint32_t index) {
+		return _mm_cvtss_f32(_mm_castsi128_ps(_extract_shuffle<float>(r, index)));
+	}
+
+#if defined(__x86_64__) || defined(_M_X64)
+	template <>
+	inline int64_t extract<int64_t>(const reg r, const uint32_t index) {
+		return (int64_t)_mm_cvtsi128_si64(_extract_shuffle<int64_t>(r, index));
+	}
+#endif
+
+	template <>
+	inline int32_t extract<int32_t>(const reg r, const uint32_t index) {
+		return (int32_t)_mm_cvtsi128_si32(_extract_shuffle<int32_t>(r, index));
+	}
+
+	template <>
+	inline int16_t extract<int16_t>(const reg r, const uint32_t index) {
+		return (int16_t)_mm_cvtsi128_si32(_extract_shuffle<int16_t>(r, index));
+	}
+
+	template <>
+	inline int8_t extract<int8_t>(const reg r, const uint32_t index) {
+		return (int8_t)_mm_cvtsi128_si32(_extract_shuffle<int8_t>(r, index));
+	}
+#endif
+
+	// -------------------------------------------------------------------------------------------------------- permute
+	// all the 32-bit and 64-bit permutations are immediate shuffles, the 16-bit permutations that stay in the 64-bit
+	// halves are 'pshuflw' + 'pshufhw' and the rotations are 'palignr'
+	template <int... I>
+	struct _permute<float,I...> {
+		static reg apply(const reg r) {
+			constexpr int imm = _perm_idx<I...>::imm(4, 2);
+			return _mm_shuffle_ps(r, r, imm);
+		}
+	};
+
+#ifdef __SSE2__
+	template <int... I>
+	struct _permute<double,I...> {
+		static reg apply(const reg r) {
+			constexpr int imm = _perm_idx<I...>::imm(2, 1);
+			return _mm_castpd_ps(_mm_shuffle_pd(_mm_castps_pd(r), _mm_castps_pd(r), imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int64_t,I...> {
+		static reg apply(const reg r) {
+			constexpr int imm = _perm_idx<I...>::imm(2, 1);
+			return _mm_castpd_ps(_mm_shuffle_pd(_mm_castps_pd(r), _mm_castps_pd(r), imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int32_t,I...> {
+		static reg apply(const reg r) {
+			constexpr int imm = _perm_idx<I...>::imm(4, 2);
+			return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(r), imm));
+		}
+	};
+
+	template <int... I>
+	struct _permute<int16_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::in_lanes(4) ? 1 : P::rotation() ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+			return mipp::_permute_shuff<int16_t,I...>(r);
+		}
+
+		static reg apply(const reg r, _perm_case<1>) {
+			constexpr int imm_lo = P::imm(4, 2, 0), imm_hi = P::imm(4, 2, 4);
+			const __m128i lo = _mm_shufflelo_epi16(_mm_castps_si128(r), imm_lo);
+			return _mm_castsi128_ps(_mm_shufflehi_epi16(lo, imm_hi));
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+#ifdef __SSSE3__
+			const __m128i v = _mm_castps_si128(r);
+			constexpr int imm = (P::rot() * 2) & 15;
+			return _mm_castsi128_ps(_mm_alignr_epi8(v, v, imm));
+#else
+			return mipp::_permute_shuff<int16_t,I...>(r);
+#endif
+		}
+	};
+
+	template <int... I>
+	struct _permute<int8_t,I...> {
+		using P = _perm_idx<I...>;
+
+		static reg apply(const reg r) {
+			return apply(r, _perm_case<P::rotation() ? 2 : 0>());
+		}
+
+		static reg apply(const reg r, _perm_case<0>) {
+			return mipp::_permute_shuff<int8_t,I...>(r);
+		}
+
+		static reg apply(const reg r, _perm_case<2>) {
+#ifdef __SSSE3__
+			const __m128i v = _mm_castps_si128(r);
+			constexpr int imm = P::rot() & 15;
+			return _mm_castsi128_ps(_mm_alignr_epi8(v, v, imm));
+#else
+			return mipp::_permute_shuff<int8_t,I...>(r);
+#endif
+		}
+	};
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ low
 	template <>
 	inline reg_2 low<double>(const reg v) {
@@ -1990,6 +2240,34 @@
 	}
 #endif
 
+#ifdef __SSE2__
+	template <>
+	inline msk cmplt<uint32_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi32((int32_t)0x80000000);
+		return _mm_cmplt_epi32(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+
+	template <>
+	inline msk cmplt<uint16_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+		return _mm_cmplt_epi16(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+
+	template <>
+	inline msk cmplt<uint8_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi8((int8_t)0x80);
+		return _mm_cmplt_epi8(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+#endif
+
+#ifdef __SSE4_2__
+	template <>
+	inline msk cmplt<uint64_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi64x((int64_t)0x8000000000000000);
+		return _mm_cmpgt_epi64(_mm_xor_si128(_mm_castps_si128(v2), bias), _mm_xor_si128(_mm_castps_si128(v1), bias));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmple
 	template <>
 	inline msk cmple<float>(const reg v1, const reg v2) {
@@ -2023,6 +2301,28 @@
 		return mipp::orb<16>(mipp::cmplt<int8_t>(v1, v2), mipp::cmpeq<int8_t>(v1, v2));
 	}
 
+#ifdef __SSE4_2__
+	template <>
+	inline msk cmple<uint64_t>(const reg v1, const reg v2) {
+		return mipp::orb<2>(mipp::cmplt<uint64_t>(v1, v2), mipp::cmpeq<int64_t>(v1, v2));
+	}
+#endif
+
+	template <>
+	inline msk cmple<uint32_t>(const reg v1, const reg v2) {
+		return mipp::orb<4>(mipp::cmplt<uint32_t>(v1, v2), mipp::cmpeq<int32_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmple<uint16_t>(const reg v1, const reg v2) {
+		return mipp::orb<8>(mipp::cmplt<uint16_t>(v1, v2), mipp::cmpeq<int16_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmple<uint8_t>(const reg v1, const reg v2) {
+		return mipp::orb<16>(mipp::cmplt<uint8_t>(v1, v2), mipp::cmpeq<int8_t>(v1, v2));
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- cmpgt
 	template <>
 	inline msk cmpgt<float>(const reg v1, const reg v2) {
@@ -2051,6 +2351,34 @@
 	}
 #endif
 
+#ifdef __SSE2__
+	template <>
+	inline msk cmpgt<uint32_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi32((int32_t)0x80000000);
+		return _mm_cmpgt_epi32(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+
+	template <>
+	inline msk cmpgt<uint16_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+		return _mm_cmpgt_epi16(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+
+	template <>
+	inline msk cmpgt<uint8_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi8((int8_t)0x80);
+		return _mm_cmpgt_epi8(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+#endif
+
+#ifdef __SSE4_2__
+	template <>
+	inline msk cmpgt<uint64_t>(const reg v1, const reg v2) {
+		const __m128i bias = _mm_set1_epi64x((int64_t)0x8000000000000000);
+		return _mm_cmpgt_epi64(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+	}
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- cmpge
 	template <>
 	inline msk cmpge<float>(const reg v1, const reg v2) {
@@ -2084,6 +2412,28 @@
 		return mipp::orb<16>(mipp::cmpgt<int8_t>(v1, v2), mipp::cmpeq<int8_t>(v1, v2));
 	}
 
+#ifdef __SSE4_2__
+	template <>
+	inline msk cmpge<uint64_t>(const reg v1, const reg v2) {
+		return mipp::orb<2>(mipp::cmpgt<uint64_t>(v1, v2), mipp::cmpeq<int64_t>(v1, v2));
+	}
+#endif
+
+	template <>
+	inline msk cmpge<uint32_t>(const reg v1, const reg v2) {
+		return mipp::orb<4>(mipp::cmpgt<uint32_t>(v1, v2), mipp::cmpeq<int32_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmpge<uint16_t>(const reg v1, const reg v2) {
+		return mipp::orb<8>(mipp::cmpgt<uint16_t>(v1, v2), mipp::cmpeq<int16_t>(v1, v2));
+	}
+
+	template <>
+	inline msk cmpge<uint8_t>(const reg v1, const reg v2) {
+		return mipp::orb<16>(mipp::cmpgt<uint8_t>(v1, v2), mipp::cmpeq<int8_t>(v1, v2));
+	}
+
 	// ------------------------------------------------------------------------------------------------------------ add
 	template <>
 	inline reg add<float>(const reg v1, const reg v2) {
@@ -2117,6 +2467,18 @@
 	}
 #endif
 
+#ifdef __SSE2__
+	template <>
+	inline reg add<uint16_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_adds_epu16(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+
+	template <>
+	inline reg add<uint8_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_adds_epu8(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ sub
 	template <>
 	inline reg sub<float>(const reg v1, const reg v2) {
@@ -2150,6 +2512,18 @@
 	}
 #endif
 
+#ifdef __SSE2__
+	template <>
+	inline reg sub<uint16_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_subs_epu16(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+
+	template <>
+	inline reg sub<uint8_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_subs_epu8(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ mul
 	template <>
 	inline reg mul<float>(const reg v1, const reg v2) {
@@ -2222,6 +2596,49 @@
 #endif
 #endif
 
+#ifdef __SSE4_2__
+	template <>
+	inline reg min<uint64_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_blendv_epi8(_mm_castps_si128(v1), _mm_castps_si128(v2),
+		                                        mipp::cmpgt<uint64_t>(v1, v2)));
+	}
+#endif
+
+#ifdef __SSE4_1__
+	template <>
+	inline reg min<uint32_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_min_epu32(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+
+	template <>
+	inline reg min<uint16_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_min_epu16(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#elif defined(__SSE2__)
+	// no unsigned 32-bit min before SSE4.1: the signed comparison of the values with their sign bit flipped
+	template <>
+	inline reg min<uint32_t>(const reg v1, const reg v2) {
+		auto bias = _mm_set1_epi32((int32_t)0x80000000);
+		auto a = _mm_castps_si128(v1), b = _mm_castps_si128(v2);
+		auto gt = _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+		return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a)));
+	}
+
+	template <>
+	inline reg min<uint16_t>(const reg v1, const reg v2) {
+		auto bias = _mm_set1_epi16((int16_t)0x8000);
+		auto r = _mm_min_epi16(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+		return _mm_castsi128_ps(_mm_xor_si128(r, bias));
+	}
+#endif
+
+#ifdef __SSE2__
+	template <>
+	inline reg min<uint8_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_min_epu8(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ max
 	template <>
 	inline reg max<float>(const reg v1, const reg v2) {
@@ -2254,6 +2671,49 @@
 #endif
 #endif
 
+#ifdef __SSE4_2__
+	template <>
+	inline reg max<uint64_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_blendv_epi8(_mm_castps_si128(v2), _mm_castps_si128(v1),
+		                                        mipp::cmpgt<uint64_t>(v1, v2)));
+	}
+#endif
+
+#ifdef __SSE4_1__
+	template <>
+	inline reg max<uint32_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_max_epu32(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+
+	template <>
+	inline reg max<uint16_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_max_epu16(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#elif defined(__SSE2__)
+	// no unsigned 32-bit max before SSE4.1: the signed comparison of the values with their sign bit flipped
+	template <>
+	inline reg max<uint32_t>(const reg v1, const reg v2) {
+		auto bias = _mm_set1_epi32((int32_t)0x80000000);
+		auto a = _mm_castps_si128(v1), b = _mm_castps_si128(v2);
+		auto gt = _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+		return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b)));
+	}
+
+	template <>
+	inline reg max<uint16_t>(const reg v1, const reg v2) {
+		auto bias = _mm_set1_epi16((int16_t)0x8000);
+		auto r = _mm_max_epi16(_mm_xor_si128(_mm_castps_si128(v1), bias), _mm_xor_si128(_mm_castps_si128(v2), bias));
+		return _mm_castsi128_ps(_mm_xor_si128(r, bias));
+	}
+#endif
+
+#ifdef __SSE2__
+	template <>
+	inline reg max<uint8_t>(const reg v1, const reg v2) {
+		return _mm_castsi128_ps(_mm_max_epu8(_mm_castps_si128(v1), _mm_castps_si128(v2)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------------ msb
 	template <>
 	inline reg msb<float>(const reg v1) {
@@ -2530,6 +2990,13 @@
 		auto v_bis = v;
 		return log_ps(v_bis);
 	}
+
+#ifdef __SSE2__
+	template <>
+	inline reg log<double>(const reg v) {
+		return _mm_castpd_ps(log_pd(_mm_castps_pd(v)));
+	}
+#endif
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ exp
@@ -2549,6 +3016,13 @@
 		auto v_bis = v;
 		return exp_ps(v_bis);
 	}
+
+#ifdef __SSE2__
+	template <>
+	inline reg exp<double>(const reg v) {
+		return _mm_castpd_ps(exp_pd(_mm_castps_pd(v)));
+	}
+#endif
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ sin
@@ -2568,6 +3042,13 @@
 		auto v_bis = v;
 		return sin_ps(v_bis);
 	}
+
+#ifdef __SSE2__
+	template <>
+	inline reg sin<double>(const reg v) {
+		return _mm_castpd_ps(sin_pd(_mm_castps_pd(v)));
+	}
+#endif
 #endif
 
 	// ------------------------------------------------------------------------------------------------------------ cos
@@ -2587,6 +3068,13 @@
 		auto v_bis = v;
 		return cos_ps(v_bis);
 	}
+
+#ifdef __SSE2__
+	template <>
+	inline reg cos<double>(const reg v) {
+		return _mm_castpd_ps(cos_pd(_mm_castps_pd(v)));
+	}
+#endif
 #endif
 
 	// --------------------------------------------------------------------------------------------------------- sincos
@@ -2605,6 +3093,13 @@
 	inline void sincos<float>(const reg x, reg &s, reg &c) {
 		sincos_ps(x, &s, &c);
 	}
+
+#ifdef __SSE2__
+	template <>
+	inline void sincos<double>(const reg x, reg &s, reg &c) {
+		sincos_pd(_mm_castps_pd(x), (__m128d*)&s, (__m128d*)&c);
+	}
+#endif
 #endif
 
 	// ---------------------------------------------------------------------------------------------------------- fmadd
@@ -2895,6 +3390,23 @@
 	}
 #endif
 
+#ifdef __SSE4_1__
+	template <>
+	inline reg cvt<uint8_t,uint16_t>(const reg_2 v) {
+		return _mm_castsi128_ps(_mm_cvtepu8_epi16(_mm_castpd_si128(v)));
+	}
+
+	template <>
+	inline reg cvt<uint16_t,uint32_t>(const reg_2 v) {
+		return _mm_castsi128_ps(_mm_cvtepu16_epi32(_mm_castpd_si128(v)));
+	}
+
+	template <>
+	inline reg cvt<uint32_t,uint64_t>(const reg_2 v) {
+		return _mm_castsi128_ps(_mm_cvtepu32_epi64(_mm_castpd_si128(v)));
+	}
+#endif
+
 	// ----------------------------------------------------------------------------------------------------------- pack
 #ifdef __SSE2__
 	template <>
@@ -2908,6 +3420,23 @@
 	}
 #endif
 
+#ifdef __SSE4_1__
+	// 'packus' takes signed inputs, the values are first saturated to the output range
+	template <>
+	inline reg pack<uint32_t,uint16_t>(const reg v1, const reg v2) {
+		const __m128i max = _mm_set1_epi32(0xFFFF);
+		return _mm_castsi128_ps(_mm_packus_epi32(_mm_min_epu32(_mm_castps_si128(v1), max),
+		                                         _mm_min_epu32(_mm_castps_si128(v2), max)));
+	}
+
+	template <>
+	inline reg pack<uint16_t,uint8_t>(const reg v1, const reg v2) {
+		const __m128i max = _mm_set1_epi16(0xFF);
+		return _mm_castsi128_ps(_mm_packus_epi16(_mm_min_epu16(_mm_castps_si128(v1), max),
+		                                         _mm_min_epu16(_mm_castps_si128(v2), max)));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------ reduction
 	template <red_op<double> OP>
 	struct _reduction<double,OP>
@@ -2993,17 +3522,14 @@
 		}
 	};
 
-#ifdef __SSSE3__
 	template <red_op<int16_t> OP>
 	struct _reduction<int16_t,OP>
 	{
 		static reg apply(const reg v1) {
-			__m128i mask_16 = _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
-
 			auto val = v1;
 			val = OP(val, _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(val), _MM_SHUFFLE(1, 0, 3, 2))));
 			val = OP(val, _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(val), _MM_SHUFFLE(2, 3, 0, 1))));
-			val = OP(val, _mm_castsi128_ps(_mm_shuffle_epi8 (_mm_castps_si128(val), mask_16)));
+			val = OP(val, _mm_castsi128_ps(_mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_castps_si128(val), _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1))));
 			return val;
 		}
 	};
@@ -3012,16 +3538,13 @@
 	struct _Reduction<int16_t,OP>
 	{
 		static Reg<int16_t> apply(const Reg<int16_t> v1) {
-			__m128i mask_16 = _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
-
 			auto val = v1;
 			val = OP(val, Reg<int16_t>(_mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(val.r), _MM_SHUFFLE(1, 0, 3, 2)))));
 			val = OP(val, Reg<int16_t>(_mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(val.r), _MM_SHUFFLE(2, 3, 0, 1)))));
-			val = OP(val, Reg<int16_t>(_mm_castsi128_ps(_mm_shuffle_epi8 (_mm_castps_si128(val.r), mask_16))));
+			val = OP(val, Reg<int16_t>(_mm_castsi128_ps(_mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_castps_si128(val.r), _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)))));
 			return val;
 		}
 	};
-#endif
 
 #ifdef __SSSE3__
 	template <red_op<int8_t> OP>
@@ -3057,6 +3580,57 @@
 	};
 #endif
 
+	// ----------------------------------------------------------------------------------------------------------- scan
+#ifdef __SSE2__
+#define MIPP_SSE_SCAN_SHIFT(T)                                                                                         \
+	template <int S>                                                                                                   \
+	struct _scan_shift<T,S>                                                                                            \
+	{                                                                                                                  \
+		static reg apply(const reg v) {                                                                                \
+			return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), S * (int)sizeof(T)));                          \
+		}                                                                                                              \
+	};
+
+	MIPP_SSE_SCAN_SHIFT(double)
+	MIPP_SSE_SCAN_SHIFT(float)
+	MIPP_SSE_SCAN_SHIFT(int64_t)
+	MIPP_SSE_SCAN_SHIFT(int32_t)
+	MIPP_SSE_SCAN_SHIFT(int16_t)
+	MIPP_SSE_SCAN_SHIFT(int8_t)
+	MIPP_SSE_SCAN_SHIFT(uint64_t)
+	MIPP_SSE_SCAN_SHIFT(uint32_t)
+	MIPP_SSE_SCAN_SHIFT(uint16_t)
+	MIPP_SSE_SCAN_SHIFT(uint8_t)
+
+#undef MIPP_SSE_SCAN_SHIFT
+#endif
+
+	// ------------------------------------------------------------------------------------------------------------ dot
+#ifdef __SSE2__
+	template <>
+	struct _dot_acc<int16_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m128i p = _mm_madd_epi16(_mm_castps_si128(a), _mm_castps_si128(b));
+			return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(acc), p));
+		}
+	};
+
+	// the even and the odd bytes are sign extended in 16-bit elements ('pmaddubsw' multiplies unsigned bytes by signed
+	// bytes and saturates)
+	template <>
+	struct _dot_acc<int8_t,int32_t>
+	{
+		static reg apply(const reg acc, const reg a, const reg b) {
+			const __m128i ai = _mm_castps_si128(a), bi = _mm_castps_si128(b);
+			const __m128i ae = _mm_srai_epi16(_mm_slli_epi16(ai, 8), 8), ao = _mm_srai_epi16(ai, 8);
+			const __m128i be = _mm_srai_epi16(_mm_slli_epi16(bi, 8), 8), bo = _mm_srai_epi16(bi, 8);
+			const __m128i p = _mm_add_epi32(_mm_madd_epi16(ae, be), _mm_madd_epi16(ao, bo));
+			return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(acc), p));
+		}
+	};
+#endif
+
 	// ---------------------------------------------------------------------------------------------------------- testz
 #ifdef __SSE4_1__
 	template <>
@@ -3231,6 +3805,131 @@
 	}
 #endif
 
+	// -------------------------------------------------------------------------------------------------------- to_bits
+#ifdef __SSE2__
+	template <>
+	inline uint64_t to_bits<2>(const msk m) {
+		return (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(m));
+	}
+
+	template <>
+	inline uint64_t to_bits<4>(const msk m) {
+		return (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(m));
+	}
+
+	template <>
+	inline uint64_t to_bits<8>(const msk m) {
+		return (uint64_t)_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()));
+	}
+
+	template <>
+	inline uint64_t to_bits<16>(const msk m) {
+		return (uint64_t)_mm_movemask_epi8(m);
+	}
+#endif
+
+	// ---------------------------------------------------------------------------------------------- compress / expand
+#ifdef __SSSE3__
+	// 'pshufb' indexes of the 16-bit and the 32-bit elements from the positions given by '_compress_lut' or
+	// '_expand_lut' (the unused positions stay negative and 'pshufb' writes zeros)
+	inline __m128i _shuffle_idx_epi16(const uint64_t *pos) {
+		auto idx = _mm_loadl_epi64((const __m128i*)pos);
+		idx = _mm_unpacklo_epi8(idx, idx);
+		idx = _mm_add_epi8(idx, idx);
+		return _mm_add_epi8(idx, _mm_set1_epi16(0x0100));
+	}
+
+	inline __m128i _shuffle_idx_epi32(const uint64_t *pos) {
+		auto idx = _mm_loadl_epi64((const __m128i*)pos);
+		idx = _mm_unpacklo_epi8(idx, idx);
+		idx = _mm_unpacklo_epi16(idx, idx);
+		idx = _mm_add_epi8(idx, idx);
+		idx = _mm_add_epi8(idx, idx);
+		return _mm_add_epi8(idx, _mm_set1_epi32(0x03020100));
+	}
+
+	inline reg _shuffle_bytes(const reg v, const __m128i idx) {
+		return _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(v), idx));
+	}
+
+	template <>
+	inline reg compress<double>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg compress<float>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_compress_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<int64_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_compress_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg compress<int32_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_compress_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg compress<int16_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi16(mipp::_compress_lut() + to_bits<8>(m)));
+	}
+
+	// the two halves are compressed separately, then the indexes of the high half are shifted by the number of
+	// elements kept in the low half
+	template <>
+	inline reg compress<int8_t>(const reg v, const msk m) {
+		const auto bits  = (uint32_t)to_bits<16>(m);
+		const auto ff_hi = _mm_set_epi32(-1, -1, 0, 0);
+		const auto cnt   = _mm_set1_epi8((char)mipp::_popcnt64(bits & 0xFF));
+		const auto iota  = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		const auto lut   = mipp::_compress_lut();
+
+		const auto lo = _mm_or_si128(_mm_loadl_epi64((const __m128i*)(lut + (bits & 0xFF))), ff_hi);
+		const auto hi = _mm_adds_epu8(_mm_or_si128(_mm_loadl_epi64((const __m128i*)(lut + (bits >> 8))), ff_hi),
+		                              _mm_set1_epi8(8));
+		const auto hi_shifted = _mm_shuffle_epi8(hi, _mm_sub_epi8(iota, cnt));
+		return _shuffle_bytes(v, _mm_and_si128(lo, _mm_or_si128(hi_shifted, _mm_cmpgt_epi8(cnt, iota))));
+	}
+
+	template <>
+	inline reg expand<double>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg expand<float>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_expand_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<int64_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_expand_lut() + _dup_bits4((uint32_t)to_bits<2>(m))));
+	}
+
+	template <>
+	inline reg expand<int32_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi32(mipp::_expand_lut() + to_bits<4>(m)));
+	}
+
+	template <>
+	inline reg expand<int16_t>(const reg v, const msk m) {
+		return _shuffle_bytes(v, _shuffle_idx_epi16(mipp::_expand_lut() + to_bits<8>(m)));
+	}
+
+	// the elements of the high half are starting after the ones of the low half (saturated add, 0xFF stays 0xFF)
+	template <>
+	inline reg expand<int8_t>(const reg v, const msk m) {
+		const auto bits = (uint32_t)to_bits<16>(m);
+		const auto cnt  = _mm_set1_epi8((char)mipp::_popcnt64(bits & 0xFF));
+		const auto lo   = _mm_loadl_epi64((const __m128i*)(mipp::_expand_lut() + (bits & 0xFF)));
+		const auto hi   = _mm_adds_epu8(_mm_loadl_epi64((const __m128i*)(mipp::_expand_lut() + (bits >> 8))), cnt);
+		return _shuffle_bytes(v, _mm_unpacklo_epi64(lo, hi));
+	}
+#endif
+
 	// ------------------------------------------------------------------------------------------------------ transpose
 	template <>
 	inline void transpose<int16_t>(reg tab[nElReg<int16_t>()]) {
@@ -0,0 +1,1197 @@
+#include "mipp.h"
+
+// ----------------------------------------------------------------------------------------------------- accuracy tiers
+// --------------------------------------------------------------------------------------------------------------------
+// The 'log', 'exp', 'sin', 'cos' and 'sincos' functions take an optional accuracy tier as second template argument:
+//
+//   mipp::reg y = mipp::exp<float,mipp::fast>(x);
+//
+//   - 'fast':     short polynomials (relative error below 2e-4), the denormal inputs and results are flushed to zero
+//                 and the 'sin'/'cos' reduction is only accurate for |x| < 1e3 in single precision,
+//   - 'balanced': the default implementations ('mipp::exp<T>(x)'), the Cephes polynomials of 'src/math' (1 or 2 ULP),
+//   - 'precise':  longer polynomials evaluated as a small correction of an exact leading term, 1 ULP at most (the
+//                 'sin'/'cos' bound holds for |x| < 1e4 in single precision and |x| < 1e6 in double precision).
+//
+// All the tiers return the same special values (NaN, infinities, signed zeros). The 'fast' and 'precise' kernels are
+// written with the generic operations and get the integer parts with the rounding of an addition to '1.5 * 2^23' (or
+// '1.5 * 2^52'): they require a strict floating-point model ('-ffast-math' breaks them). In double precision they
+// require the 64-bit integer shifts (AVX2 on x86 AVX targets).
+enum class Accuracy : int { fast = 0, balanced, precise };
+
+constexpr Accuracy fast     = Accuracy::fast;
+constexpr Accuracy balanced = Accuracy::balanced;
+constexpr Accuracy precise  = Accuracy::precise;
+
+// floating-point format of 'T'
+template <typename T> struct _fp;
+
+template <>
+struct _fp<float>
+{
+	using I = int32_t;
+	static constexpr int   bits    = 32;
+	static constexpr int   mant    = 23;
+	static constexpr float bias    = 127.f;
+	static constexpr float two_m   = 8388608.f;  // 2^23
+	static constexpr float shifter = 12582912.f; // 1.5 * 2^23
+	static constexpr float log2e   = 1.44269504088896341f;
+	static constexpr float ln2     = 0.693147180559945309f;
+	static constexpr float two_pi  = 0.636619772367581343f; // 2 / pi
+};
+
+template <>
+struct _fp<double>
+{
+	using I = int64_t;
+	static constexpr int    bits    = 64;
+	static constexpr int    mant    = 52;
+	static constexpr double bias    = 1023.;
+	static constexpr double two_m   = 4503599627370496.; // 2^52
+	static constexpr double shifter = 6755399441055744.; // 1.5 * 2^52
+	static constexpr double log2e   = 1.44269504088896340736;
+	static constexpr double ln2     = 0.693147180559945309417;
+	static constexpr double two_pi  = 0.636619772367581343076; // 2 / pi
+};
+
+// 'c0 + x * (c1 + x * (c2 + ...))'
+template <typename T>
+inline reg _poly(const reg, const T c)
+{
+	return mipp::set1<T>(c);
+}
+
+template <typename T, typename... C>
+inline reg _poly(const reg x, const T c, const C... cs)
+{
+	return mipp::fmadd<T>(mipp::_poly<T>(x, cs...), x, mipp::set1<T>(c));
+}
+
+// 'x' rounded to the nearest integer (ties to even), valid for |x| < 2^22 (or 2^51)
+template <typename T>
+inline reg _rint(const reg x)
+{
+	const reg s = mipp::set1<T>(_fp<T>::shifter);
+	return mipp::sub<T>(mipp::add<T>(x, s), s);
+}
+
+// 2^n for the integer values 'n' in the range of the normal exponents
+template <typename T>
+inline reg _pow2i(const reg n)
+{
+	const reg k = mipp::add<T>(n, mipp::set1<T>(_fp<T>::shifter + _fp<T>::bias)); // the low bits are 'n + bias'
+	return mipp::lshift<typename _fp<T>::I>(k, _fp<T>::mant);
+}
+
+// unbiased exponent of the positive normal numbers 'x' (as a floating-point value)
+template <typename T>
+inline reg _exponent(const reg x)
+{
+	// the biased exponent is put in the mantissa of 2^23 (or 2^52)
+	const reg e = mipp::orb<T>(mipp::rshift<typename _fp<T>::I>(x, _fp<T>::mant), mipp::set1<T>(_fp<T>::two_m));
+	return mipp::sub<T>(e, mipp::set1<T>(_fp<T>::two_m + _fp<T>::bias));
+}
+
+// mantissa of the positive normal numbers 'x', in [1, 2[
+template <typename T>
+inline reg _mantissa(const reg x)
+{
+	const reg mask = mipp::set1<typename _fp<T>::I>(((typename _fp<T>::I)1 << _fp<T>::mant) -1);
+	return mipp::orb<T>(mipp::andb<T>(x, mask), mipp::set1<T>((T)1));
+}
+
+// polynomials of the tiers, fitted with the Remez algorithm on the reduced ranges
+template <typename T, Accuracy A> struct _poly_exp;   // e^r = 1 + r + r^2 * P(r), |r| <= ln(2) / 2 ('fast': e^r = P(r))
+template <typename T, Accuracy A> struct _poly_log;   // 'fast': log(1 + f) = f + f^2 * P(f); 'precise': see '_log'
+template <typename T, Accuracy A> struct _poly_sin;   // sin(r) = r + r^3 * P(r^2), |r| <= pi / 4
+template <typename T, Accuracy A> struct _poly_cos;   // 'fast': cos(r) = 1 + r^2 * P(r^2); 'precise': see '_sincos'
+
+template <typename T>
+struct _poly_exp<T,fast> {
+	static reg apply(const reg r) {
+		return mipp::_poly<T>(r, (T)9.99928073540495621e-01, (T)1.00016418576109500e+00, (T)5.04963264182240357e-01,
+		                         (T)1.65668423479644111e-01);
+	}
+};
+
+template <>
+struct _poly_exp<float,precise> {
+	static reg apply(const reg r) {
+		return mipp::_poly<float>(r, 4.999999404e-01f, 1.666652113e-01f, 4.166838899e-02f, 8.368710056e-03f,
+		                             1.381461276e-03f);
+	}
+};
+
+template <>
+struct _poly_exp<double,precise> {
+	static reg apply(const reg r) {
+		return mipp::_poly<double>(r, 5.00000000000001110e-01, 1.66666666666664132e-01, 4.16666666665301763e-02,
+		                              8.33333333349437107e-03, 1.38888889436191375e-03, 1.98412695066828038e-04,
+		                              2.48014931158351713e-05, 2.75575863820536826e-06, 2.76302404746636082e-07,
+		                              2.50000237535559624e-08);
+	}
+};
+
+template <typename T>
+struct _poly_log<T,fast> {
+	static reg apply(const reg f) {
+		return mipp::_poly<T>(f, (T)-4.98402098173959751e-01, (T)3.32401049160540252e-01, (T)-2.88589615213524997e-01,
+		                         (T)2.28751576508125692e-01);
+	}
+};
+
+template <>
+struct _poly_log<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, 6.666677594e-01f, 3.997754157e-01f, 2.987172902e-01f);
+	}
+};
+
+template <>
+struct _poly_log<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, 6.66666666666673402e-01, 3.99999999994145650e-01, 2.85714287424112090e-01,
+		                              2.22221985709343373e-01, 1.81835644333369656e-01, 1.53140480653931488e-01,
+		                              1.47959720359184976e-01);
+	}
+};
+
+template <typename T>
+struct _poly_sin<T,fast> {
+	static reg apply(const reg z) {
+		return mipp::_poly<T>(z, (T)-1.66633903772950148e-01, (T)8.16328192094667622e-03);
+	}
+};
+
+template <>
+struct _poly_sin<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, -1.666665524e-01f, 8.332160302e-03f, -1.951528247e-04f);
+	}
+};
+
+template <>
+struct _poly_sin<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, -1.66666666666666297e-01, 8.33333333332210609e-03, -1.98412698295805562e-04,
+		                               2.75573136185064034e-06, -2.50507473435851003e-08, 1.58962074187416361e-10);
+	}
+};
+
+template <typename T>
+struct _poly_cos<T,fast> {
+	static reg apply(const reg z) {
+		return mipp::_poly<T>(z, (T)-4.99760557086320834e-01, (T)4.04584522644707567e-02);
+	}
+};
+
+template <>
+struct _poly_cos<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, 4.166665301e-02f, -1.388765406e-03f, 2.446383769e-05f);
+	}
+};
+
+template <>
+struct _poly_cos<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, 4.16666666666665950e-02, -1.38888888888728671e-03, 2.48015872887349047e-05,
+		                              -2.75573141462037134e-07, 2.08756964436131196e-09, -1.13583143135757524e-11);
+	}
+};
+
+// ln(2) and pi / 2 split in parts with trailing zeros (the products by the small integers are exact)
+template <typename T> struct _cw;
+
+template <>
+struct _cw<float>
+{
+	static constexpr float ln2_hi  = 0.693359375f,   ln2_lo  = -2.12194440e-4f;                       // exp
+	static constexpr float ln2_hi2 = 0.693145751953125f, ln2_lo2 = 1.42860676533018704e-06f;          // log
+	static constexpr float pio2_1  = 1.5703125f,     pio2_2  = 4.837512969970703125e-4f, pio2_3 = 7.54953362047672271728515625e-8f;
+	static constexpr float pio2_4  = 2.5633440682570896e-12f;
+	static constexpr float pio2_2f = 4.83826794896619231e-4f;                                          // 'fast' tail
+	static constexpr float exp_max = 88.8f, exp_min = -104.f;
+	static constexpr float exp_max_fast = 88.3762626f, exp_min_fast = -87.3365479f;
+};
+
+template <>
+struct _cw<double>
+{
+	static constexpr double ln2_hi  = 6.93147180369123816490e-01, ln2_lo  = 1.90821492927058770002e-10;
+	static constexpr double ln2_hi2 = 6.93147180369123816490e-01, ln2_lo2 = 1.90821492927058770002e-10;
+	static constexpr double pio2_1  = 1.57079632673412561417e+00, pio2_2  = 6.077105485502443116274662315845489501953125e-11,
+	                        pio2_3  = -4.97899625022072065106725418737534938e-17, pio2_4 = -2.940788670387328e-27;
+	static constexpr double pio2_2f = 6.07710050650619224932e-11;
+	static constexpr double exp_max = 709.9, exp_min = -745.2;
+	static constexpr double exp_max_fast = 709.436139303, exp_min_fast = -708.396418532;
+};
+
+// e^x ('balanced' is the implementation of the instruction set)
+template <typename T, Accuracy A>
+struct _exp
+{
+	static reg apply(const reg x) { return mipp::exp<T>(x); }
+};
+
+template <typename T>
+struct _exp<T,fast>
+{
+	static reg apply(const reg x) {
+		const reg n = mipp::_rint<T>(mipp::mul<T>(x, mipp::set1<T>(_fp<T>::log2e)));
+		const reg r = mipp::fnmadd<T>(n, mipp::set1<T>(_fp<T>::ln2), x);
+		reg y = mipp::mul<T>(_poly_exp<T,fast>::apply(r), mipp::_pow2i<T>(n));
+		y = mipp::blend<T>(mipp::set1<T>(std::numeric_limits<T>::infinity()), y,
+		                   mipp::cmpgt<T>(x, mipp::set1<T>(_cw<T>::exp_max_fast)));
+		return mipp::blend<T>(mipp::set0<T>(), y, mipp::cmplt<T>(x, mipp::set1<T>(_cw<T>::exp_min_fast)));
+	}
+};
+
+// 'x = n * ln(2) + r + dr' with |r| <= ln(2) / 2 and 'dr' the rounding error of 'r'
+template <typename T>
+inline reg _exp_reduce(const reg x, reg &n, reg &dr)
+{
+	n = mipp::_rint<T>(mipp::mul<T>(x, mipp::set1<T>(_fp<T>::log2e)));
+	const reg hi = mipp::fnmadd<T>(n, mipp::set1<T>(_cw<T>::ln2_hi), x); // exact
+	const reg lo = mipp::mul<T>(n, mipp::set1<T>(-_cw<T>::ln2_lo));
+	const reg r  = mipp::add<T>(hi, lo);
+	dr = mipp::add<T>(mipp::sub<T>(hi, r), lo);
+	return r;
+}
+
+// e^(r + dr) = (1 + r) + (r^2 * P(r) + dr * (1 + r)), '1 + r' is rounded once with its error kept in 'e'
+template <typename T>
+inline reg _exp_kernel(const reg r, const reg dr)
+{
+	const reg one = mipp::set1<T>((T)1);
+	const reg s   = mipp::add<T>(one, r);
+	const reg e   = mipp::add<T>(mipp::sub<T>(one, s), r);
+	const reg t   = mipp::mul<T>(mipp::mul<T>(r, r), _poly_exp<T,precise>::apply(r));
+	return mipp::add<T>(s, mipp::add<T>(mipp::add<T>(t, mipp::fmadd<T>(dr, r, dr)), e));
+}
+
+// p * 2^n, 2^n is applied in two steps to round only once in the denormal range
+template <typename T>
+inline reg _ldexp(const reg p, const reg n)
+{
+	const reg n1 = mipp::_rint<T>(mipp::mul<T>(n, mipp::set1<T>((T)0.5)));
+	return mipp::mul<T>(mipp::mul<T>(p, mipp::_pow2i<T>(n1)), mipp::_pow2i<T>(mipp::sub<T>(n, n1)));
+}
+
+template <typename T>
+struct _exp<T,precise>
+{
+	static reg apply(const reg x) {
+		reg n, dr;
+		const reg r = mipp::_exp_reduce<T>(x, n, dr);
+		reg y = mipp::_ldexp<T>(mipp::_exp_kernel<T>(r, dr), n);
+		y = mipp::blend<T>(mipp::set1<T>(std::numeric_limits<T>::infinity()), y,
+		                   mipp::cmpgt<T>(x, mipp::set1<T>(_cw<T>::exp_max)));
+		return mipp::blend<T>(mipp::set0<T>(), y, mipp::cmplt<T>(x, mipp::set1<T>(_cw<T>::exp_min)));
+	}
+};
+
+// log(x)
+template <typename T, Accuracy A>
+struct _log
+{
+	static reg apply(const reg x) { return mipp::log<T>(x); }
+};
+
+// 'x = 2^e * m' with 'm' in [sqrt(2) / 2, sqrt(2)[, returns 'f = m - 1'
+template <typename T>
+inline reg _log_reduce(const reg x, reg &e)
+{
+	reg m = mipp::_mantissa<T>(x);
+	e = mipp::add<T>(e, mipp::_exponent<T>(x));
+	const msk big = mipp::cmpgt<T>(m, mipp::set1<T>((T)1.41421356237309504880));
+	m = mipp::blend<T>(mipp::mul<T>(m, mipp::set1<T>((T)0.5)), m, big);
+	e = mipp::blend<T>(mipp::add<T>(e, mipp::set1<T>((T)1)), e, big);
+	return mipp::sub<T>(m, mipp::set1<T>((T)1));
+}
+
+// '_log_reduce' for all the positive numbers: the denormals are scaled to normal numbers
+template <typename T>
+inline reg _log_reduce_den(const reg x, reg &e)
+{
+	const T   scale = (T)4 * _fp<T>::two_m;
+	const msk den   = mipp::cmplt<T>(x, mipp::set1<T>(std::numeric_limits<T>::min()));
+	const reg xn    = mipp::blend<T>(mipp::mul<T>(x, mipp::set1<T>(scale)), x, den);
+	e = mipp::blend<T>(mipp::set1<T>((T)(-_fp<T>::mant - 2)), mipp::set0<T>(), den);
+	return mipp::_log_reduce<T>(xn, e);
+}
+
+// 'y' with the results of log(x) on 0, +inf, the negative numbers and NaN
+template <typename T>
+inline reg _log_special(const reg x, const reg y, const msk zero)
+{
+	const reg inf = mipp::set1<T>(std::numeric_limits<T>::infinity());
+	reg r = mipp::blend<T>(mipp::set1<T>(-std::numeric_limits<T>::infinity()), y, zero);
+	    r = mipp::blend<T>(inf, r, mipp::cmpeq<T>(x, inf));
+	return mipp::blend<T>(r, mipp::set1<T>(std::numeric_limits<T>::quiet_NaN()), mipp::cmpge<T>(x, mipp::set0<T>()));
+}
+
+template <typename T>
+struct _log<T,fast>
+{
+	static reg apply(const reg x) {
+		reg e = mipp::set0<T>();
+		const reg f = mipp::_log_reduce<T>(x, e);
+		const reg y = mipp::fmadd<T>(mipp::mul<T>(f, f), _poly_log<T,fast>::apply(f), f);
+		const msk zero = mipp::cmplt<T>(x, mipp::set1<T>(std::numeric_limits<T>::min()));
+		return mipp::_log_special<T>(x, mipp::fmadd<T>(e, mipp::set1<T>(_fp<T>::ln2), y), zero);
+	}
+};
+
+// log(1 + f) = 2 * atanh(s) = 2 * s + s * R(s^2) with 's = f / (2 + f)', evaluated as 'f - (f^2 / 2 - s * (f^2 / 2 + R))'
+// to keep 'f' exact (as in the fdlibm)
+template <typename T>
+struct _log<T,precise>
+{
+	static reg apply(const reg x) {
+		reg e;
+		const reg f    = mipp::_log_reduce_den<T>(x, e);
+		const reg s    = mipp::div<T>(f, mipp::add<T>(f, mipp::set1<T>((T)2)));
+		const reg z    = mipp::mul<T>(s, s);
+		const reg R    = mipp::mul<T>(z, _poly_log<T,precise>::apply(z));
+		const reg hfsq = mipp::mul<T>(mipp::mul<T>(f, f), mipp::set1<T>((T)0.5));
+		const reg lo   = mipp::fmadd<T>(s, mipp::add<T>(hfsq, R), mipp::mul<T>(e, mipp::set1<T>(_cw<T>::ln2_lo2)));
+		const reg y    = mipp::fmsub<T>(e, mipp::set1<T>(_cw<T>::ln2_hi2), mipp::sub<T>(mipp::sub<T>(hfsq, lo), f));
+		return mipp::_log_special<T>(x, y, mipp::cmpeq<T>(x, mipp::set0<T>()));
+	}
+};
+
+// sin(x) and cos(x): 'x = j * pi / 2 + r' with |r| <= pi / 4, the odd quadrants swap sin and cos, the bit 1 of 'j' is
+// the sign of sin and the bit 1 of 'j + 1' the sign of cos
+template <typename T, Accuracy A>
+struct _sincos
+{
+	static void apply(const reg x, reg &s, reg &c) { mipp::sincos<T>(x, s, c); }
+};
+
+template <typename T>
+inline void _sincos_quadrant(const reg x, const reg k, const reg ps, const reg pc, reg &s, reg &c)
+{
+	using I = typename _fp<T>::I;
+	// bit 0 of 'j' in the sign of 1.0
+	const msk swap = mipp::sign<T>(mipp::orb<T>(mipp::lshift<I>(k, _fp<T>::bits -1), mipp::set1<T>((T)1)));
+	const reg sgn  = mipp::set1<T>((T)-0.0);
+	const reg sgns = mipp::andb<T>(mipp::lshift<I>(k, _fp<T>::bits -2), sgn);
+	const reg sgnc = mipp::andb<T>(mipp::lshift<I>(mipp::add<T>(k, mipp::set1<T>((T)1)), _fp<T>::bits -2), sgn);
+	s = mipp::xorb<T>(mipp::blend<T>(pc, ps, swap), sgns);
+	c = mipp::xorb<T>(mipp::blend<T>(ps, pc, swap), sgnc);
+	s = mipp::blend<T>(x, s, mipp::cmpeq<T>(x, mipp::set0<T>())); // sin(-0) = -0
+}
+
+template <typename T>
+struct _sincos<T,fast>
+{
+	static void apply(const reg x, reg &s, reg &c) {
+		const reg k  = mipp::add<T>(mipp::mul<T>(x, mipp::set1<T>(_fp<T>::two_pi)), mipp::set1<T>(_fp<T>::shifter));
+		const reg j  = mipp::sub<T>(k, mipp::set1<T>(_fp<T>::shifter));
+		reg r = mipp::fnmadd<T>(j, mipp::set1<T>(_cw<T>::pio2_1), x);
+		    r = mipp::fnmadd<T>(j, mipp::set1<T>(_cw<T>::pio2_2f), r);
+		const reg z  = mipp::mul<T>(r, r);
+		const reg ps = mipp::fmadd<T>(mipp::mul<T>(z, r), _poly_sin<T,fast>::apply(z), r);
+		const reg pc = mipp::fmadd<T>(z, _poly_cos<T,fast>::apply(z), mipp::set1<T>((T)1));
+		mipp::_sincos_quadrant<T>(x, k, ps, pc, s, c);
+	}
+};
+
+template <typename T>
+struct _sincos<T,precise>
+{
+	static void apply(const reg x, reg &s, reg &c) {
+		const reg k  = mipp::add<T>(mipp::mul<T>(x, mipp::set1<T>(_fp<T>::two_pi)), mipp::set1<T>(_fp<T>::shifter));
+		const reg j  = mipp::sub<T>(k, mipp::set1<T>(_fp<T>::shifter));
+		// 'j * pio2_1', 'j * pio2_2', 'j * pio2_3' and 't' are exact, 'r + dr' is the reduced argument with twice the
+		// precision ('t - u' is summed with its rounding error)
+		const reg t  = mipp::fnmadd<T>(j, mipp::set1<T>(_cw<T>::pio2_2), mipp::fnmadd<T>(j, mipp::set1<T>(_cw<T>::pio2_1), x));
+		const reg u  = mipp::mul<T>(j, mipp::set1<T>(_cw<T>::pio2_3));
+		const reg h  = mipp::sub<T>(t, u);
+		const reg hb = mipp::sub<T>(h, t);
+		const reg he = mipp::sub<T>(mipp::sub<T>(t, mipp::sub<T>(h, hb)), mipp::add<T>(u, hb));
+		const reg lo = mipp::fnmadd<T>(j, mipp::set1<T>(_cw<T>::pio2_4), he);
+		const reg r  = mipp::add<T>(h, lo);
+		const reg dr = mipp::add<T>(mipp::sub<T>(h, r), lo);
+		const reg z  = mipp::mul<T>(r, r);
+		// sin(r + dr) = r + (r^3 * P(r^2) + dr)
+		const reg ps = mipp::add<T>(r, mipp::fmadd<T>(mipp::mul<T>(z, r), _poly_sin<T,precise>::apply(z), dr));
+		// cos(r + dr) = w + ((1 - w) - r^2 / 2) + (r^4 * P(r^2) - r * dr) with w = 1 - r^2 / 2
+		const reg one = mipp::set1<T>((T)1);
+		const reg hz  = mipp::mul<T>(z, mipp::set1<T>((T)0.5));
+		const reg w   = mipp::sub<T>(one, hz);
+		const reg cl  = mipp::fnmadd<T>(r, dr, mipp::mul<T>(mipp::mul<T>(z, z), _poly_cos<T,precise>::apply(z)));
+		const reg pc  = mipp::add<T>(w, mipp::add<T>(mipp::sub<T>(mipp::sub<T>(one, w), hz), cl));
+		mipp::_sincos_quadrant<T>(x, k, ps, pc, s, c);
+	}
+};
+
+template <typename T, Accuracy A>
+inline reg exp(const reg x)
+{
+	return _exp<T,A>::apply(x);
+}
+
+template <typename T, Accuracy A>
+inline reg log(const reg x)
+{
+	return _log<T,A>::apply(x);
+}
+
+template <typename T, Accuracy A>
+inline void sincos(const reg x, reg &s, reg &c)
+{
+	_sincos<T,A>::apply(x, s, c);
+}
+
+template <typename T, Accuracy A>
+inline reg sin(const reg x)
+{
+	reg s, c;
+	_sincos<T,A>::apply(x, s, c);
+	return s;
+}
+
+template <typename T, Accuracy A>
+inline reg cos(const reg x)
+{
+	reg s, c;
+	_sincos<T,A>::apply(x, s, c);
+	return c;
+}
+
+// ------------------------------------------------------------------------------------ inverse trigonometric functions
+// --------------------------------------------------------------------------------------------------------------------
+// Cephes reductions and polynomials in single precision, Cephes (atan) and fdlibm (asin) rational approximations in
+// double precision. They are written with the generic operations (all the instruction sets), 1 or 2 ULP.
+
+// 'atan(t) = t + t * R(t^2)' for |t| <= 'mid'
+template <typename T> struct _atan_r;
+
+template <>
+struct _atan_r<float> {
+	static constexpr float mid = 0.414213562373095049f; // tan(pi / 8)
+	static reg apply(const reg z) {
+		return mipp::mul<float>(z, mipp::_poly<float>(z, -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f,
+		                                                  8.05374449538e-2f));
+	}
+};
+
+template <>
+struct _atan_r<double> {
+	static constexpr double mid = 0.66;
+	static reg apply(const reg z) {
+		const reg p = mipp::_poly<double>(z, -6.485021904942025371773e+1, -1.228866684490136173410e+2,
+		                                     -7.500855792314704667340e+1, -1.615753718733365076637e+1,
+		                                     -8.750608600031904122785e-1);
+		const reg q = mipp::_poly<double>(z,  1.945506571482613964425e+2,  4.853903996359136964868e+2,
+		                                      4.328810604912902668951e+2,  1.650270098316988542046e+2,
+		                                      2.485846490142306297962e+1,  1.);
+		return mipp::div<double>(mipp::mul<double>(z, p), q);
+	}
+};
+
+// 'asin(w) = w + w * R(w^2)' for |w| <= 0.5
+template <typename T> struct _asin_r;
+
+template <>
+struct _asin_r<float> {
+	static reg apply(const reg z) {
+		return mipp::mul<float>(z, mipp::_poly<float>(z, 1.6666752422e-1f, 7.4953002686e-2f, 4.5470025998e-2f,
+		                                                  2.4181311049e-2f, 4.2163199048e-2f));
+	}
+};
+
+template <>
+struct _asin_r<double> {
+	static reg apply(const reg z) {
+		const reg p = mipp::_poly<double>(z,  1.66666666666666657415e-01, -3.25565818622400915405e-01,
+		                                      2.01212532134862925881e-01, -4.00555345006794114027e-02,
+		                                      7.91534994289814532176e-04,  3.47933107596021167570e-05);
+		const reg q = mipp::_poly<double>(z,  1., -2.40339491173441421878e+00, 2.02094576023350569471e+00,
+		                                         -6.88283971605453293030e-01,  7.70381505559019352791e-02);
+		return mipp::div<double>(mipp::mul<double>(z, p), q);
+	}
+};
+
+// pi / 2 in two parts
+template <typename T> struct _pio2;
+template <> struct _pio2<float > { static constexpr float  hi = 1.57079637f,          lo = -4.37113883e-8f;         };
+template <> struct _pio2<double> { static constexpr double hi = 1.57079632679489656, lo = 6.12323399573676604e-17; };
+
+// sign bit of 'x' (-0.0 or 0.0) and its mask (set for -0.0)
+template <typename T>
+inline reg _signbit(const reg x)
+{
+	return mipp::andb<T>(x, mipp::set1<T>((T)-0.0));
+}
+
+template <typename T>
+inline msk _signbit_msk(const reg x)
+{
+	return mipp::sign<T>(mipp::orb<T>(mipp::_signbit<T>(x), mipp::set1<T>((T)1)));
+}
+
+// atan(a) for a >= 0: 'a' is reduced to |t| <= 'mid' with 'atan(a) = pi / 2 + atan(-1 / a)' or 'atan(a) = pi / 4 +
+// atan((a - 1) / (a + 1))' (one division for both)
+template <typename T>
+inline reg _atan_pos(const reg a)
+{
+	const reg one  = mipp::set1<T>((T)1);
+	const msk big  = mipp::cmpgt<T>(a, mipp::set1<T>((T)2.41421356237309504880)); // tan(3 * pi / 8)
+	const msk mid  = mipp::cmpgt<T>(a, mipp::set1<T>(_atan_r<T>::mid));
+	const reg num  = mipp::blend<T>(mipp::set1<T>((T)-1), mipp::blend<T>(mipp::sub<T>(a, one), a,   mid), big);
+	const reg den  = mipp::blend<T>(a,                    mipp::blend<T>(mipp::add<T>(a, one), one, mid), big);
+	const reg t    = mipp::div<T>(num, den);
+	const reg hi   = mipp::blend<T>(mipp::set1<T>(_pio2<T>::hi),
+	                                mipp::blend<T>(mipp::set1<T>(_pio2<T>::hi * (T)0.5), mipp::set0<T>(), mid), big);
+	const reg lo   = mipp::blend<T>(mipp::set1<T>(_pio2<T>::lo),
+	                                mipp::blend<T>(mipp::set1<T>(_pio2<T>::lo * (T)0.5), mipp::set0<T>(), mid), big);
+	const reg r    = mipp::fmadd<T>(t, _atan_r<T>::apply(mipp::mul<T>(t, t)), lo);
+	return mipp::add<T>(hi, mipp::add<T>(t, r));
+}
+
+template <typename T>
+inline reg atan(const reg x)
+{
+	const reg s = mipp::_signbit<T>(x);
+	return mipp::xorb<T>(mipp::_atan_pos<T>(mipp::xorb<T>(x, s)), s);
+}
+
+// atan(y / x) in ]-pi, pi], the quadrant is given by the signs of 'x' and 'y' (the signed zeros included)
+template <typename T>
+inline reg atan2(const reg y, const reg x)
+{
+	const reg sy = mipp::_signbit<T>(y);
+	const reg ay = mipp::xorb<T>(y, sy);
+	const reg ax = mipp::abs<T>(x);
+	const reg mx = mipp::max<T>(ax, ay);
+	// 0 / 0 and inf / inf
+	reg t = mipp::div<T>(mipp::min<T>(ax, ay), mx);
+	    t = mipp::blend<T>(mipp::set0<T>(), t, mipp::cmpeq<T>(mx, mipp::set0<T>()));
+	const reg inf = mipp::set1<T>(std::numeric_limits<T>::infinity());
+	    t = mipp::blend<T>(mipp::set1<T>((T)1), t, mipp::andb<mipp::N<T>()>(mipp::cmpeq<T>(ax, inf), mipp::cmpeq<T>(ay, inf)));
+
+	const reg pio2_hi = mipp::set1<T>(_pio2<T>::hi), pio2_lo = mipp::set1<T>(_pio2<T>::lo);
+	reg r = mipp::_atan_pos<T>(t);
+	    r = mipp::blend<T>(mipp::sub<T>(pio2_hi, mipp::sub<T>(r, pio2_lo)), r, mipp::cmpgt<T>(ay, ax));
+	    r = mipp::blend<T>(mipp::sub<T>(mipp::add<T>(pio2_hi, pio2_hi), mipp::sub<T>(r, mipp::add<T>(pio2_lo, pio2_lo))),
+	                       r, mipp::_signbit_msk<T>(x));
+	// 'min' and 'max' do not propagate the NaNs
+	const msk num = mipp::andb<mipp::N<T>()>(mipp::cmpeq<T>(x, x), mipp::cmpeq<T>(y, y));
+	return mipp::blend<T>(mipp::xorb<T>(r, sy), mipp::add<T>(x, y), num);
+}
+
+// |x| <= 0.5: asin(x) = x + x * R(x^2), |x| > 0.5: asin(x) = pi / 2 - 2 * asin(w) with w = sqrt((1 - |x|) / 2), 'p'
+// is 'asin(a)' or 'asin(w)' and 'big' tells which one
+template <typename T>
+inline reg _asin_core(const reg a, msk &big, reg &z, reg &w, reg &r)
+{
+	const reg half = mipp::set1<T>((T)0.5);
+	big = mipp::cmpgt<T>(a, half);
+	z = mipp::blend<T>(mipp::mul<T>(mipp::sub<T>(mipp::set1<T>((T)1), a), half), mipp::mul<T>(a, a), big);
+	w = mipp::blend<T>(mipp::sqrt<T>(z), a, big);
+	r = _asin_r<T>::apply(z);
+	return mipp::fmadd<T>(w, r, w);
+}
+
+template <typename T>
+inline reg asin(const reg x)
+{
+	using I = typename _fp<T>::I;
+	const reg s = mipp::_signbit<T>(x);
+	msk big;
+	reg z, w, r;
+	const reg p = mipp::_asin_core<T>(mipp::xorb<T>(x, s), big, z, w, r);
+	// pi / 2 - 2 * (w + w * R) with 'w = wh + c' and 'wh' the high half of the bits of 'w' ('wh * wh' is exact, as in
+	// the fdlibm)
+	const reg wh  = mipp::andb<T>(w, mipp::set1<I>(-((I)1 << (_fp<T>::mant / 2 + 1))));
+	// (the smallest normal number avoids 0 / 0 for |x| = 1 and is absorbed otherwise)
+	const reg den = mipp::add<T>(mipp::add<T>(w, wh), mipp::set1<T>(std::numeric_limits<T>::min()));
+	const reg c   = mipp::div<T>(mipp::fnmadd<T>(wh, wh, z), den);
+	const reg two = mipp::set1<T>((T)2);
+	const reg hi  = mipp::set1<T>(_pio2<T>::hi * (T)0.5);
+	const reg pb  = mipp::fmsub<T>(mipp::mul<T>(two, w), r, mipp::fnmadd<T>(two, c, mipp::set1<T>(_pio2<T>::lo)));
+	const reg qb  = mipp::fnmadd<T>(two, wh, hi);
+	const reg b   = mipp::sub<T>(hi, mipp::sub<T>(pb, qb));
+	return mipp::xorb<T>(mipp::blend<T>(b, p, big), s);
+}
+
+// acos(x) = pi / 2 - asin(x), |x| > 0.5: acos(x) = 2 * asin(w) and acos(-x) = pi - acos(x)
+template <typename T>
+inline reg acos(const reg x)
+{
+	const reg s = mipp::_signbit<T>(x);
+	msk big;
+	reg z, w, r;
+	const reg p   = mipp::_asin_core<T>(mipp::xorb<T>(x, s), big, z, w, r);
+	const reg hi  = mipp::set1<T>(_pio2<T>::hi), lo = mipp::set1<T>(_pio2<T>::lo);
+	const reg p2  = mipp::add<T>(p, p);
+	const reg neg = mipp::sub<T>(mipp::add<T>(hi, hi), mipp::sub<T>(p2, mipp::add<T>(lo, lo)));
+	const reg b   = mipp::blend<T>(neg, p2, mipp::_signbit_msk<T>(x));
+	const reg sm  = mipp::sub<T>(hi, mipp::sub<T>(mipp::xorb<T>(p, s), lo));
+	return mipp::blend<T>(b, sm, big);
+}
+
+// ------------------------------------------------------------------------------ exponential and logarithmic functions
+// --------------------------------------------------------------------------------------------------------------------
+// Built on the reductions and the kernels of the 'precise' tier: the exponents are extracted and inserted with the bit
+// manipulations of '_exponent' and '_pow2i', the hi/lo splits of the fdlibm keep the cancellations of 'log2', 'log10',
+// 'expm1' and 'log1p' exact. They are written with the generic operations (all the instruction sets), 1 or 2 ULP.
+
+// 1 / ln(2) and 1 / ln(10) in two parts with a short high part, log10(2) and ln(2) in two parts (fdlibm)
+template <typename T> struct _cl;
+
+template <>
+struct _cl<float>
+{
+	static constexpr float ivln2hi   = 1.4428710938e+00f, ivln2lo   = -1.7605285393e-04f;
+	static constexpr float ivln10hi  = 4.3432617188e-01f, ivln10lo  = -3.1689971365e-05f;
+	static constexpr float log10_2hi = 3.0102920532e-01f, log10_2lo = 7.9034151668e-07f;
+	static constexpr float ln2       = 6.9314718246e-01f, ln2_lo    = -1.9046542999577682e-09f;
+	static constexpr float split     = 4097.f; // 2^12 + 1
+	static constexpr float exp2_max  = 128.f, exp2_min = -150.f;
+};
+
+template <>
+struct _cl<double>
+{
+	static constexpr double ivln2hi   = 1.44269504072144627571e+00, ivln2lo   = 1.67517131648865118353e-10;
+	static constexpr double ivln10hi  = 4.34294481878168880939e-01, ivln10lo  = 2.50829467116452752298e-11;
+	static constexpr double log10_2hi = 3.01029995663611771306e-01, log10_2lo = 3.69423907715893078616e-13;
+	static constexpr double ln2       = 6.93147180559945286227e-01, ln2_lo    = 2.3190468138462996e-17;
+	static constexpr double split     = 134217729.; // 2^27 + 1
+	static constexpr double exp2_max  = 1024., exp2_min = -1075.;
+};
+
+// 'a * b = p + e' exactly (Dekker's product with Veltkamp's splitting, a FMA is not required)
+template <typename T>
+inline reg _two_prod(const reg a, const reg b, reg &e)
+{
+	const reg c  = mipp::set1<T>(_cl<T>::split);
+	const reg p  = mipp::mul<T>(a, b);
+	const reg ca = mipp::mul<T>(a, c), cb = mipp::mul<T>(b, c);
+	const reg ah = mipp::sub<T>(ca, mipp::sub<T>(ca, a)), al = mipp::sub<T>(a, ah);
+	const reg bh = mipp::sub<T>(cb, mipp::sub<T>(cb, b)), bl = mipp::sub<T>(b, bh);
+	e = mipp::fmadd<T>(al, bl, mipp::fmadd<T>(al, bh, mipp::fmadd<T>(ah, bl, mipp::fmsub<T>(ah, bh, p))));
+	return p;
+}
+
+// log(1 + f) = hi + lo with the low bits of 'hi' cleared (the products of 'hi' by the high parts of '_cl' are exact)
+template <typename T>
+inline void _log1p_hilo(const reg f, reg &hi, reg &lo)
+{
+	using I = typename _fp<T>::I;
+	const reg s    = mipp::div<T>(f, mipp::add<T>(f, mipp::set1<T>((T)2)));
+	const reg z    = mipp::mul<T>(s, s);
+	const reg R    = mipp::mul<T>(z, _poly_log<T,precise>::apply(z));
+	const reg hfsq = mipp::mul<T>(mipp::mul<T>(f, f), mipp::set1<T>((T)0.5));
+	hi = mipp::andb<T>(mipp::sub<T>(f, hfsq), mipp::set1<I>(-((I)1 << (_fp<T>::bits == 32 ? 12 : 32))));
+	lo = mipp::fmadd<T>(s, mipp::add<T>(hfsq, R), mipp::sub<T>(mipp::sub<T>(f, hi), hfsq)); // 'f - hi' is exact
+}
+
+// log2(x) = hi + lo for the positive numbers with |lo| <= ulp(hi) / 2, 'e + hi / ln(2)' is summed with its rounding
+// error and the sum is renormalized
+template <typename T>
+inline reg _log2_hilo(const reg x, reg &lo)
+{
+	reg e, h, l;
+	mipp::_log1p_hilo<T>(mipp::_log_reduce_den<T>(x, e), h, l);
+	const reg vhi = mipp::mul<T>(h, mipp::set1<T>(_cl<T>::ivln2hi));
+	const reg vlo = mipp::fmadd<T>(mipp::add<T>(l, h), mipp::set1<T>(_cl<T>::ivln2lo),
+	                               mipp::mul<T>(l, mipp::set1<T>(_cl<T>::ivln2hi)));
+	const reg w   = mipp::add<T>(e, vhi);
+	const reg wl  = mipp::add<T>(vlo, mipp::add<T>(mipp::sub<T>(e, w), vhi));
+	const reg hi  = mipp::add<T>(w, wl);
+	lo = mipp::sub<T>(wl, mipp::sub<T>(hi, w));
+	return hi;
+}
+
+template <typename T>
+inline reg log2(const reg x)
+{
+	reg lo;
+	return mipp::_log_special<T>(x, mipp::_log2_hilo<T>(x, lo), mipp::cmpeq<T>(x, mipp::set0<T>()));
+}
+
+template <typename T>
+inline reg log10(const reg x)
+{
+	reg e, h, l;
+	mipp::_log1p_hilo<T>(mipp::_log_reduce_den<T>(x, e), h, l);
+	const reg y2  = mipp::mul<T>(e, mipp::set1<T>(_cl<T>::log10_2hi));
+	const reg vhi = mipp::mul<T>(h, mipp::set1<T>(_cl<T>::ivln10hi));
+	reg vlo = mipp::fmadd<T>(mipp::add<T>(l, h), mipp::set1<T>(_cl<T>::ivln10lo),
+	                         mipp::mul<T>(l, mipp::set1<T>(_cl<T>::ivln10hi)));
+	    vlo = mipp::fmadd<T>(e, mipp::set1<T>(_cl<T>::log10_2lo), vlo);
+	const reg w   = mipp::add<T>(y2, vhi);
+	vlo = mipp::add<T>(vlo, mipp::add<T>(mipp::sub<T>(y2, w), vhi));
+	return mipp::_log_special<T>(x, mipp::add<T>(w, vlo), mipp::cmpeq<T>(x, mipp::set0<T>()));
+}
+
+// log(1 + x) = log(u) + c / u with 'u = 1 + x' and 'c' the rounding error of 'u' (as in the fdlibm)
+template <typename T>
+inline reg log1p(const reg x)
+{
+	const reg one = mipp::set1<T>((T)1);
+	const reg u   = mipp::add<T>(one, x);
+	const reg c   = mipp::div<T>(mipp::blend<T>(mipp::sub<T>(one, mipp::sub<T>(u, x)), mipp::sub<T>(x, mipp::sub<T>(u, one)),
+	                                            mipp::cmpge<T>(u, mipp::set1<T>((T)2))), u);
+	reg e = mipp::set0<T>(), h, l;
+	mipp::_log1p_hilo<T>(mipp::_log_reduce<T>(u, e), h, l); // 'u' is a normal number (or 0)
+	const reg lo = mipp::fmadd<T>(e, mipp::set1<T>(_cw<T>::ln2_lo2), mipp::add<T>(l, c));
+	const reg y  = mipp::add<T>(mipp::fmadd<T>(e, mipp::set1<T>(_cw<T>::ln2_hi2), h), lo);
+	return mipp::blend<T>(x, mipp::_log_special<T>(u, y, mipp::cmpeq<T>(u, mipp::set0<T>())),
+	                      mipp::cmpeq<T>(x, mipp::set0<T>())); // log1p(-0) = -0
+}
+
+// 2^x = 2^n * e^(r * ln(2)) with 'n' the nearest integer of 'x' and 'r = x - n' exact
+template <typename T>
+inline reg exp2(const reg x)
+{
+	const reg n = mipp::_rint<T>(x);
+	const reg r = mipp::sub<T>(x, n);
+	reg dr;
+	const reg rl = mipp::_two_prod<T>(r, mipp::set1<T>(_cl<T>::ln2), dr);
+	reg y = mipp::_ldexp<T>(mipp::_exp_kernel<T>(rl, mipp::fmadd<T>(r, mipp::set1<T>(_cl<T>::ln2_lo), dr)), n);
+	y = mipp::blend<T>(mipp::set1<T>(std::numeric_limits<T>::infinity()), y,
+	                   mipp::cmpge<T>(x, mipp::set1<T>(_cl<T>::exp2_max)));
+	return mipp::blend<T>(mipp::set0<T>(), y, mipp::cmplt<T>(x, mipp::set1<T>(_cl<T>::exp2_min)));
+}
+
+// e^x - 1 = 2^n * (1 + u) - 1 = 2 * (s * u + (s - 1 / 2)) with 'u = e^(r + dr) - 1' and 's = 2^(n - 1)': 's - 1 / 2'
+// is exact for the small 'n' (no cancellation) and 's' does not overflow
+template <typename T>
+inline reg expm1(const reg x)
+{
+	reg n, dr;
+	const reg r    = mipp::_exp_reduce<T>(x, n, dr);
+	const reg u    = mipp::add<T>(r, mipp::fmadd<T>(mipp::mul<T>(r, r), _poly_exp<T,precise>::apply(r),
+	                                                mipp::fmadd<T>(dr, r, dr)));
+	const reg s    = mipp::_pow2i<T>(mipp::sub<T>(n, mipp::set1<T>((T)1)));
+	reg y = mipp::mul<T>(mipp::fmadd<T>(s, u, mipp::sub<T>(s, mipp::set1<T>((T)0.5))), mipp::set1<T>((T)2));
+	y = mipp::blend<T>(mipp::set1<T>(std::numeric_limits<T>::infinity()), y,
+	                   mipp::cmpgt<T>(x, mipp::set1<T>(_cw<T>::exp_max)));
+	// e^x is below the half ULP of 1
+	y = mipp::blend<T>(mipp::set1<T>((T)-1), y, mipp::cmplt<T>(x, mipp::set1<T>((T)-(_fp<T>::mant + 3) * _fp<T>::ln2)));
+	// expm1(x) = x below the ULP (the signed zeros and the denormals included)
+	return mipp::blend<T>(x, y, mipp::cmplt<T>(mipp::abs<T>(x), mipp::set1<T>((T)1 / ((T)4 * _fp<T>::two_m))));
+}
+
+// initial approximation of cbrt(m) for m in [1/2, 4[ (relative error 1.9e-3)
+template <typename T>
+inline reg _cbrt_guess(const reg m)
+{
+	return mipp::_poly<T>(m, (T)4.978841404161053894e-01, (T)7.130506690311337324e-01, (T)-2.659693773973972157e-01,
+	                         (T)6.085348937356213856e-02, (T)-5.487342616542310292e-03);
+}
+
+// cbrt(|x|) = 2^q * cbrt(m) with |x| = 2^(3q) * m and m in [1/2, 4[, cbrt(m) is refined with the Halley iteration
+// (the last one as a small correction), once in single precision and twice in double precision
+template <typename T>
+inline reg cbrt(const reg x)
+{
+	const reg sg  = mipp::_signbit<T>(x);
+	const reg a   = mipp::xorb<T>(x, sg);
+	// the denormals are scaled by 2^(3k)
+	const T   k   = (T)(_fp<T>::bits == 32 ? 8 : 18);
+	const msk den = mipp::cmplt<T>(a, mipp::set1<T>(std::numeric_limits<T>::min()));
+	const reg an  = mipp::blend<T>(mipp::mul<T>(a, mipp::_pow2i<T>(mipp::set1<T>((T)3 * k))), a, den);
+	const reg e   = mipp::_exponent<T>(an);
+	const reg q   = mipp::_rint<T>(mipp::mul<T>(e, mipp::set1<T>((T)1 / (T)3)));
+	const reg m   = mipp::mul<T>(mipp::_mantissa<T>(an), mipp::_pow2i<T>(mipp::fnmadd<T>(q, mipp::set1<T>((T)3), e)));
+
+	const reg two = mipp::set1<T>((T)2);
+	reg y = mipp::_cbrt_guess<T>(m);
+	if (_fp<T>::bits == 64)
+	{
+		const reg y3 = mipp::mul<T>(mipp::mul<T>(y, y), y);
+		y = mipp::div<T>(mipp::mul<T>(y, mipp::fmadd<T>(two, m, y3)), mipp::fmadd<T>(two, y3, m));
+	}
+	const reg y3 = mipp::mul<T>(mipp::mul<T>(y, y), y);
+	y = mipp::fmadd<T>(y, mipp::div<T>(mipp::sub<T>(m, y3), mipp::fmadd<T>(two, y3, m)), y);
+	y = mipp::mul<T>(y, mipp::_pow2i<T>(mipp::blend<T>(mipp::sub<T>(q, mipp::set1<T>(k)), q, den)));
+
+	// 0, inf and NaN are returned as is
+	const msk fin = mipp::andb<mipp::N<T>()>(mipp::cmpgt<T>(a, mipp::set0<T>()),
+	                                         mipp::cmplt<T>(a, mipp::set1<T>(std::numeric_limits<T>::infinity())));
+	return mipp::xorb<T>(mipp::blend<T>(y, a, fin), sg);
+}
+
+// x^y = 2^(y * log2(|x|)) with 'y * log2(|x|)' computed with twice the precision, the special values and the negative
+// 'x' are those of the C library
+template <typename T>
+inline reg pow(const reg x, const reg y)
+{
+	const reg zero = mipp::set0<T>(), one = mipp::set1<T>((T)1);
+	const reg inf  = mipp::set1<T>(std::numeric_limits<T>::infinity());
+	const reg ax   = mipp::abs<T>(x);
+	const reg ay   = mipp::abs<T>(y);
+
+	// log2(|x|) = lh + ll, log2(0) = -inf and log2(inf) = inf give 'inf' or '0' below
+	reg ll;
+	reg lh = mipp::_log2_hilo<T>(ax, ll);
+	    lh = mipp::blend<T>(mipp::sub<T>(zero, inf), lh, mipp::cmpeq<T>(ax, zero));
+	    lh = mipp::blend<T>(inf, lh, mipp::cmpeq<T>(ax, inf));
+	// y * log2(|x|) = ph + pl = n + t + dt
+	reg pl;
+	const reg ph = mipp::_two_prod<T>(y, lh, pl);
+	          pl = mipp::fmadd<T>(y, ll, pl);
+	const reg n  = mipp::_rint<T>(ph);
+	const reg r  = mipp::sub<T>(ph, n);
+	const reg t  = mipp::add<T>(r, pl);
+	const reg dt = mipp::add<T>(mipp::sub<T>(r, t), pl);
+	// 2^(t + dt) = e^(a + da)
+	reg da;
+	const reg a  = mipp::_two_prod<T>(t, mipp::set1<T>(_cl<T>::ln2), da);
+	          da = mipp::fmadd<T>(t, mipp::set1<T>(_cl<T>::ln2_lo), mipp::fmadd<T>(dt, mipp::set1<T>(_cl<T>::ln2), da));
+	reg z = mipp::_ldexp<T>(mipp::_exp_kernel<T>(a, da), n);
+	    z = mipp::blend<T>(inf,  z, mipp::cmpgt<T>(ph, mipp::set1<T>(_cl<T>::exp2_max)));
+	    z = mipp::blend<T>(zero, z, mipp::cmplt<T>(ph, mipp::set1<T>(_cl<T>::exp2_min)));
+
+	// 'y' is an integer and an odd integer (all the numbers above 2^23 or 2^52 are integers, the ones above 2^24 or
+	// 2^53 are even)
+	const reg two_m  = mipp::set1<T>(_fp<T>::two_m);
+	const reg two_m1 = mipp::add<T>(two_m, two_m);
+	const msk yint = mipp::orb<mipp::N<T>()>(mipp::cmpge<T>(ay, two_m),
+	                                         mipp::cmpeq<T>(mipp::sub<T>(mipp::add<T>(ay, two_m), two_m), ay));
+	const msk yodd = mipp::andb<mipp::N<T>()>(yint, mipp::andb<mipp::N<T>()>(mipp::cmplt<T>(ay, two_m1),
+	                 mipp::notb<mipp::N<T>()>(mipp::cmpeq<T>(mipp::sub<T>(mipp::add<T>(ay, two_m1), two_m1), ay))));
+	// x < 0: the sign of the odd powers, NaN for the finite 'x' and the non-integer 'y'
+	z = mipp::xorb<T>(z, mipp::blend<T>(mipp::_signbit<T>(x), zero, yodd));
+	z = mipp::blend<T>(mipp::blend<T>(z, mipp::set1<T>(std::numeric_limits<T>::quiet_NaN()), yint), z,
+	                   mipp::andb<mipp::N<T>()>(mipp::cmplt<T>(x, zero), mipp::cmpgt<T>(x, mipp::sub<T>(zero, inf))));
+	// (-1)^(+-inf) = 1, then the NaNs, then x^0 = 1 and 1^y = 1 (even for NaN)
+	z = mipp::blend<T>(one, z, mipp::andb<mipp::N<T>()>(mipp::cmpeq<T>(ax, one), mipp::cmpeq<T>(ay, inf)));
+	z = mipp::blend<T>(z, mipp::add<T>(x, y), mipp::andb<mipp::N<T>()>(mipp::cmpeq<T>(x, x), mipp::cmpeq<T>(y, y)));
+	return mipp::blend<T>(one, z, mipp::orb<mipp::N<T>()>(mipp::cmpeq<T>(y, zero), mipp::cmpeq<T>(x, one)));
+}
+
+// x^n for an integer 'n': |n| <= 4 takes at most two products (and a division for n < 0, 2.5 ULP), the other
+// exponents are computed with 'pow'
+template <typename T>
+inline reg powi(const reg x, const int n)
+{
+	if (n < -4 || n > 4)
+		return mipp::pow<T>(x, mipp::set1<T>((T)n));
+
+	reg p;
+	switch (n < 0 ? -n : n)
+	{
+		case 0:  return mipp::set1<T>((T)1);
+		case 1:  p = x;                                                    break;
+		case 2:  p = mipp::mul<T>(x, x);                                   break;
+		case 3:  p = mipp::mul<T>(mipp::mul<T>(x, x), x);                  break;
+		default: p = mipp::mul<T>(mipp::mul<T>(x, x), mipp::mul<T>(x, x)); break;
+	}
+	return n < 0 ? mipp::div<T>(mipp::set1<T>((T)1), p) : p;
+}
+
+// ---------------------------------------------------------------------------------- activation and error functions
+// --------------------------------------------------------------------------------------------------------------------
+// 'tanh', 'sigmoid', 'softplus', 'logaddexp', 'erf' and 'erfc' cost one exponential, one division and a polynomial.
+// They take the accuracy tier of their exponential ('mipp::sigmoid<float,mipp::fast>(x)'): 'fast' also shortens their
+// polynomials (relative error below 2e-4), 'balanced' and 'precise' share the same polynomials (2.5 ULP at most, 6 ULP
+// for 'erfc' that rounds 'exp(-x^2)', 't' and 'Q(t)'). The results below the smallest normal number are flushed to
+// zero. 'erf' and 'erfc' always use the kernels of the 'fast' and 'precise' tiers ('balanced' is 'precise'), in double
+// precision they require the 64-bit integer shifts.
+
+// polynomials of the 'fast' tier and of the other tiers (the 'balanced' tier is the 'precise' one)
+template <typename T, Accuracy A> struct _poly_tanh     : _poly_tanh    <T,precise> {}; // tanh(x) = x + x^3 * P(x^2)
+template <typename T, Accuracy A> struct _poly_log1pexp : _poly_log1pexp<T,precise> {}; // see '_log1pexp'
+template <typename T, Accuracy A> struct _poly_erf      : _poly_erf     <T,precise> {}; // erf(x) = x + x * P(x^2)
+template <typename T, Accuracy A> struct _poly_erfc     : _poly_erfc    <T,precise> {}; // see '_erfc_pos'
+
+template <typename T>
+struct _poly_tanh<T,fast> {
+	static reg apply(const reg z) {
+		return mipp::_poly<T>(z, (T)-3.30466791469405582e-01, (T)1.08370836896824407e-01);
+	}
+};
+
+template <>
+struct _poly_tanh<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, -3.333328194e-01f, 1.333144220e-01f, -5.373971512e-02f, 2.063908735e-02f,
+		                             -5.704987126e-03f);
+	}
+};
+
+template <>
+struct _poly_tanh<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, -3.33333333333328551e-01, 1.33333333332620863e-01, -5.39682539312696981e-02,
+		                              2.18694875761839765e-02, -8.86322100403517320e-03, 3.59198918579897091e-03,
+		                              -1.45495894016106493e-03, 5.86316742754198855e-04, -2.28564616403534193e-04,
+		                              7.71448237514161413e-05, -1.60727922215563003e-05);
+	}
+};
+
+template <typename T>
+struct _poly_log1pexp<T,fast> {
+	static reg apply(const reg f) {
+		return mipp::_poly<T>(f, (T)9.99943277924004131e-01, (T)-4.96977805287961704e-01, (T)3.06300929317877836e-01,
+		                         (T)-1.57427207020137333e-01, (T)4.13473023732144245e-02);
+	}
+};
+
+template <>
+struct _poly_log1pexp<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, 6.666641629e-01f, 4.002152724e-01f, 2.800180530e-01f, 2.801198671e-01f);
+	}
+};
+
+template <>
+struct _poly_log1pexp<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, 6.66666666666776990e-01, 3.99999999960490353e-01, 2.85714290580111327e-01,
+		                              2.22221929058771912e-01, 1.81828140016125677e-01, 1.53642970918981531e-01,
+		                              1.35862967292754246e-01, 9.90291959912981339e-02, 1.77395365210898953e-01);
+	}
+};
+
+template <typename T>
+struct _poly_erf<T,fast> {
+	static reg apply(const reg z) {
+		return mipp::_poly<T>(z, (T)1.28347415163668583e-01, (T)-3.75136541720058176e-01, (T)1.07833668295948296e-01,
+		                         (T)-1.83674618988083412e-02);
+	}
+};
+
+template <>
+struct _poly_erf<float,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<float>(z, 1.283791657e-01f, -3.761262582e-01f, 1.128358515e-01f, -2.685381193e-02f,
+		                             5.188327684e-03f, -8.010193607e-04f, 7.853861294e-05f);
+	}
+};
+
+template <>
+struct _poly_erf<double,precise> {
+	static reg apply(const reg z) {
+		return mipp::_poly<double>(z, 1.28379167095512566e-01, -3.76126389031835183e-01, 1.12837916709441611e-01,
+		                              -2.68661706431098507e-02, 5.22397760611595564e-03, -8.54832592953684425e-04,
+		                              1.20552935907514651e-04, -1.49247126683391652e-05, 1.64471370059800667e-06,
+		                              -1.62063606272388830e-07, 1.37112002586008386e-08, -7.77990310301350103e-10);
+	}
+};
+
+// erfc(x) = e^(-x^2) * t * Q(t - tm) with 't = 1 / (1 + c * x)' for 0.5 <= x < 'max' (erfc(max) is below the smallest
+// normal number), 'tm' is the middle of the range of 't'
+template <typename T>
+struct _poly_erfc<T,fast> {
+	static constexpr T c = (T)0.5, tm = (T)4.344827532768249511719e-01, max = (T)27.3;
+	static reg apply(const reg u) {
+		return mipp::_poly<T>(u, (T)4.68129729982704962e-01, (T)6.15986350999135938e-01, (T)5.25633841020231808e-01,
+		                         (T)1.85069607759863027e-01, (T)-1.21087358994241767e-01, (T)-1.19336036215370919e-01);
+	}
+};
+
+template <>
+struct _poly_erfc<float,precise> {
+	static constexpr float c = 0.3f, tm = 5.588520765304565429688e-01f, max = 9.2f;
+	static reg apply(const reg u) {
+		return mipp::_poly<float>(u, 3.604868600e-01f, 6.572886092e-01f, 9.831286348e-01f, 1.188021207e+00f,
+		                             1.117724802e+00f, 7.484809778e-01f, 2.556020550e-01f, -9.243087423e-02f,
+		                             -1.343198457e-01f);
+	}
+};
+
+template <>
+struct _poly_erfc<double,precise> {
+	static constexpr double c = 0.3, tm = 4.89727663640707134e-01, max = 26.55;
+	static reg apply(const reg u) {
+		return mipp::_poly<double>(u, 3.19381718712204840e-01, 5.37008284545629337e-01, 7.66425868207443119e-01,
+		                              9.12983972014365596e-01, 8.78296985155292592e-01, 6.35619182892869817e-01,
+		                              2.80104105243288120e-01, -1.33482545827549769e-02, -1.18008116207065815e-01,
+		                              -5.79989558305228553e-02, 2.90548711305472807e-02, 3.98082821213095292e-02,
+		                              -4.03296489461656545e-03, -2.34314690151140894e-02, -1.08817571264067578e-03,
+		                              1.45334784774306600e-02, 1.11718325012601282e-03, -9.79011757041692749e-03,
+		                              -2.20943249250125305e-04, 6.57725909817420888e-03, -2.23984966253564177e-04,
+		                              -3.16230855105660286e-03);
+	}
+};
+
+// e^d for d <= 0, flushed to zero below the smallest normal number
+template <typename T, Accuracy A>
+inline reg _exp_neg(const reg d)
+{
+	return mipp::blend<T>(mipp::set0<T>(), mipp::exp<T,A>(d), mipp::cmplt<T>(d, mipp::set1<T>(_cw<T>::exp_min_fast)));
+}
+
+// log(1 + e^d) for d <= 0: log(1 + f) = f - (f^2 / 2 - s * (f^2 / 2 + s^2 * P(s^2))) with 'f = e^d' in [0, 1] and
+// 's = f / (2 + f)' as in '_log<T,precise>' ('fast': log(1 + f) = f * P(f))
+template <typename T, Accuracy A>
+struct _log1pexp
+{
+	static reg apply(const reg d) {
+		// log(1 + f) = f below the quarter ULP of 1 ('fc' keeps the squares away from the slow denormals)
+		const reg tiny = mipp::set1<T>((T)1 / ((T)4 * _fp<T>::two_m));
+		const reg f    = mipp::_exp_neg<T,A>(d);
+		const reg fc   = mipp::max<T>(f, tiny);
+		const reg s    = mipp::div<T>(fc, mipp::add<T>(fc, mipp::set1<T>((T)2)));
+		const reg z    = mipp::mul<T>(s, s);
+		const reg hfsq = mipp::mul<T>(mipp::mul<T>(fc, fc), mipp::set1<T>((T)0.5));
+		const reg R    = mipp::mul<T>(z, _poly_log1pexp<T,A>::apply(z));
+		return mipp::blend<T>(f, mipp::sub<T>(fc, mipp::fnmadd<T>(s, mipp::add<T>(hfsq, R), hfsq)), mipp::cmplt<T>(f, tiny));
+	}
+};
+
+template <typename T>
+struct _log1pexp<T,fast>
+{
+	static reg apply(const reg d) {
+		const reg f = mipp::_exp_neg<T,fast>(d);
+		return mipp::mul<T>(f, _poly_log1pexp<T,fast>::apply(f));
+	}
+};
+
+// e^(hi + lo) for a small 'lo', 'hi - n * ln(2)_hi' is exact
+template <typename T>
+inline reg _exp_hilo(const reg hi, const reg lo)
+{
+	const reg n  = mipp::_rint<T>(mipp::mul<T>(mipp::add<T>(hi, lo), mipp::set1<T>(_fp<T>::log2e)));
+	const reg h  = mipp::fnmadd<T>(n, mipp::set1<T>(_cw<T>::ln2_hi), hi);
+	const reg l  = mipp::fnmadd<T>(n, mipp::set1<T>(_cw<T>::ln2_lo), lo);
+	const reg r  = mipp::add<T>(h, l);
+	const reg dr = mipp::add<T>(mipp::sub<T>(h, r), l);
+	return mipp::_ldexp<T>(mipp::_exp_kernel<T>(r, dr), n);
+}
+
+// e^(-a^2) for 0 <= a < '_poly_erfc<T,A>::max': '-a^2 = -ah^2 + (ah - a) * (ah + a)' with 'ah' the high half of the
+// bits of 'a' ('ah^2' is exact), 'fast': the rounding of 'a^2' is kept
+template <typename T, Accuracy A>
+struct _exp_msq
+{
+	static reg apply(const reg a) {
+		using I = typename _fp<T>::I;
+		const reg ah = mipp::andb<T>(a, mipp::set1<I>(-((I)1 << (_fp<T>::bits == 32 ? 12 : 27))));
+		const reg hi = mipp::mul<T>(mipp::sub<T>(mipp::set0<T>(), ah), ah);
+		const reg lo = mipp::mul<T>(mipp::sub<T>(ah, a), mipp::add<T>(ah, a));
+		return mipp::_exp_hilo<T>(hi, lo);
+	}
+};
+
+template <typename T>
+struct _exp_msq<T,fast>
+{
+	static reg apply(const reg a) {
+		return mipp::exp<T,fast>(mipp::mul<T>(mipp::sub<T>(mipp::set0<T>(), a), a));
+	}
+};
+
+// erfc(a) for a >= 0.5 (0 above '_poly_erfc<T,A>::max'), the other positive 'a' give finite values
+template <typename T, Accuracy A>
+inline reg _erfc_pos(const reg a)
+{
+	const reg max = mipp::set1<T>(_poly_erfc<T,A>::max);
+	const reg one = mipp::set1<T>((T)1);
+	const reg ac  = mipp::min<T>(a, max);
+	const reg t   = mipp::div<T>(one, mipp::fmadd<T>(ac, mipp::set1<T>(_poly_erfc<T,A>::c), one));
+	const reg q   = _poly_erfc<T,A>::apply(mipp::sub<T>(t, mipp::set1<T>(_poly_erfc<T,A>::tm)));
+	const reg y   = mipp::mul<T>(_exp_msq<T,A>::apply(ac), mipp::mul<T>(t, q));
+	return mipp::blend<T>(mipp::set0<T>(), y, mipp::cmpge<T>(a, max));
+}
+
+// tanh(a) with a = |x|: a < 0.625: tanh(a) = a + a^3 * P(a^2), otherwise tanh(a) = 1 - 2 / (e^(2a) + 1)
+template <typename T, Accuracy A>
+inline reg tanh(const reg x)
+{
+	const reg one = mipp::set1<T>((T)1);
+	const reg a   = mipp::abs<T>(x);
+	const reg z   = mipp::mul<T>(a, a);
+	const reg p   = mipp::fmadd<T>(mipp::mul<T>(a, z), _poly_tanh<T,A>::apply(z), a);
+	const reg e   = mipp::exp<T,A>(mipp::add<T>(a, a));
+	const reg y   = mipp::fnmadd<T>(mipp::set1<T>((T)2), mipp::div<T>(one, mipp::add<T>(e, one)), one);
+	// the NaNs take 'p'
+	return mipp::xorb<T>(mipp::blend<T>(y, p, mipp::cmpge<T>(a, mipp::set1<T>((T)0.625))), mipp::_signbit<T>(x));
+}
+
+// 1 / (1 + e^-x), e^-|x| is in [0, 1] (no overflow): sigmoid(-|x|) = e^-|x| / (1 + e^-|x|)
+template <typename T, Accuracy A>
+inline reg sigmoid(const reg x)
+{
+	const reg one = mipp::set1<T>((T)1);
+	const reg e   = mipp::_exp_neg<T,A>(mipp::sub<T>(mipp::set0<T>(), mipp::abs<T>(x)));
+	const reg y   = mipp::div<T>(mipp::blend<T>(one, e, mipp::cmpge<T>(x, mipp::set0<T>())), mipp::add<T>(one, e));
+	return mipp::blend<T>(y, x, mipp::cmpeq<T>(x, x));
+}
+
+// log(1 + e^x) = max(x, 0) + log(1 + e^-|x|)
+template <typename T, Accuracy A>
+inline reg softplus(const reg x)
+{
+	const reg y = mipp::add<T>(mipp::max<T>(x, mipp::set0<T>()),
+	                           _log1pexp<T,A>::apply(mipp::sub<T>(mipp::set0<T>(), mipp::abs<T>(x))));
+	return mipp::blend<T>(y, x, mipp::cmpeq<T>(x, x));
+}
+
+// log(e^a + e^b) = max(a, b) + log(1 + e^-|a - b|), the Jacobian logarithm (max*) of the MAP decoders, the infinities
+// of the same sign and the NaNs give 'a + b'
+template <typename T, Accuracy A>
+inline reg logaddexp(const reg a, const reg b)
+{
+	const reg d = mipp::sub<T>(a, b);
+	const reg y = mipp::add<T>(mipp::max<T>(a, b),
+	                           _log1pexp<T,A>::apply(mipp::sub<T>(mipp::set0<T>(), mipp::abs<T>(d))));
+	return mipp::blend<T>(y, mipp::add<T>(a, b), mipp::cmpeq<T>(d, d));
+}
+
+// erf(a) with a = |x|: a < 1: erf(a) = a + a * P(a^2), otherwise erf(a) = 1 - erfc(a)
+template <typename T, Accuracy A>
+inline reg erf(const reg x)
+{
+	const reg a = mipp::abs<T>(x);
+	const reg p = mipp::fmadd<T>(a, _poly_erf<T,A>::apply(mipp::mul<T>(a, a)), a);
+	const reg y = mipp::sub<T>(mipp::set1<T>((T)1), mipp::_erfc_pos<T,A>(a));
+	// the NaNs take 'p'
+	return mipp::xorb<T>(mipp::blend<T>(y, p, mipp::cmpge<T>(a, mipp::set1<T>((T)1))), mipp::_signbit<T>(x));
+}
+
+// |x| < 0.5: erfc(x) = 1 - erf(x), otherwise erfc(|x|) and erfc(-|x|) = 2 - erfc(|x|)
+template <typename T, Accuracy A>
+inline reg erfc(const reg x)
+{
+	const reg one = mipp::set1<T>((T)1);
+	const reg a   = mipp::abs<T>(x);
+	const reg p   = mipp::sub<T>(one, mipp::fmadd<T>(x, _poly_erf<T,A>::apply(mipp::mul<T>(x, x)), x));
+	const reg y   = mipp::_erfc_pos<T,A>(a);
+	const reg yn  = mipp::sub<T>(mipp::set1<T>((T)2), y);
+	// the NaNs take 'p'
+	return mipp::blend<T>(mipp::blend<T>(yn, y, mipp::cmplt<T>(x, mipp::set0<T>())), p,
+	                      mipp::cmpge<T>(a, mipp::set1<T>((T)0.5)));
+}
+
+template <typename T> inline reg tanh     (const reg x)               { return mipp::tanh     <T,balanced>(x);    }
+template <typename T> inline reg sigmoid  (const reg x)               { return mipp::sigmoid  <T,balanced>(x);    }
+template <typename T> inline reg softplus (const reg x)               { return mipp::softplus <T,balanced>(x);    }
+template <typename T> inline reg logaddexp(const reg a, const reg b)  { return mipp::logaddexp<T,balanced>(a, b); }
+template <typename T> inline reg erf      (const reg x)               { return mipp::erf      <T,balanced>(x);    }
+template <typename T> inline reg erfc     (const reg x)               { return mipp::erfc     <T,balanced>(x);    }
+
+#ifndef MIPP_NO_INTRINSICS
+template <typename T, Accuracy A> inline Reg<T> exp      (const Reg<T> x)                       { return mipp::exp<T,A>(x.r);             }
+template <typename T, Accuracy A> inline Reg<T> log      (const Reg<T> x)                       { return mipp::log<T,A>(x.r);             }
+template <typename T, Accuracy A> inline Reg<T> sin      (const Reg<T> x)                       { return mipp::sin<T,A>(x.r);             }
+template <typename T, Accuracy A> inline Reg<T> cos      (const Reg<T> x)                       { return mipp::cos<T,A>(x.r);             }
+template <typename T, Accuracy A> inline void   sincos   (const Reg<T> x, Reg<T> &s, Reg<T> &c) {        mipp::sincos<T,A>(x.r, s.r, c.r); }
+template <typename T, Accuracy A> inline Reg<T> tanh     (const Reg<T> x)                       { return mipp::tanh<T,A>(x.r);            }
+template <typename T, Accuracy A> inline Reg<T> sigmoid  (const Reg<T> x)                       { return mipp::sigmoid<T,A>(x.r);         }
+template <typename T, Accuracy A> inline Reg<T> softplus (const Reg<T> x)                       { return mipp::softplus<T,A>(x.r);        }
+template <typename T, Accuracy A> inline Reg<T> logaddexp(const Reg<T> a, const Reg<T> b)       { return mipp::logaddexp<T,A>(a.r, b.r);  }
+template <typename T, Accuracy A> inline Reg<T> erf      (const Reg<T> x)                       { return mipp::erf<T,A>(x.r);             }
+template <typename T, Accuracy A> inline Reg<T> erfc     (const Reg<T> x)                       { return mipp::erfc<T,A>(x.r);            }
+#else
+template <typename T, Accuracy A> inline Reg<T> exp      (const Reg<T> x)                       { return x.exp();                         }
+template <typename T, Accuracy A> inline Reg<T> log      (const Reg<T> x)                       { return x.log();                         }
+template <typename T, Accuracy A> inline Reg<T> sin      (const Reg<T> x)                       { return x.sin();                         }
+template <typename T, Accuracy A> inline Reg<T> cos      (const Reg<T> x)                       { return x.cos();                         }
+template <typename T, Accuracy A> inline void   sincos   (const Reg<T> x, Reg<T> &s, Reg<T> &c) {        x.sincos(s, c);                  }
+template <typename T, Accuracy A> inline Reg<T> tanh     (const Reg<T> x)                       { return x.tanh();                        }
+template <typename T, Accuracy A> inline Reg<T> sigmoid  (const Reg<T> x)                       { return x.sigmoid();                     }
+template <typename T, Accuracy A> inline Reg<T> softplus (const Reg<T> x)                       { return x.softplus();                    }
+template <typename T, Accuracy A> inline Reg<T> logaddexp(const Reg<T> a, const Reg<T> b)       { return a.logaddexp(b);                  }
+template <typename T, Accuracy A> inline Reg<T> erf      (const Reg<T> x)                       { return x.erf();                         }
+template <typename T, Accuracy A> inline Reg<T> erfc     (const Reg<T> x)                       { return x.erfc();                        }
+#endif
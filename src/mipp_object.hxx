@@ -125,6 +125,11 @@ public:
 	inline void        loadu        (const T* data)                              { r = mipp::loadu<T>(data);                      }
 	inline void        store        (T* data)                              const { mipp::store<T>(data, r);                       }
 	inline void        storeu       (T* data)                              const { mipp::storeu<T>(data, r);                      }
+	inline void        load_n       (const T* data, const uint32_t n)            { r = mipp::load_n<T>(data, n);                  }
+	inline void        loadu_n      (const T* data, const uint32_t n)            { r = mipp::loadu_n<T>(data, n);                 }
+	inline void        store_n      (T* data, const uint32_t n)            const { mipp::store_n<T>(data, r, n);                  }
+	inline void        storeu_n     (T* data, const uint32_t n)            const { mipp::storeu_n<T>(data, r, n);                 }
+	inline void        stream       (T* data)                              const { mipp::stream<T>(data, r);                      }
 	inline Reg_2<T>    low          ()                                     const { return mipp::low <T>(r);                       }
 	inline Reg_2<T>    high         ()                                     const { return mipp::high<T>(r);                       }
 	inline Reg<T>      shuff        (const Reg<T> v_shu)                   const { return mipp::shuff        <T>(r, v_shu.r);     }
@@ -177,15 +182,32 @@ public:
 	inline Reg<T>      rsqrt        ()                                     const { return mipp::rsqrt        <T>(r);              }
 	inline Reg<T>      log          ()                                     const { return mipp::log          <T>(r);              }
 	inline Reg<T>      exp          ()                                     const { return mipp::exp          <T>(r);              }
+	inline Reg<T>      exp2         ()                                     const { return mipp::exp2         <T>(r);              }
+	inline Reg<T>      expm1        ()                                     const { return mipp::expm1        <T>(r);              }
+	inline Reg<T>      log2         ()                                     const { return mipp::log2         <T>(r);              }
+	inline Reg<T>      log10        ()                                     const { return mipp::log10        <T>(r);              }
+	inline Reg<T>      log1p        ()                                     const { return mipp::log1p        <T>(r);              }
+	inline Reg<T>      cbrt         ()                                     const { return mipp::cbrt         <T>(r);              }
+	inline Reg<T>      pow          (const Reg<T> y)                       const { return mipp::pow          <T>(r, y.r);         }
+	inline Reg<T>      powi         (const int n)                          const { return mipp::powi         <T>(r, n);           }
 	inline Reg<T>      sin          ()                                     const { return mipp::sin          <T>(r);              }
 	inline Reg<T>      cos          ()                                     const { return mipp::cos          <T>(r);              }
 	inline Reg<T>      tan          ()                                     const { return mipp::tan          <T>(r);              }
+	inline Reg<T>      atan         ()                                     const { return mipp::atan         <T>(r);              }
+	inline Reg<T>      atan2        (const Reg<T> x)                       const { return mipp::atan2        <T>(r, x.r);         }
+	inline Reg<T>      asin         ()                                     const { return mipp::asin         <T>(r);              }
+	inline Reg<T>      acos         ()                                     const { return mipp::acos         <T>(r);              }
 	inline void        sincos       (      Reg<T> &s,       Reg<T> &c)     const {        mipp::sincos       <T>(r,  s.r,  c.r);  }
 	inline Regx2<T>    sincos       ()                                     const { return mipp::sincos       <T>(r);              }
 	inline Regx2<T>    cossin       ()                                     const { return mipp::cossin       <T>(r);              }
 	inline Reg<T>      sinh         ()                                     const { return mipp::sinh         <T>(r);              }
 	inline Reg<T>      cosh         ()                                     const { return mipp::cosh         <T>(r);              }
 	inline Reg<T>      tanh         ()                                     const { return mipp::tanh         <T>(r);              }
+	inline Reg<T>      sigmoid      ()                                     const { return mipp::sigmoid      <T>(r);              }
+	inline Reg<T>      softplus     ()                                     const { return mipp::softplus     <T>(r);              }
+	inline Reg<T>      logaddexp    (const Reg<T> v)                       const { return mipp::logaddexp    <T>(r, v.r);         }
+	inline Reg<T>      erf          ()                                     const { return mipp::erf          <T>(r);              }
+	inline Reg<T>      erfc         ()                                     const { return mipp::erfc         <T>(r);              }
 	inline Reg<T>      asinh        ()                                     const { return mipp::asinh        <T>(r);              }
 	inline Reg<T>      acosh        ()                                     const { return mipp::acosh        <T>(r);              }
 	inline Reg<T>      atanh        ()                                     const { return mipp::atanh        <T>(r);              }
@@ -200,6 +222,9 @@ public:
 	inline Reg<T>      fmsub        (const Reg<T> v1, const Reg<T> v2)     const { return mipp::fmsub        <T>(r, v1.r, v2.r);  }
 	inline Reg<T>      fnmsub       (const Reg<T> v1, const Reg<T> v2)     const { return mipp::fnmsub       <T>(r, v1.r, v2.r);  }
 	inline Reg<T>      blend        (const Reg<T> v1, const Msk<N<T>()> m) const { return mipp::blend        <T>(r, v1.r,  m.m);  }
+	inline Reg<T>      compress     (const Msk<N<T>()> m)                  const { return mipp::compress     <T>(r, m.m);         }
+	inline Reg<T>      expand       (const Msk<N<T>()> m)                  const { return mipp::expand       <T>(r, m.m);         }
+	inline uint32_t    compress_store(T* data, const Msk<N<T>()> m)        const { return mipp::compress_store<T>(data, r, m.m); }
 	inline Reg<T>      lrot         ()                                     const { return mipp::lrot         <T>(r);              }
 	inline Reg<T>      rrot         ()                                     const { return mipp::rrot         <T>(r);              }
 	inline Reg<T>      div2         ()                                     const { return mipp::div2         <T>(r);              }
@@ -216,6 +241,11 @@ public:
 	inline void        loadu        (const T* data)                              { r = data[0];                                   }
 	inline void        store        (T* data)                              const { data[0] = r;                                   }
 	inline void        storeu       (T* data)                              const { data[0] = r;                                   }
+	inline void        load_n       (const T* data, const uint32_t n)            { r = n ? data[0] : (T)0;                        }
+	inline void        loadu_n      (const T* data, const uint32_t n)            { r = n ? data[0] : (T)0;                        }
+	inline void        store_n      (T* data, const uint32_t n)            const { if (n) data[0] = r;                            }
+	inline void        storeu_n     (T* data, const uint32_t n)            const { if (n) data[0] = r;                            }
+	inline void        stream       (T* data)                              const { data[0] = r;                                   }
 	inline Reg_2<T>    low          ()                                     const { return r;                                      }
 	inline Reg_2<T>    high         ()                                     const { return r;                                      }
 	inline Reg<T>      shuff        (const Reg<T> v_shu)                   const { return *this;                                  }
@@ -269,15 +299,35 @@ public:
 	inline Reg<T>      rsqrt        ()                                     const { return (T)(1 / std::sqrt(r));                  }
 	inline Reg<T>      log          ()                                     const { return (T)std::log(r);                         }
 	inline Reg<T>      exp          ()                                     const { return (T)std::exp(r);                         }
+	inline Reg<T>      exp2         ()                                     const { return (T)std::exp2(r);                        }
+	inline Reg<T>      expm1        ()                                     const { return (T)std::expm1(r);                       }
+	inline Reg<T>      log2         ()                                     const { return (T)std::log2(r);                        }
+	inline Reg<T>      log10        ()                                     const { return (T)std::log10(r);                       }
+	inline Reg<T>      log1p        ()                                     const { return (T)std::log1p(r);                       }
+	inline Reg<T>      cbrt         ()                                     const { return (T)std::cbrt(r);                        }
+	inline Reg<T>      pow          (const Reg<T> y)                       const { return (T)std::pow(r, y.r);                    }
+	inline Reg<T>      powi         (const int n)                          const { return (T)std::pow(r, n);                      }
 	inline Reg<T>      sin          ()                                     const { return (T)std::sin(r);                         }
 	inline Reg<T>      cos          ()                                     const { return (T)std::cos(r);                         }
 	inline Reg<T>      tan          ()                                     const { return (T)std::tan(r);                         }
+	inline Reg<T>      atan         ()                                     const { return (T)std::atan(r);                        }
+	inline Reg<T>      atan2        (const Reg<T> x)                       const { return (T)std::atan2(r, x.r);                  }
+	inline Reg<T>      asin         ()                                     const { return (T)std::asin(r);                        }
+	inline Reg<T>      acos         ()                                     const { return (T)std::acos(r);                        }
 	inline void        sincos       (      Reg<T> &s,       Reg<T> &c)     const { s = std::sin(r); c = std::cos(r);              }
 	inline Regx2<T>    sincos       ()                                     const { return Regx2<T>(std::sin(r), std::cos(r));     }
 	inline Regx2<T>    cossin       ()                                     const { return Regx2<T>(std::cos(r), std::sin(r));     }
 	inline Reg<T>      sinh         ()                                     const { return (T)std::sinh(r);                        }
 	inline Reg<T>      cosh         ()                                     const { return (T)std::cosh(r);                        }
 	inline Reg<T>      tanh         ()                                     const { return (T)std::tanh(r);                        }
+	inline Reg<T>      sigmoid      ()                                     const { return (T)(1 / (1 + std::exp(-r)));            }
+	inline Reg<T>      softplus     ()                                     const { return std::max<T>(r, (T)0) +
+	                                                                                      (T)std::log1p(std::exp(-std::abs(r)));  }
+	inline Reg<T>      logaddexp    (const Reg<T> v)                       const { return r == v.r ? r + (T)0.693147180559945309 :
+	                                                                                      std::max<T>(r, v.r) +
+	                                                                                      (T)std::log1p(std::exp(-std::abs(r - v.r))); }
+	inline Reg<T>      erf          ()                                     const { return (T)std::erf(r);                         }
+	inline Reg<T>      erfc         ()                                     const { return (T)std::erfc(r);                        }
 	inline Reg<T>      asinh        ()                                     const { return (T)std::asinh(r);                       }
 	inline Reg<T>      acosh        ()                                     const { return (T)std::acosh(r);                       }
 	inline Reg<T>      atanh        ()                                     const { return (T)std::atanh(r);                       }
@@ -286,6 +336,9 @@ public:
 	inline Reg<T>      fmsub        (const Reg<T> v1, const Reg<T> v2)     const { return   r * v1.r - v2.r;                      }
 	inline Reg<T>      fnmsub       (const Reg<T> v1, const Reg<T> v2)     const { return -v2.r - (r * v1.r) ;                    }
 	inline Reg<T>      blend        (const Reg<T> v1, const Msk<N<T>()> m) const { return (m.m) ? r : v1.r;                       }
+	inline Reg<T>      compress     (const Msk<N<T>()> m)                  const { return (m.m) ? r : (T)0;                       }
+	inline Reg<T>      expand       (const Msk<N<T>()> m)                  const { return (m.m) ? r : (T)0;                       }
+	inline uint32_t    compress_store(T* data, const Msk<N<T>()> m)        const { if (m.m) data[0] = r; return m.m ? 1 : 0;      }
 	inline Reg<T>      lrot         ()                                     const { return r;                                      }
 	inline Reg<T>      rrot         ()                                     const { return r;                                      }
 	inline Reg<T>      div2         ()                                     const { return mipp_scop::div2<T>(r);                  }
@@ -362,7 +415,7 @@ public:
 	inline Msk<N<T>()> operator>=(Reg<T> v) const { return this->cmpge (v); }
 
 #ifndef MIPP_NO_INTRINSICS
-	inline T operator[](const size_t index) const { return mipp::get<T>(this->r, index); }
+	inline T operator[](const size_t index) const { return mipp::extract<T>(this->r, (uint32_t)index); }
 #else
 	inline T operator[](const size_t index) const { return r; }
 #endif
@@ -487,6 +540,13 @@ public:
 	inline Msk<N> rshift(const uint32_t n) const { return mipp::rshift<N>(m, n);   }
 	inline bool   testz (const Msk<N>   v) const { return mipp::testz <N>(m, v.m); }
 	inline bool   testz ()                 const { return mipp::testz <N>(m);      }
+
+	inline uint64_t to_bits() const { return mipp::to_bits<N>(m); }
+	inline uint32_t popcnt () const { return mipp::popcnt <N>(m); }
+	inline uint32_t ctz    () const { return mipp::ctz    <N>(m); }
+	inline uint32_t clz    () const { return mipp::clz    <N>(m); }
+	inline bool     any    () const { return mipp::any    <N>(m); }
+	inline bool     all    () const { return mipp::all    <N>(m); }
 #else
 	inline Msk<N> andb  (const Msk<N>   v) const { return mipp_scop::andb<msk>( m, v.m);                  }
 	inline Msk<N> andnb (const Msk<N>   v) const { return mipp_scop::andb<msk>(~m, v.m);                  }
@@ -497,6 +557,13 @@ public:
 	inline Msk<N> rshift(const uint32_t n) const { return mipp_scop::rshift<msk>(m, n * sizeof(msk) * 8); }
 	inline bool   testz (const Msk<N>   v) const { return mipp_scop::andb  <msk>(m, v.m) == 0 ? 1 : 0;    }
 	inline bool   testz ()                 const { return !m;                                             }
+
+	inline uint64_t to_bits() const { return m ? 1 : 0; }
+	inline uint32_t popcnt () const { return m ? 1 : 0; }
+	inline uint32_t ctz    () const { return m ? 0 : 1; }
+	inline uint32_t clz    () const { return m ? 0 : 1; }
+	inline bool     any    () const { return m != 0;    }
+	inline bool     all    () const { return m != 0;    }
 #endif
 
 	template <typename T> inline Reg<T> andb  (const Reg<T> v)  const { return this->toReg<T>().andb (v); }
@@ -653,6 +720,173 @@ public:
 	inline Regx2<T>  operator/ (const Regx2<T>  v) const { return this->cdiv(v);                                                             }
 };
 
+// 'K' registers processed together, they hold 'K * N<T>()' contiguous elements. Each operation is expanded at compile
+// time in 'K' independent operations on 'Reg<T>': there is no dependency between them and the CPU can overlap their
+// latencies (instruction-level parallelism). A kernel written as a template on the register type ('Reg<T>' or
+// 'Regs<T,K>') is unrolled without being rewritten, the masks are only available per register ('regs[k]').
+template <typename T, int K>
+class Regs
+{
+	static_assert(K > 0, "The number of registers 'K' has to be greater than 0.");
+
+public:
+	Reg<T> val[K];
+
+	Regs(                  )                                                                  {}
+	Regs(const T      val  ) { _unroll<K>::apply([&](const int k) { this->val[k] = Reg<T>(val); }); }
+	Regs(const Reg<T> r    ) { _unroll<K>::apply([&](const int k) { this->val[k] = r;           }); }
+	Regs(const T     *data ) { this->load(data);                                                   }
+
+	~Regs() = default;
+
+	static constexpr int size() { return K * N<T>(); }
+
+	inline       Reg<T>& operator[](size_t index)       { return val[index]; }
+	inline const Reg<T>& operator[](size_t index) const { return val[index]; }
+
+	// applies 'f' on each register ('f(Reg<T>)' returns a 'Reg<T>')
+	template <class F>
+	inline Regs<T,K> map(F f) const
+	{
+		Regs<T,K> res;
+		_unroll<K>::apply([&](const int k) { res.val[k] = f(val[k]); });
+		return res;
+	}
+
+	// applies 'f' on each pair of registers ('f(Reg<T>, Reg<T>)' returns a 'Reg<T>')
+	template <class F>
+	inline Regs<T,K> map(const Regs<T,K> &v, F f) const
+	{
+		Regs<T,K> res;
+		_unroll<K>::apply([&](const int k) { res.val[k] = f(val[k], v.val[k]); });
+		return res;
+	}
+
+	// applies 'f' on each triplet of registers ('f(Reg<T>, Reg<T>, Reg<T>)' returns a 'Reg<T>')
+	template <class F>
+	inline Regs<T,K> map(const Regs<T,K> &v1, const Regs<T,K> &v2, F f) const
+	{
+		Regs<T,K> res;
+		_unroll<K>::apply([&](const int k) { res.val[k] = f(val[k], v1.val[k], v2.val[k]); });
+		return res;
+	}
+
+	inline void      set0   (                               ) { _unroll<K>::apply([&](const int k) { val[k].set0();                  }); }
+	inline void      set1   (const T val                    ) { _unroll<K>::apply([&](const int k) { this->val[k].set1(val);         }); }
+	inline void      load   (const T* data                  ) { _unroll<K>::apply([&](const int k) { val[k].load (data + k * N<T>()); }); }
+	inline void      loadu  (const T* data                  ) { _unroll<K>::apply([&](const int k) { val[k].loadu(data + k * N<T>()); }); }
+	inline void      store  (T* data                   ) const { _unroll<K>::apply([&](const int k) { val[k].store (data + k * N<T>()); }); }
+	inline void      storeu (T* data                   ) const { _unroll<K>::apply([&](const int k) { val[k].storeu(data + k * N<T>()); }); }
+	inline void      stream (T* data                   ) const { _unroll<K>::apply([&](const int k) { val[k].stream(data + k * N<T>()); }); }
+
+	// the 'n' first elements (over the 'K' registers), the other elements are set to zero
+	inline void loadu_n(const T* data, const uint32_t n)
+	{
+		_unroll<K>::apply([&](const int k) {
+			const uint32_t o = (uint32_t)(k * N<T>());
+			val[k].loadu_n(data + o, n > o ? n - o : 0);
+		});
+	}
+
+	inline void storeu_n(T* data, const uint32_t n) const
+	{
+		_unroll<K>::apply([&](const int k) {
+			const uint32_t o = (uint32_t)(k * N<T>());
+			val[k].storeu_n(data + o, n > o ? n - o : 0);
+		});
+	}
+
+	inline Regs<T,K> add   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.add (b); }); }
+	inline Regs<T,K> sub   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.sub (b); }); }
+	inline Regs<T,K> mul   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.mul (b); }); }
+	inline Regs<T,K> div   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.div (b); }); }
+	inline Regs<T,K> min   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.min (b); }); }
+	inline Regs<T,K> max   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.max (b); }); }
+	inline Regs<T,K> andb  (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.andb(b); }); }
+	inline Regs<T,K> andnb (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.andnb(b); }); }
+	inline Regs<T,K> orb   (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.orb (b); }); }
+	inline Regs<T,K> xorb  (const Regs<T,K> &v) const { return map(v, [](const Reg<T> a, const Reg<T> b) { return a.xorb(b); }); }
+	inline Regs<T,K> notb  (                  ) const { return map(   [](const Reg<T> a              ) { return a.notb( ); }); }
+	inline Regs<T,K> abs   (                  ) const { return map(   [](const Reg<T> a              ) { return a.abs ( ); }); }
+	inline Regs<T,K> sqrt  (                  ) const { return map(   [](const Reg<T> a              ) { return a.sqrt( ); }); }
+	inline Regs<T,K> rsqrt (                  ) const { return map(   [](const Reg<T> a              ) { return a.rsqrt(); }); }
+	inline Regs<T,K> log   (                  ) const { return map(   [](const Reg<T> a              ) { return a.log ( ); }); }
+	inline Regs<T,K> exp   (                  ) const { return map(   [](const Reg<T> a              ) { return a.exp ( ); }); }
+	inline Regs<T,K> sin   (                  ) const { return map(   [](const Reg<T> a              ) { return a.sin ( ); }); }
+	inline Regs<T,K> cos   (                  ) const { return map(   [](const Reg<T> a              ) { return a.cos ( ); }); }
+	inline Regs<T,K> round (                  ) const { return map(   [](const Reg<T> a              ) { return a.round(); }); }
+	inline Regs<T,K> lshift(const uint32_t n  ) const { return map(   [n](const Reg<T> a             ) { return a.lshift(n); }); }
+	inline Regs<T,K> rshift(const uint32_t n  ) const { return map(   [n](const Reg<T> a             ) { return a.rshift(n); }); }
+
+	inline Regs<T,K> fmadd (const Regs<T,K> &v1, const Regs<T,K> &v2) const
+	{
+		return map(v1, v2, [](const Reg<T> a, const Reg<T> b, const Reg<T> c) { return a.fmadd(b, c); });
+	}
+
+	inline Regs<T,K> fnmadd(const Regs<T,K> &v1, const Regs<T,K> &v2) const
+	{
+		return map(v1, v2, [](const Reg<T> a, const Reg<T> b, const Reg<T> c) { return a.fnmadd(b, c); });
+	}
+
+	inline Regs<T,K> fmsub (const Regs<T,K> &v1, const Regs<T,K> &v2) const
+	{
+		return map(v1, v2, [](const Reg<T> a, const Reg<T> b, const Reg<T> c) { return a.fmsub(b, c); });
+	}
+
+	inline Regs<T,K> fnmsub(const Regs<T,K> &v1, const Regs<T,K> &v2) const
+	{
+		return map(v1, v2, [](const Reg<T> a, const Reg<T> b, const Reg<T> c) { return a.fnmsub(b, c); });
+	}
+
+	inline Regs<T,K>& operator+= (const Regs<T,K> &v)       { *this = this->add(v);  return *this; }
+	inline Regs<T,K>  operator+  (const Regs<T,K> &v) const { return this->add(v);                 }
+
+	inline Regs<T,K>& operator-= (const Regs<T,K> &v)       { *this = this->sub(v);  return *this; }
+	inline Regs<T,K>  operator-  (const Regs<T,K> &v) const { return this->sub(v);                 }
+
+	inline Regs<T,K>& operator*= (const Regs<T,K> &v)       { *this = this->mul(v);  return *this; }
+	inline Regs<T,K>  operator*  (const Regs<T,K> &v) const { return this->mul(v);                 }
+
+	inline Regs<T,K>& operator/= (const Regs<T,K> &v)       { *this = this->div(v);  return *this; }
+	inline Regs<T,K>  operator/  (const Regs<T,K> &v) const { return this->div(v);                 }
+
+	inline Regs<T,K>  operator~  (                  ) const { return this->notb();                 }
+
+	inline Regs<T,K>& operator^= (const Regs<T,K> &v)       { *this = this->xorb(v); return *this; }
+	inline Regs<T,K>  operator^  (const Regs<T,K> &v) const { return this->xorb(v);                }
+
+	inline Regs<T,K>& operator|= (const Regs<T,K> &v)       { *this = this->orb(v);  return *this; }
+	inline Regs<T,K>  operator|  (const Regs<T,K> &v) const { return this->orb(v);                 }
+
+	inline Regs<T,K>& operator&= (const Regs<T,K> &v)       { *this = this->andb(v); return *this; }
+	inline Regs<T,K>  operator&  (const Regs<T,K> &v) const { return this->andb(v);                }
+
+	inline Regs<T,K>& operator<<=(const uint32_t    n)       { *this = this->lshift(n); return *this; }
+	inline Regs<T,K>  operator<< (const uint32_t    n) const { return this->lshift(n);                }
+
+	inline Regs<T,K>& operator>>=(const uint32_t    n)       { *this = this->rshift(n); return *this; }
+	inline Regs<T,K>  operator>> (const uint32_t    n) const { return this->rshift(n);                }
+
+	// ------------------------------------------------------------------------------------------------------ reduction
+	// the 'K' registers are combined pairwise (tree of depth 'log2(K)') before the horizontal reduction
+	template <Red_op<T> OP>
+	inline Reg<T> reduce() const
+	{
+		Reg<T> acc[K];
+		_unroll<K>::apply([&](const int k) { acc[k] = val[k]; });
+		for (auto s = 1; s < K; s *= 2)
+			for (auto k = 0; k + s < K; k += 2 * s)
+				acc[k] = OP(acc[k], acc[k + s]);
+		return acc[0];
+	}
+
+	inline T sum () const { return Reduction<T,mipp::add>::sapply(this->template reduce<mipp::add>()); }
+	inline T hadd() const { return Reduction<T,mipp::add>::sapply(this->template reduce<mipp::add>()); }
+	inline T hmul() const { return Reduction<T,mipp::mul>::sapply(this->template reduce<mipp::mul>()); }
+	inline T hmin() const { return Reduction<T,mipp::min>::sapply(this->template reduce<mipp::min>()); }
+	inline T hmax() const { return Reduction<T,mipp::max>::sapply(this->template reduce<mipp::max>()); }
+};
+
 #ifndef MIPP_NO_INTRINSICS
 template <typename T>
 std::ostream& operator<<(std::ostream& os, const Reg<T>& r)
@@ -762,15 +996,32 @@ template <typename T> inline Reg<T>      sqrt         (const Reg<T> v)
 template <typename T> inline Reg<T>      rsqrt        (const Reg<T> v)                                        { return v.rsqrt();                }
 template <typename T> inline Reg<T>      log          (const Reg<T> v)                                        { return v.log();                  }
 template <typename T> inline Reg<T>      exp          (const Reg<T> v)                                        { return v.exp();                  }
+template <typename T> inline Reg<T>      exp2         (const Reg<T> v)                                        { return v.exp2();                 }
+template <typename T> inline Reg<T>      expm1        (const Reg<T> v)                                        { return v.expm1();                }
+template <typename T> inline Reg<T>      log2         (const Reg<T> v)                                        { return v.log2();                 }
+template <typename T> inline Reg<T>      log10        (const Reg<T> v)                                        { return v.log10();                }
+template <typename T> inline Reg<T>      log1p        (const Reg<T> v)                                        { return v.log1p();                }
+template <typename T> inline Reg<T>      cbrt         (const Reg<T> v)                                        { return v.cbrt();                 }
+template <typename T> inline Reg<T>      pow          (const Reg<T> x, const Reg<T> y)                        { return x.pow(y);                 }
+template <typename T> inline Reg<T>      powi         (const Reg<T> x, const int n)                           { return x.powi(n);                }
 template <typename T> inline Reg<T>      sin          (const Reg<T> v)                                        { return v.sin();                  }
 template <typename T> inline Reg<T>      cos          (const Reg<T> v)                                        { return v.cos();                  }
 template <typename T> inline Reg<T>      tan          (const Reg<T> v)                                        { return v.tan();                  }
+template <typename T> inline Reg<T>      atan         (const Reg<T> v)                                        { return v.atan();                 }
+template <typename T> inline Reg<T>      atan2        (const Reg<T> y, const Reg<T> x)                        { return y.atan2(x);               }
+template <typename T> inline Reg<T>      asin         (const Reg<T> v)                                        { return v.asin();                 }
+template <typename T> inline Reg<T>      acos         (const Reg<T> v)                                        { return v.acos();                 }
 template <typename T> inline void        sincos       (const Reg<T> x,        Reg<T> &s,       Reg<T> &c)     { return x.sincos(s,c);            }
 template <typename T> inline Regx2<T>    sincos       (const Reg<T> x)                                        { return x.sincos();               }
 template <typename T> inline Regx2<T>    cossin       (const Reg<T> x)                                        { return x.cossin();               }
 template <typename T> inline Reg<T>      sinh         (const Reg<T> v)                                        { return v.sinh();                 }
 template <typename T> inline Reg<T>      cosh         (const Reg<T> v)                                        { return v.cosh();                 }
 template <typename T> inline Reg<T>      tanh         (const Reg<T> v)                                        { return v.tanh();                 }
+template <typename T> inline Reg<T>      sigmoid      (const Reg<T> v)                                        { return v.sigmoid();              }
+template <typename T> inline Reg<T>      softplus     (const Reg<T> v)                                        { return v.softplus();             }
+template <typename T> inline Reg<T>      logaddexp    (const Reg<T> a, const Reg<T> b)                        { return a.logaddexp(b);           }
+template <typename T> inline Reg<T>      erf          (const Reg<T> v)                                        { return v.erf();                  }
+template <typename T> inline Reg<T>      erfc         (const Reg<T> v)                                        { return v.erfc();                 }
 template <typename T> inline Reg<T>      asinh        (const Reg<T> v)                                        { return v.asinh();                }
 template <typename T> inline Reg<T>      acosh        (const Reg<T> v)                                        { return v.acosh();                }
 template <typename T> inline Reg<T>      atanh        (const Reg<T> v)                                        { return v.atanh();                }
@@ -779,6 +1030,10 @@ template <typename T> inline Reg<T>      fnmadd       (const Reg<T> v1, const Re
 template <typename T> inline Reg<T>      fmsub        (const Reg<T> v1, const Reg<T> v2, const Reg<T> v3)     { return v1.fmsub(v2, v3);         }
 template <typename T> inline Reg<T>      fnmsub       (const Reg<T> v1, const Reg<T> v2, const Reg<T> v3)     { return v1.fnmsub(v2, v3);        }
 template <typename T> inline Reg<T>      blend        (const Reg<T> v1, const Reg<T> v2, const Msk<N<T>()> m) { return v1.blend(v2, m );         }
+template <typename T> inline Reg<T>      compress     (const Reg<T> v, const Msk<N<T>()> m)                   { return v.compress(m);            }
+template <typename T> inline Reg<T>      expand       (const Reg<T> v, const Msk<N<T>()> m)                   { return v.expand(m);              }
+template <typename T> inline uint32_t    compress_store(T* data, const Reg<T> v, const Msk<N<T>()> m)         { return v.compress_store(data, m); }
+template <typename T> inline void        stream       (T* data, const Reg<T> v)                               { v.stream(data);                  }
 template <typename T> inline Reg<T>      lrot         (const Reg<T> v)                                        { return v.lrot();                 }
 template <typename T> inline Reg<T>      rrot         (const Reg<T> v)                                        { return v.rrot();                 }
 template <typename T> inline Reg<T>      div2         (const Reg<T> v)                                        { return v.div2();                 }
@@ -789,6 +1044,12 @@ template <typename T> inline bool        testz        (const Reg<T> v1, const Re
 template <int      N> inline bool        testz        (const Msk<N> v1, const Msk<N> v2)                      { return v1.testz(v2);             }
 template <typename T> inline bool        testz        (const Reg<T> v1)                                       { return v1.testz();               }
 template <int      N> inline bool        testz        (const Msk<N> v1)                                       { return v1.testz();               }
+template <int      N> inline uint64_t    to_bits      (const Msk<N> v1)                                       { return v1.to_bits();             }
+template <int      N> inline uint32_t    popcnt       (const Msk<N> v1)                                       { return v1.popcnt();              }
+template <int      N> inline uint32_t    ctz          (const Msk<N> v1)                                       { return v1.ctz();                 }
+template <int      N> inline uint32_t    clz          (const Msk<N> v1)                                       { return v1.clz();                 }
+template <int      N> inline bool        any          (const Msk<N> v1)                                       { return v1.any();                 }
+template <int      N> inline bool        all          (const Msk<N> v1)                                       { return v1.all();                 }
 template <typename T> inline     T       sum          (const Reg<T> v)                                        { return v.sum();                  }
 template <typename T> inline     T       hadd         (const Reg<T> v)                                        { return v.hadd();                 }
 template <typename T> inline     T       hmul         (const Reg<T> v)                                        { return v.hmul();                 }
@@ -803,6 +1064,37 @@ template <typename T> inline Regx2<T>    cdiv         (const Regx2<T> v1, const
 template <typename T> inline Regx2<T>    conj         (const Regx2<T> v)                                      { return v.conj();                 }
 template <typename T> inline Reg<T>      norm         (const Regx2<T> v)                                      { return v.norm();                 }
 
+template <typename T, int K> inline Regs<T,K> add   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.add(v2);           }
+template <typename T, int K> inline Regs<T,K> sub   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.sub(v2);           }
+template <typename T, int K> inline Regs<T,K> mul   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.mul(v2);           }
+template <typename T, int K> inline Regs<T,K> div   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.div(v2);           }
+template <typename T, int K> inline Regs<T,K> min   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.min(v2);           }
+template <typename T, int K> inline Regs<T,K> max   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.max(v2);           }
+template <typename T, int K> inline Regs<T,K> andb  (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.andb(v2);          }
+template <typename T, int K> inline Regs<T,K> andnb (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.andnb(v2);         }
+template <typename T, int K> inline Regs<T,K> orb   (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.orb(v2);           }
+template <typename T, int K> inline Regs<T,K> xorb  (const Regs<T,K> &v1, const Regs<T,K> &v2)                     { return v1.xorb(v2);          }
+template <typename T, int K> inline Regs<T,K> notb  (const Regs<T,K> &v)                                           { return v.notb();             }
+template <typename T, int K> inline Regs<T,K> abs   (const Regs<T,K> &v)                                           { return v.abs();              }
+template <typename T, int K> inline Regs<T,K> sqrt  (const Regs<T,K> &v)                                           { return v.sqrt();             }
+template <typename T, int K> inline Regs<T,K> rsqrt (const Regs<T,K> &v)                                           { return v.rsqrt();            }
+template <typename T, int K> inline Regs<T,K> log   (const Regs<T,K> &v)                                           { return v.log();              }
+template <typename T, int K> inline Regs<T,K> exp   (const Regs<T,K> &v)                                           { return v.exp();              }
+template <typename T, int K> inline Regs<T,K> sin   (const Regs<T,K> &v)                                           { return v.sin();              }
+template <typename T, int K> inline Regs<T,K> cos   (const Regs<T,K> &v)                                           { return v.cos();              }
+template <typename T, int K> inline Regs<T,K> round (const Regs<T,K> &v)                                           { return v.round();            }
+template <typename T, int K> inline Regs<T,K> lshift(const Regs<T,K> &v, const uint32_t n)                         { return v.lshift(n);          }
+template <typename T, int K> inline Regs<T,K> rshift(const Regs<T,K> &v, const uint32_t n)                         { return v.rshift(n);          }
+template <typename T, int K> inline Regs<T,K> fmadd (const Regs<T,K> &v1, const Regs<T,K> &v2, const Regs<T,K> &v3) { return v1.fmadd(v2, v3);    }
+template <typename T, int K> inline Regs<T,K> fnmadd(const Regs<T,K> &v1, const Regs<T,K> &v2, const Regs<T,K> &v3) { return v1.fnmadd(v2, v3);   }
+template <typename T, int K> inline Regs<T,K> fmsub (const Regs<T,K> &v1, const Regs<T,K> &v2, const Regs<T,K> &v3) { return v1.fmsub(v2, v3);    }
+template <typename T, int K> inline Regs<T,K> fnmsub(const Regs<T,K> &v1, const Regs<T,K> &v2, const Regs<T,K> &v3) { return v1.fnmsub(v2, v3);   }
+template <typename T, int K> inline     T     sum   (const Regs<T,K> &v)                                           { return v.sum();              }
+template <typename T, int K> inline     T     hadd  (const Regs<T,K> &v)                                           { return v.hadd();             }
+template <typename T, int K> inline     T     hmul  (const Regs<T,K> &v)                                           { return v.hmul();             }
+template <typename T, int K> inline     T     hmin  (const Regs<T,K> &v)                                           { return v.hmin();             }
+template <typename T, int K> inline     T     hmax  (const Regs<T,K> &v)                                           { return v.hmax();             }
+
 template <typename T>
 inline Reg<T> toReg(const Msk<N<T>()> m) {
 	return m.template toReg<T>();
@@ -827,3 +1119,429 @@ template <typename T1, typename T2>
 inline Reg<T2> cast(const Reg<T1> v) {
 	return v.template cast<T2>();
 }
+
+#ifndef MIPP_NO_INTRINSICS
+template <typename T, typename TI>
+inline Reg<T> gather(const T *mem_addr, const Reg<TI> idx) {
+	return mipp::gather<T,TI>(mem_addr, idx.r);
+}
+
+template <typename T, typename TI>
+inline Reg<T> gather(const Msk<N<T>()> m, const Reg<T> src, const T *mem_addr, const Reg<TI> idx) {
+	return mipp::gather<T,TI>(m.m, src.r, mem_addr, idx.r);
+}
+
+template <typename T, typename TI>
+inline void scatter(T *mem_addr, const Reg<TI> idx, const Reg<T> r) {
+	mipp::scatter<T,TI>(mem_addr, idx.r, r.r);
+}
+
+template <typename T, typename TI>
+inline void scatter(const Msk<N<T>()> m, T *mem_addr, const Reg<TI> idx, const Reg<T> r) {
+	mipp::scatter<T,TI>(m.m, mem_addr, idx.r, r.r);
+}
+#else
+template <typename T, typename TI>
+inline Reg<T> gather(const T *mem_addr, const Reg<TI> idx) {
+	return Reg<T>(mem_addr[idx.r]);
+}
+
+template <typename T, typename TI>
+inline Reg<T> gather(const Msk<N<T>()> m, const Reg<T> src, const T *mem_addr, const Reg<TI> idx) {
+	return m.m ? Reg<T>(mem_addr[idx.r]) : src;
+}
+
+template <typename T, typename TI>
+inline void scatter(T *mem_addr, const Reg<TI> idx, const Reg<T> r) {
+	mem_addr[idx.r] = r.r;
+}
+
+template <typename T, typename TI>
+inline void scatter(const Msk<N<T>()> m, T *mem_addr, const Reg<TI> idx, const Reg<T> r) {
+	if (m.m) mem_addr[idx.r] = r.r;
+}
+#endif
+
+#ifndef MIPP_NO_INTRINSICS
+template <typename T>
+inline std::pair<T,uint32_t> argmin(const Reg<T> v) {
+	return mipp::argmin<T>(v.r);
+}
+
+template <typename T>
+inline std::pair<T,uint32_t> argmax(const Reg<T> v) {
+	return mipp::argmax<T>(v.r);
+}
+#else
+template <typename T>
+inline std::pair<T,uint32_t> argmin(const Reg<T> v) {
+	return std::make_pair(v.r, (uint32_t)0);
+}
+
+template <typename T>
+inline std::pair<T,uint32_t> argmax(const Reg<T> v) {
+	return std::make_pair(v.r, (uint32_t)0);
+}
+#endif
+
+#ifndef MIPP_NO_INTRINSICS
+template <typename T, int I>
+inline T extract(const Reg<T> v) {
+	return mipp::extract<T,I>(v.r);
+}
+
+template <typename T>
+inline T extract(const Reg<T> v, const uint32_t index) {
+	return mipp::extract<T>(v.r, index);
+}
+
+template <typename T, int... I>
+inline Reg<T> permute(const Reg<T> v) {
+	return mipp::permute<T,I...>(v.r);
+}
+#else
+template <typename T, int I>
+inline T extract(const Reg<T> v) {
+	return v.r;
+}
+
+template <typename T>
+inline T extract(const Reg<T> v, const uint32_t index) {
+	return v.r;
+}
+
+template <typename T, int... I>
+inline Reg<T> permute(const Reg<T> v) {
+	static_assert(sizeof...(I) == 1, "mipp::permute: the number of indexes has to be 'N<T>()'.");
+	return v;
+}
+#endif
+
+// position of the first element of 'data' equal to 'val', or of the first NaN if 'nan' is true ('size' if there is none)
+template <typename T>
+inline size_t _find_first(const T *data, const size_t size, const T val, const bool nan) {
+	const auto rVal = Reg<T>(val);
+
+	size_t i = 0;
+	for (; i + N<T>() <= size; i += N<T>()) {
+		Reg<T> r;
+		r.loadu(&data[i]);
+		const auto m = nan ? r != r : r == rVal;
+		if (!m.testz())
+#ifndef MIPP_NO_INTRINSICS
+			return i + mipp::_first_lane<T>(m.m);
+#else
+			return i;
+#endif
+	}
+	for (; i < size; i++)
+		if (nan ? data[i] != data[i] : data[i] == val)
+			break;
+
+	return i;
+}
+
+// the extreme value of 'data' is first computed with the multi-accumulator reduction, then the array is scanned again
+// until the register holding its first occurrence is found (on ties, the lowest index wins). With NaNs in 'data', the
+// reduction can be NaN (it is never equal to itself) or the neutral element of the padding ('min(NaN, +inf)' is '+inf'
+// on x86): when the value is not found, the first NaN is returned.
+template <typename T, Red_op<T> OP>
+inline std::pair<T,size_t> _arg_extremum(const T *data, const size_t size) {
+	assert(size > 0);
+
+	const T val = Reduction<T,OP>::apply(data, size);
+	const size_t i = mipp::_find_first(data, size, val, false);
+	if (i < size)
+		return std::make_pair(val, i);
+
+	const size_t j = mipp::_find_first(data, size, val, true);
+	assert(j < size);
+	return std::make_pair(data[j], j);
+}
+
+template <typename T>
+inline std::pair<T,size_t> argmin(const T *data, const size_t size) {
+	return mipp::_arg_extremum<T,mipp::min<T>>(data, size);
+}
+
+template <typename T>
+inline std::pair<T,size_t> argmax(const T *data, const size_t size) {
+	return mipp::_arg_extremum<T,mipp::max<T>>(data, size);
+}
+
+// copies in 'out' the elements of 'in' for which 'pred' is true and returns their number, 'pred' takes a 'Reg<T>' and
+// returns a 'Msk<N<T>()>'. The full compressed registers are stored, so 'out' has to be large enough to hold 'size'
+// elements (the elements after the returned number are undefined), 'out' can be 'in' (in place filtering).
+template <typename T, class P>
+inline size_t filter(const T *in, const size_t size, T *out, P pred) {
+	const size_t vecSize = (size / N<T>()) * N<T>();
+
+	size_t j = 0;
+	for (size_t i = 0; i < vecSize; i += N<T>()) {
+		Reg<T> r;
+		r.loadu(&in[i]);
+		const auto m = pred(r);
+		r.compress(m).storeu(&out[j]);
+		j += m.popcnt();
+	}
+
+#ifndef MIPP_NO_INTRINSICS
+	if (vecSize < size) {
+		const uint32_t n = (uint32_t)(size - vecSize);
+		Reg<T> r;
+		r.loadu_n(&in[vecSize], n);
+		const auto m = pred(r) & Msk<N<T>()>(mipp::mask_n<N<T>()>(n));
+		j += r.compress_store(&out[j], m);
+	}
+#endif
+
+	return j;
+}
+
+// above this output size (in bytes), 'transform' and 'copy' write with non-temporal stores: such an output does not fit
+// in the last level cache and it would only evict the working set
+#ifndef MIPP_STREAM_THRESHOLD
+#define MIPP_STREAM_THRESHOLD (4 * 1024 * 1024)
+#endif
+
+// number of elements to process before 'out' is aligned on the register size, 'size' if the output has not to be
+// streamed (small output or 'out' that can't be aligned)
+template <typename T>
+inline size_t _stream_head(const T *out, const size_t size) {
+#ifndef MIPP_NO_INTRINSICS
+	constexpr size_t regBytes = (size_t)mipp::RegisterSizeBit / 8;
+	const size_t misalign = (size_t)((uintptr_t)out % regBytes);
+	if (size * sizeof(T) < (size_t)MIPP_STREAM_THRESHOLD || misalign % sizeof(T))
+		return size;
+	return misalign ? (regBytes - misalign) / sizeof(T) : 0;
+#else
+	return size;
+#endif
+}
+
+// writes 'f(in)' in 'out' for the 'size' elements of 'in', 'f' takes a 'Reg<T>' and returns a 'Reg<T>' (it has to be an
+// element-wise function: the last register is completed with zeros). 'out' can be 'in' (in place transform).
+template <typename T, class F>
+inline void transform(const T *in, const size_t size, T *out, F f) {
+	const size_t head = mipp::_stream_head<T>(out, size);
+
+	size_t i = 0;
+	if (head < size) {
+		if (head) {
+			Reg<T> r;
+			r.loadu_n(in, (uint32_t)head);
+			f(r).storeu_n(out, (uint32_t)head);
+			i = head;
+		}
+		for (; i + N<T>() <= size; i += N<T>()) {
+			Reg<T> r;
+			r.loadu(&in[i]);
+			f(r).stream(&out[i]);
+		}
+		mipp::sfence();
+	} else {
+		for (; i + N<T>() <= size; i += N<T>()) {
+			Reg<T> r;
+			r.loadu(&in[i]);
+			f(r).storeu(&out[i]);
+		}
+	}
+
+	if (i < size) {
+		Reg<T> r;
+		r.loadu_n(&in[i], (uint32_t)(size - i));
+		f(r).storeu_n(&out[i], (uint32_t)(size - i));
+	}
+}
+
+template <typename T>
+inline void copy(const T *in, const size_t size, T *out) {
+	mipp::transform(in, size, out, [](const Reg<T> r) { return r; });
+}
+
+// 'v' where the element 'i' is 'OP(v[0], ..., v[i])': the register is combined with itself shifted by 1, 2, 4, ...
+// elements (log2(N) steps), the first elements that receive nothing keep their value so 'OP' does not need a neutral
+// element
+template <typename T, Red_op<T> OP, int S = 1, bool = (S < N<T>())>
+struct _scan
+{
+	static Reg<T> apply(const Reg<T> v) {
+		const auto s = Reg<T>(mipp::_scan_shift<T,S>::apply(v.r));
+		return _scan<T,OP,2 * S>::apply(v.blend(OP(v, s), Msk<N<T>()>(mipp::mask_n<N<T>()>(S))));
+	}
+};
+
+template <typename T, Red_op<T> OP, int S>
+struct _scan<T,OP,S,false>
+{
+	static Reg<T> apply(const Reg<T> v) { return v; }
+};
+
+// 'v' shifted by one element, 'first' in the first element
+template <typename T>
+inline Reg<T> _scan_shift_in(const Reg<T> v, const T first) {
+#ifndef MIPP_NO_INTRINSICS
+	return Reg<T>(first).blend(Reg<T>(mipp::_scan_shift<T,1>::apply(v.r)), Msk<N<T>()>(mipp::mask_n<N<T>()>(1)));
+#else
+	return Reg<T>(first);
+#endif
+}
+
+// inclusive scan: 'OP(v[0], ..., v[i])' in the element 'i'
+template <typename T, Red_op<T> OP = mipp::add>
+inline Reg<T> scan(const Reg<T> v) {
+	return mipp::_scan<T,OP>::apply(v);
+}
+
+// exclusive scan: 'OP(init, v[0], ..., v[i -1])' in the element 'i' ('init' in the first element)
+template <typename T, Red_op<T> OP = mipp::add>
+inline Reg<T> scan_excl(const Reg<T> v, const T init) {
+	return mipp::_scan_shift_in(OP(Reg<T>(init), mipp::_scan<T,OP>::apply(v)), init);
+}
+
+// scans 'size' elements combined with 'carry', the last element of a register is the carry of the next one
+template <typename T, Red_op<T> OP, bool EXCL>
+inline void _scan_carry(const T *in, const size_t size, T *out, T carry) {
+	size_t i = 0;
+	for (; i + N<T>() <= size; i += N<T>()) {
+		Reg<T> r;
+		r.loadu(&in[i]);
+		const auto s = OP(Reg<T>(carry), mipp::_scan<T,OP>::apply(r));
+		(EXCL ? mipp::_scan_shift_in(s, carry) : s).storeu(&out[i]);
+		carry = mipp::extract<T,N<T>() -1>(s);
+	}
+
+	if (i < size) {
+		const uint32_t n = (uint32_t)(size - i);
+		Reg<T> r;
+		r.loadu_n(&in[i], n);
+		const auto s = OP(Reg<T>(carry), mipp::_scan<T,OP>::apply(r));
+		(EXCL ? mipp::_scan_shift_in(s, carry) : s).storeu_n(&out[i], n);
+	}
+}
+
+// writes 'OP(in[0], ..., in[i])' in 'out[i]' for the 'size' elements of 'in', 'out' can be 'in' (in place scan). The
+// 16-bit and 8-bit additions saturate.
+template <typename T, Red_op<T> OP = mipp::add>
+inline void scan(const T *in, const size_t size, T *out) {
+	if (size == 0)
+		return;
+
+	// the first register has no carry
+	const uint32_t n = (uint32_t)std::min(size, (size_t)N<T>());
+	Reg<T> r;
+	r.loadu_n(in, n);
+	const auto s = mipp::_scan<T,OP>::apply(r);
+	s.storeu_n(out, n);
+	mipp::_scan_carry<T,OP,false>(in + n, size - n, out + n, mipp::extract<T,N<T>() -1>(s));
+}
+
+// writes 'OP(init, in[0], ..., in[i -1])' in 'out[i]' ('init' in 'out[0]'), 'out' can be 'in'
+template <typename T, Red_op<T> OP = mipp::add>
+inline void scan_excl(const T *in, const size_t size, T *out, const T init) {
+	mipp::_scan_carry<T,OP,true>(in, size, out, init);
+}
+
+// returns the sum of the 'a[i] * b[i]', the products are accumulated in 'TA' elements: 'T' by default ('fmadd' on the
+// floating-point types) or 'int32_t' ('uint32_t') for the 'int16_t' and 'int8_t' ('uint16_t' and 'uint8_t') inputs
+// ('dot<int8_t,int32_t>(a, b, n)', it wraps on overflow). 'K' independent accumulators hide the latency of the
+// multiply-add, the tail is loaded with zeros.
+template <typename T, typename TA = T, int K = MIPP_REDUCTION_ACCUMULATORS>
+inline TA dot(const T *a, const T *b, const size_t size) {
+	static_assert(K > 0, "The number of accumulators 'K' has to be greater than 0.");
+#ifndef MIPP_NO_INTRINSICS
+	Reg<TA> acc[K];
+	_unroll<K>::apply([&](const int k) { acc[k] = Reg<TA>((TA)0); });
+
+	const auto step = [&](const int k, const size_t i) {
+		Reg<T> ra, rb;
+		ra.loadu(&a[i]);
+		rb.loadu(&b[i]);
+		acc[k] = Reg<TA>(mipp::_dot_acc<T,TA>::apply(acc[k].r, ra.r, rb.r));
+	};
+
+	size_t i = 0;
+	for (; i + K * N<T>() <= size; i += K * N<T>())
+		_unroll<K>::apply([&](const int k) { step(k, i + k * N<T>()); });
+	for (; i + N<T>() <= size; i += N<T>())
+		step(0, i);
+
+	if (i < size) {
+		Reg<T> ra, rb;
+		ra.loadu_n(&a[i], (uint32_t)(size - i));
+		rb.loadu_n(&b[i], (uint32_t)(size - i));
+		acc[0] = Reg<TA>(mipp::_dot_acc<T,TA>::apply(acc[0].r, ra.r, rb.r));
+	}
+
+	for (auto s = 1; s < K; s *= 2)
+		for (auto k = 0; k + s < K; k += 2 * s)
+			acc[k] += acc[k + s];
+	return acc[0].sum();
+#else
+	TA acc = (TA)0;
+	for (size_t i = 0; i < size; i++)
+		acc += (TA)a[i] * (TA)b[i];
+	return acc;
+#endif
+}
+
+// 's + x' in 's' and its rounding error in 'e' (Knuth's TwoSum)
+template <typename T>
+inline void _two_sum(T &s, T &e, const T x) {
+	const T t = s + x;
+	const T z = t - s;
+	e = (s - (t - z)) + (x - z);
+	s = t;
+}
+
+// compensated dot product (Ogita, Rump and Oishi's 'Dot2'): the rounding errors of the products ('fmsub') and of the
+// sums (TwoSum) are accumulated apart and added at the end, the result is as accurate as if it was computed with twice
+// the precision of 'T'. It requires a strict floating-point model ('-ffast-math' removes the compensation) and the
+// errors of the products are only recovered when 'fmsub' is a hardware FMA.
+template <typename T, int K = MIPP_REDUCTION_ACCUMULATORS>
+inline T dot_kahan(const T *a, const T *b, const size_t size) {
+	static_assert(std::is_floating_point<T>::value, "'dot_kahan' requires a floating-point type.");
+	static_assert(K > 0, "The number of accumulators 'K' has to be greater than 0.");
+
+	Reg<T> sum[K], err[K];
+	_unroll<K>::apply([&](const int k) { sum[k] = Reg<T>((T)0); err[k] = Reg<T>((T)0); });
+
+	const auto step = [&](const int k, const Reg<T> ra, const Reg<T> rb) {
+		const auto p = ra * rb;
+		const auto t = sum[k] + p;
+		const auto z = t - sum[k];
+		err[k] += ((sum[k] - (t - z)) + (p - z)) + mipp::fmsub(ra, rb, p);
+		sum[k] = t;
+	};
+
+	const auto load_step = [&](const int k, const size_t i) {
+		Reg<T> ra, rb;
+		ra.loadu(&a[i]);
+		rb.loadu(&b[i]);
+		step(k, ra, rb);
+	};
+
+	size_t i = 0;
+	for (; i + K * N<T>() <= size; i += K * N<T>())
+		_unroll<K>::apply([&](const int k) { load_step(k, i + k * N<T>()); });
+	for (; i + N<T>() <= size; i += N<T>())
+		load_step(0, i);
+
+	if (i < size) {
+		Reg<T> ra, rb;
+		ra.loadu_n(&a[i], (uint32_t)(size - i));
+		rb.loadu_n(&b[i], (uint32_t)(size - i));
+		step(0, ra, rb);
+	}
+
+	// the elements of the accumulators are summed with the same error-free transformation
+	T s[K * N<T>()], e[K * N<T>()];
+	_unroll<K>::apply([&](const int k) { sum[k].storeu(&s[k * N<T>()]); err[k].storeu(&e[k * N<T>()]); });
+	T res = (T)0, comp = (T)0;
+	for (auto j = 0; j < K * N<T>(); j++) {
+		T ej;
+		mipp::_two_sum(res, ej, s[j]);
+		comp += ej + e[j];
+	}
+	return res + comp;
+}
@@ -0,0 +1,81 @@
+/*
+ * mipp_parallel.h
+ *
+ * Multithreaded versions of the MIPP array functions. They are kept out of "mipp.h" because they need '<thread>' and
+ * the threads library at the link time ('-pthread', or 'Threads::Threads' with CMake).
+ */
+
+#ifndef MIPP_PARALLEL_H_
+#define MIPP_PARALLEL_H_
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "mipp.h"
+
+namespace mipp
+{
+inline namespace MIPP_ISA_NAMESPACE
+{
+// calls 'f(0)', ..., 'f(n -1)' in 'n' threads (the calling thread runs 'f(0)')
+template <class F>
+inline void _parallel_for(const size_t n, F f) {
+	std::vector<std::thread> threads;
+	for (size_t t = 1; t < n; t++)
+		threads.emplace_back(f, t);
+	f(0);
+	for (auto &t : threads)
+		t.join();
+}
+
+// two passes over 'in': the chunks are reduced in parallel, then the reductions of the previous chunks are combined
+// sequentially and each chunk is scanned in parallel with its carry
+template <typename T, Red_op<T> OP, bool EXCL>
+inline void _scan_mt(const T *in, const size_t size, T *out, const T init, const size_t nThreads) {
+	// the chunks start on a register boundary
+	const size_t nThr = std::max(nThreads, (size_t)1);
+	const size_t chunk = (((size + nThr -1) / nThr + N<T>() -1) / N<T>()) * N<T>();
+	const size_t nChunks = chunk ? (size + chunk -1) / chunk : 0;
+
+	if (nChunks <= 1) {
+		if (EXCL) mipp::scan_excl<T,OP>(in, size, out, init);
+		else      mipp::scan     <T,OP>(in, size, out);
+		return;
+	}
+
+	std::vector<T> red(nChunks -1);
+	mipp::_parallel_for(nChunks -1, [&](const size_t c) {
+		red[c] = Reduction<T,OP>::apply(&in[c * chunk], chunk);
+	});
+
+	std::vector<T> carries(nChunks);
+	carries[0] = init;
+	carries[1] = EXCL ? mipp::extract<T,0>(OP(Reg<T>(init), Reg<T>(red[0]))) : red[0];
+	for (size_t c = 2; c < nChunks; c++)
+		carries[c] = mipp::extract<T,0>(OP(Reg<T>(carries[c -1]), Reg<T>(red[c -1])));
+
+	mipp::_parallel_for(nChunks, [&](const size_t c) {
+		const size_t b = c * chunk;
+		const size_t n = std::min(chunk, size - b);
+		if (c == 0 && !EXCL)
+			mipp::scan<T,OP>(in, n, out);
+		else
+			mipp::_scan_carry<T,OP,EXCL>(&in[b], n, &out[b], carries[c]);
+	});
+}
+
+// multithreaded versions, worth it on arrays that do not fit in the caches
+template <typename T, Red_op<T> OP = mipp::add>
+inline void scan(const T *in, const size_t size, T *out, const size_t nThreads) {
+	mipp::_scan_mt<T,OP,false>(in, size, out, T(), nThreads);
+}
+
+template <typename T, Red_op<T> OP = mipp::add>
+inline void scan_excl(const T *in, const size_t size, T *out, const T init, const size_t nThreads) {
+	mipp::_scan_mt<T,OP,true>(in, size, out, init, nThreads);
+}
+} // inline namespace MIPP_ISA_NAMESPACE
+}
+
+#endif /* MIPP_PARALLEL_H_ */
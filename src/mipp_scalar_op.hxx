@@ -11,10 +11,14 @@ namespace mipp_scop
 template <typename T> inline T       add(const T       val1, const T       val2) { return val1 + val2; }
 template <          > inline int16_t add(const int16_t val1, const int16_t val2) { return (int16_t)std::min(std::max((int32_t)((int32_t)val1 + (int32_t)val2),(int32_t)std::numeric_limits<int16_t>::min()),(int32_t)std::numeric_limits<int16_t>::max()); }
 template <          > inline int8_t  add(const int8_t  val1, const int8_t  val2) { return (int8_t )std::min(std::max((int16_t)((int16_t)val1 + (int16_t)val2),(int16_t)std::numeric_limits<int8_t >::min()),(int16_t)std::numeric_limits<int8_t >::max()); }
+template <          > inline uint16_t add(const uint16_t val1, const uint16_t val2) { return (uint16_t)std::min((uint32_t)((uint32_t)val1 + (uint32_t)val2),(uint32_t)std::numeric_limits<uint16_t>::max()); }
+template <          > inline uint8_t  add(const uint8_t  val1, const uint8_t  val2) { return (uint8_t )std::min((uint16_t)((uint16_t)val1 + (uint16_t)val2),(uint16_t)std::numeric_limits<uint8_t >::max()); }
 
 template <typename T> inline T       sub(const T       val1, const T       val2) { return val1 - val2; }
 template <          > inline int16_t sub(const int16_t val1, const int16_t val2) { return (int16_t)std::min(std::max((int32_t)((int32_t)val1 - (int32_t)val2),(int32_t)std::numeric_limits<int16_t>::min()),(int32_t)std::numeric_limits<int16_t>::max()); }
 template <          > inline int8_t  sub(const int8_t  val1, const int8_t  val2) { return (int8_t )std::min(std::max((int16_t)((int16_t)val1 - (int16_t)val2),(int16_t)std::numeric_limits<int8_t >::min()),(int16_t)std::numeric_limits<int8_t >::max()); }
+template <          > inline uint16_t sub(const uint16_t val1, const uint16_t val2) { return val1 > val2 ? (uint16_t)(val1 - val2) : (uint16_t)0; }
+template <          > inline uint8_t  sub(const uint8_t  val1, const uint8_t  val2) { return val1 > val2 ? (uint8_t )(val1 - val2) : (uint8_t )0; }
 
 template <typename T> inline T      andb(const T      val1, const T      val2) { return                                          val1  &                      val2;   }
 template <          > inline double andb(const double val1, const double val2) { return static_cast<double>(static_cast<int64_t>(val1) & static_cast<int64_t>(val2)); }
@@ -37,12 +41,20 @@ template <          > inline int64_t div2(const int64_t val) { return val >> 1;
 template <          > inline int32_t div2(const int32_t val) { return val >> 1;     }
 template <          > inline int16_t div2(const int16_t val) { return val >> 1;     }
 template <          > inline int8_t  div2(const int8_t  val) { return val >> 1;     }
+template <          > inline uint64_t div2(const uint64_t val) { return val >> 1;  }
+template <          > inline uint32_t div2(const uint32_t val) { return val >> 1;  }
+template <          > inline uint16_t div2(const uint16_t val) { return val >> 1;  }
+template <          > inline uint8_t  div2(const uint8_t  val) { return val >> 1;  }
 
 template <typename T> inline T       div4(const T       val) { return val * (T)0.25; }
 template <          > inline int64_t div4(const int64_t val) { return val >> 2;      }
 template <          > inline int32_t div4(const int32_t val) { return val >> 2;      }
 template <          > inline int16_t div4(const int16_t val) { return val >> 2;      }
 template <          > inline int8_t  div4(const int8_t  val) { return val >> 2;      }
+template <          > inline uint64_t div4(const uint64_t val) { return val >> 2;  }
+template <          > inline uint32_t div4(const uint32_t val) { return val >> 2;  }
+template <          > inline uint16_t div4(const uint16_t val) { return val >> 2;  }
+template <          > inline uint8_t  div4(const uint8_t  val) { return val >> 2;  }
 
 template <typename T> inline T       lshift(const T       val, const int n) { return                                            val  << n;  }
 template <          > inline double  lshift(const double  val, const int n) { return static_cast<double >(static_cast<uint64_t>(val) << n); }
@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/src/arithmetic_operations/abs.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/abs.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/abs.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/add.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/add.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/add.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/cdiv.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cdiv.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cdiv.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/cmul.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmul.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmul.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/cmulconj.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmulconj.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmulconj.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/conj.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/conj.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/conj.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/cvt.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cvt.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/cvt.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/div.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/div2.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div2.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div2.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/div4.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div4.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/div4.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/fmadd.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmadd.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmadd.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/fmsub.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmsub.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmsub.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/fnmadd.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmadd.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmadd.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/fnmsub.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmsub.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmsub.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/max.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/max.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/max.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/min.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/min.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/min.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/mul.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/mul.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/mul.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/neg.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/neg.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/neg.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/norm.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/norm.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/norm.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/pack.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/pack.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/pack.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/round.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/round.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/round.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/rsqrt.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/rsqrt.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/rsqrt.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/sat.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sat.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sat.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/sign.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sign.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sign.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/sqrt.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sqrt.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sqrt.cpp.o.d"
+  "/root/repo/tests/src/arithmetic_operations/sub.cpp" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sub.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/arithmetic_operations/sub.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/andb.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/andb.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/andb.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/andnb.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/andnb.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/andnb.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/lshift.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/lshift.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/lshift.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/lshiftr.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/lshiftr.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/lshiftr.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/notb.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/notb.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/notb.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/orb.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/orb.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/orb.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/rshift.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/rshift.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/rshift.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/rshiftr.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/rshiftr.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/rshiftr.cpp.o.d"
+  "/root/repo/tests/src/bitwise_operations/xorb.cpp" "CMakeFiles/run_tests.dir/src/bitwise_operations/xorb.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/bitwise_operations/xorb.cpp.o.d"
+  "/root/repo/tests/src/dispatch/dispatch.cpp" "CMakeFiles/run_tests.dir/src/dispatch/dispatch.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/dispatch/dispatch.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmpeq.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpeq.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpeq.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmpge.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpge.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpge.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmpgt.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpgt.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpgt.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmple.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmple.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmple.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmplt.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmplt.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmplt.cpp.o.d"
+  "/root/repo/tests/src/logical_comparisons/cmpneq.cpp" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpneq.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpneq.cpp.o.d"
+  "/root/repo/tests/src/main.cpp" "CMakeFiles/run_tests.dir/src/main.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/main.cpp.o.d"
+  "/root/repo/tests/src/math_functions/cos.cpp" "CMakeFiles/run_tests.dir/src/math_functions/cos.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/math_functions/cos.cpp.o.d"
+  "/root/repo/tests/src/math_functions/exp.cpp" "CMakeFiles/run_tests.dir/src/math_functions/exp.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/math_functions/exp.cpp.o.d"
+  "/root/repo/tests/src/math_functions/log.cpp" "CMakeFiles/run_tests.dir/src/math_functions/log.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/math_functions/log.cpp.o.d"
+  "/root/repo/tests/src/math_functions/sin.cpp" "CMakeFiles/run_tests.dir/src/math_functions/sin.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/math_functions/sin.cpp.o.d"
+  "/root/repo/tests/src/math_functions/sincos.cpp" "CMakeFiles/run_tests.dir/src/math_functions/sincos.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/math_functions/sincos.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/blend.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/blend.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/blend.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/combine.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/combine.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/combine.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/deinterleave.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/deinterleave.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/deinterleave.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/high.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/high.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/high.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/interleave.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/interleave.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/interleave.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/interleavehi.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/interleavehi.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/interleavehi.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/interleavelo.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/interleavelo.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/interleavelo.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/load.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/load.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/load.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/load_n.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/load_n.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/load_n.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/low.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/low.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/low.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/lrot.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/lrot.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/lrot.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/mask_n.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/mask_n.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/mask_n.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/rrot.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/rrot.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/rrot.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/set.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/set.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/set.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/shuff.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/shuff.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/shuff.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/store.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/store.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/store.cpp.o.d"
+  "/root/repo/tests/src/memory_operations/store_n.cpp" "CMakeFiles/run_tests.dir/src/memory_operations/store_n.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/memory_operations/store_n.cpp.o.d"
+  "/root/repo/tests/src/reductions/hadd.cpp" "CMakeFiles/run_tests.dir/src/reductions/hadd.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/reductions/hadd.cpp.o.d"
+  "/root/repo/tests/src/reductions/hmax.cpp" "CMakeFiles/run_tests.dir/src/reductions/hmax.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/reductions/hmax.cpp.o.d"
+  "/root/repo/tests/src/reductions/hmin.cpp" "CMakeFiles/run_tests.dir/src/reductions/hmin.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/reductions/hmin.cpp.o.d"
+  "/root/repo/tests/src/reductions/hmul.cpp" "CMakeFiles/run_tests.dir/src/reductions/hmul.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/reductions/hmul.cpp.o.d"
+  "/root/repo/tests/src/reductions/testz.cpp" "CMakeFiles/run_tests.dir/src/reductions/testz.cpp.o" "gcc" "CMakeFiles/run_tests.dir/src/reductions/testz.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
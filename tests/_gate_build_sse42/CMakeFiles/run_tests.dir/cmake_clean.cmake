@@ -0,0 +1,153 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/abs.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/abs.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/add.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/add.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cdiv.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cdiv.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmul.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmul.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmulconj.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cmulconj.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/conj.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/conj.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cvt.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/cvt.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div2.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div2.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div4.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/div4.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmadd.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmadd.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmsub.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fmsub.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmadd.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmadd.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmsub.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/fnmsub.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/max.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/max.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/min.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/min.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/mul.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/mul.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/neg.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/neg.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/norm.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/norm.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/pack.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/pack.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/round.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/round.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/rsqrt.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/rsqrt.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sat.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sat.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sign.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sign.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sqrt.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sqrt.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sub.cpp.o"
+  "CMakeFiles/run_tests.dir/src/arithmetic_operations/sub.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/andb.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/andb.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/andnb.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/andnb.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/lshift.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/lshift.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/lshiftr.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/lshiftr.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/notb.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/notb.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/orb.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/orb.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/rshift.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/rshift.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/rshiftr.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/rshiftr.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/xorb.cpp.o"
+  "CMakeFiles/run_tests.dir/src/bitwise_operations/xorb.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/dispatch/dispatch.cpp.o"
+  "CMakeFiles/run_tests.dir/src/dispatch/dispatch.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpeq.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpeq.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpge.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpge.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpgt.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpgt.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmple.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmple.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmplt.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmplt.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpneq.cpp.o"
+  "CMakeFiles/run_tests.dir/src/logical_comparisons/cmpneq.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/main.cpp.o"
+  "CMakeFiles/run_tests.dir/src/main.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/math_functions/cos.cpp.o"
+  "CMakeFiles/run_tests.dir/src/math_functions/cos.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/math_functions/exp.cpp.o"
+  "CMakeFiles/run_tests.dir/src/math_functions/exp.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/math_functions/log.cpp.o"
+  "CMakeFiles/run_tests.dir/src/math_functions/log.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/math_functions/sin.cpp.o"
+  "CMakeFiles/run_tests.dir/src/math_functions/sin.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/math_functions/sincos.cpp.o"
+  "CMakeFiles/run_tests.dir/src/math_functions/sincos.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/blend.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/blend.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/combine.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/combine.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/deinterleave.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/deinterleave.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/gather.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/gather.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/high.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/high.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleave.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleave.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleavehi.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleavehi.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleavelo.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/interleavelo.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/load.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/load.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/load_n.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/load_n.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/low.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/low.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/lrot.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/lrot.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/mask_n.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/mask_n.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/rrot.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/rrot.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/scatter.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/scatter.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/set.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/set.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/shuff.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/shuff.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/store.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/store.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/memory_operations/store_n.cpp.o"
+  "CMakeFiles/run_tests.dir/src/memory_operations/store_n.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/reductions/hadd.cpp.o"
+  "CMakeFiles/run_tests.dir/src/reductions/hadd.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/reductions/hmax.cpp.o"
+  "CMakeFiles/run_tests.dir/src/reductions/hmax.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/reductions/hmin.cpp.o"
+  "CMakeFiles/run_tests.dir/src/reductions/hmin.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/reductions/hmul.cpp.o"
+  "CMakeFiles/run_tests.dir/src/reductions/hmul.cpp.o.d"
+  "CMakeFiles/run_tests.dir/src/reductions/testz.cpp.o"
+  "CMakeFiles/run_tests.dir/src/reductions/testz.cpp.o.d"
+  "bin/run_tests"
+  "bin/run_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -6,12 +6,17 @@
 #include <mipp.h>
 #include <catch.hpp>
 
+#include "../test_data.hpp"
+
 template <typename T>
 void test_reg_add()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -24,6 +29,8 @@ void test_reg_add()
 	for (auto i = 0; i < mipp::N<T>(); i++)
 	{
 		T res = inputs1[i] + inputs2[i];
+		if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+			res = std::numeric_limits<T>::max();
 		REQUIRE(mipp::get<T>(r3, i) == res);
 	}
 }
@@ -39,12 +46,16 @@ TEST_CASE("Addition - mipp::reg", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_add<uint8_t>(); }
 #endif
 }
 #endif
@@ -53,8 +64,11 @@ template <typename T>
 void test_Reg_add()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -67,6 +81,8 @@ void test_Reg_add()
 	for (auto i = 0; i < mipp::N<T>(); i++)
 	{
 		T res = inputs1[i] + inputs2[i];
+		if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+			res = std::numeric_limits<T>::max();
 		REQUIRE(r3[i] == res);
 	}
 }
@@ -81,12 +97,16 @@ TEST_CASE("Addition - mipp::Reg", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_add<uint8_t>(); }
 #endif
 }
 
@@ -95,8 +115,11 @@ void test_reg_maskz_add()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -118,6 +141,8 @@ void test_reg_maskz_add()
 		if (mask[i])
 		{
 			T res = inputs1[i] + inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+				res = std::numeric_limits<T>::max();
 			REQUIRE(mipp::get<T>(r3, i) == res);
 		}
 		else
@@ -136,12 +161,16 @@ TEST_CASE("Addition - mipp::reg - maskz", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_maskz_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_maskz_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_maskz_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_maskz_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_maskz_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_maskz_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_maskz_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_maskz_add<uint8_t>(); }
 #endif
 }
 #endif
@@ -151,8 +180,11 @@ void test_Reg_maskz_add()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -174,6 +206,8 @@ void test_Reg_maskz_add()
 		if (mask[i])
 		{
 			T res = inputs1[i] + inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+				res = std::numeric_limits<T>::max();
 			REQUIRE(r3[i] == res);
 		}
 		else
@@ -191,12 +225,16 @@ TEST_CASE("Addition - mipp::Reg - maskz", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_maskz_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_maskz_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_maskz_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_maskz_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_maskz_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_maskz_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_maskz_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_maskz_add<uint8_t>(); }
 #endif
 }
 
@@ -205,8 +243,11 @@ void test_reg_mask_add()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -230,6 +271,8 @@ void test_reg_mask_add()
 		if (mask[i])
 		{
 			T res = inputs1[i] + inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+				res = std::numeric_limits<T>::max();
 			REQUIRE(mipp::get<T>(r4, i) == res);
 		}
 		else
@@ -248,12 +291,16 @@ TEST_CASE("Addition - mipp::reg - mask", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_mask_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_mask_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_mask_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_mask_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_mask_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_mask_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_mask_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_mask_add<uint8_t>(); }
 #endif
 }
 #endif
@@ -263,8 +310,11 @@ void test_Reg_mask_add()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -288,6 +338,8 @@ void test_Reg_mask_add()
 		if (mask[i])
 		{
 			T res = inputs1[i] + inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && res < inputs1[i]) // saturation
+				res = std::numeric_limits<T>::max();
 			REQUIRE(r4[i] == res);
 		}
 		else
@@ -305,11 +357,15 @@ TEST_CASE("Addition - mipp::Reg - mask", "[mipp::add]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_mask_add<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_mask_add<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_mask_add<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_mask_add<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_mask_add<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_mask_add<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_mask_add<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_mask_add<uint8_t>(); }
 #endif
 }
\ No newline at end of file
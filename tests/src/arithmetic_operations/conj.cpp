@@ -6,12 +6,14 @@
 #include <mipp.h>
 #include <catch.hpp>
 
+#include "../test_data.hpp"
+
 template <typename T>
 void test_reg_conj()
 {
 	T inputs1[2*mipp::N<T>()];
 
-	std::iota(inputs1, inputs1 + 2*mipp::N<T>(), (T)0);
+	iota_mod(inputs1, 2*mipp::N<T>(), (T)0);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + 2*mipp::N<T>(), g);
@@ -58,7 +60,7 @@ void test_Reg_conj()
 {
 	T inputs1[2*mipp::N<T>()];
 
-	std::iota(inputs1, inputs1 + 2*mipp::N<T>(), (T)0);
+	iota_mod(inputs1, 2*mipp::N<T>(), (T)0);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + 2*mipp::N<T>(), g);
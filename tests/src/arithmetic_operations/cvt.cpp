@@ -46,10 +46,13 @@ TEST_CASE("Convert - mipp::reg", "[mipp::cvt]")
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int32_t -> int64_t") { test_reg_cvt<int32_t,int64_t>(); }
+	SECTION("datatype = uint32_t -> uint64_t") { test_reg_cvt<uint32_t,uint64_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t -> int32_t") { test_reg_cvt<int16_t,int32_t>(); }
+	SECTION("datatype = uint16_t -> uint32_t") { test_reg_cvt<uint16_t,uint32_t>(); }
 	SECTION("datatype = int8_t -> int16_t") { test_reg_cvt<int8_t,int16_t>(); }
+	SECTION("datatype = uint8_t -> uint16_t") { test_reg_cvt<uint8_t,uint16_t>(); }
 #endif
 #endif
 #endif
@@ -95,10 +98,13 @@ TEST_CASE("Convert - mipp::Reg", "[mipp::cvt]")
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int32_t -> int64_t") { test_Reg_cvt<int32_t,int64_t>(); }
+	SECTION("datatype = uint32_t -> uint64_t") { test_Reg_cvt<uint32_t,uint64_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t -> int32_t") { test_Reg_cvt<int16_t,int32_t>(); }
+	SECTION("datatype = uint16_t -> uint32_t") { test_Reg_cvt<uint16_t,uint32_t>(); }
 	SECTION("datatype = int8_t -> int16_t") { test_Reg_cvt<int8_t,int16_t>(); }
+	SECTION("datatype = uint8_t -> uint16_t") { test_Reg_cvt<uint8_t,uint16_t>(); }
 #endif
 #endif
 #endif
@@ -0,0 +1,91 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_expr()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-10, 10);
+
+	for (size_t n = 0; n <= (size_t)(3 * N + 1); n++)
+	{
+		mipp::vector<T> x(n), y(n), z(n + 1);
+		std::vector<T> w(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			x[i] = (T)dis(g);
+			w[i] = (T)dis(g);
+		}
+		const T a = (T)3, b = (T)-2;
+
+		namespace ex = mipp::expr;
+		ex::wrap(y) = a * ex::wrap(x) + b;
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == Approx(a * x[i] + b));
+
+		// the output is also an input
+		ex::wrap(y) = ex::wrap(w) - ex::wrap(y) * ex::wrap(x) + ex::max(ex::wrap(x), ex::wrap(w));
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == Approx(w[i] - (a * x[i] + b) * x[i] + std::max(x[i], w[i])));
+
+		const auto e = -ex::wrap(x) / (T)2 + ex::abs(ex::wrap(w));
+		ex::wrap(y) = e;
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == Approx(-x[i] / (T)2 + std::abs(w[i])));
+
+		T ref = (T)0;
+		for (size_t i = 0; i < n; i++)
+			ref += x[i] * w[i] + (T)1;
+		REQUIRE(ex::sum(ex::wrap(x) * ex::wrap(w) + (T)1) == Approx(ref));
+
+		ex::wrap(y) = (T)7;
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == (T)7);
+
+		REQUIRE_THROWS_AS(ex::wrap(z) = ex::wrap(x) + ex::wrap(y), std::runtime_error);
+	}
+}
+
+TEST_CASE("Expression templates - mipp::expr", "[mipp::expr]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_expr<double>(); }
+#endif
+	SECTION("datatype = float") { test_expr<float>(); }
+}
+
+template <typename T>
+void test_expr_int()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-100, 100);
+
+	for (size_t n = 0; n <= (size_t)(3 * N + 1); n++)
+	{
+		std::vector<T> x(n), y(n);
+		for (size_t i = 0; i < n; i++)
+			x[i] = (T)dis(g);
+
+		namespace ex = mipp::expr;
+		ex::wrap(y) = (T)3 * ex::wrap(x) + (T)1 - ex::min(ex::wrap(x), (T)0);
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == (T)((T)3 * x[i] + (T)1 - std::min(x[i], (T)0)));
+		REQUIRE(ex::sum(ex::wrap(x) + (T)1) == std::accumulate(x.begin(), x.end(), (T)n));
+	}
+}
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+TEST_CASE("Expression templates (integers) - mipp::expr", "[mipp::expr]")
+{
+	SECTION("datatype = int32_t") { test_expr_int<int32_t>(); }
+}
+#endif
+#endif
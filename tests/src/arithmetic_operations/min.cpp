@@ -10,8 +10,10 @@ template <typename T>
 void test_reg_min()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -39,17 +41,21 @@ TEST_CASE("Minimum - mipp::reg", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_reg_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_reg_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_reg_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_reg_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -59,8 +65,10 @@ template <typename T>
 void test_Reg_min()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -87,17 +95,21 @@ TEST_CASE("Minimum - mipp::Reg", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_Reg_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_Reg_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_Reg_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_Reg_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -107,8 +119,10 @@ void test_reg_maskz_min()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -148,17 +162,21 @@ TEST_CASE("Minimum - mipp::reg - maskz", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_reg_maskz_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_maskz_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_reg_maskz_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_reg_maskz_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_maskz_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_maskz_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_reg_maskz_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_maskz_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -169,8 +187,10 @@ void test_Reg_maskz_min()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -209,17 +229,21 @@ TEST_CASE("Minimum - mipp::Reg - maskz", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_Reg_maskz_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_maskz_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_Reg_maskz_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_Reg_maskz_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_maskz_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_maskz_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_Reg_maskz_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_maskz_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -229,8 +253,10 @@ void test_reg_mask_min()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -272,17 +298,21 @@ TEST_CASE("Minimum - mipp::reg - mask", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_reg_mask_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_mask_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_reg_mask_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_reg_mask_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_mask_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_mask_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_reg_mask_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_mask_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -293,8 +323,10 @@ void test_Reg_mask_min()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -335,17 +367,21 @@ TEST_CASE("Minimum - mipp::Reg - mask", "[mipp::min]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_Reg_mask_min<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_mask_min<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_Reg_mask_min<int32_t>(); }
 #endif
+	SECTION("datatype = uint32_t") { test_Reg_mask_min<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_mask_min<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_mask_min<uint16_t>(); }
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int8_t") { test_Reg_mask_min<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_mask_min<uint8_t>(); }
 #endif
 #endif
 }
@@ -49,6 +49,10 @@ TEST_CASE("Pack - mipp::reg", "[mipp::pack]")
 #if defined(MIPP_BW)
 	SECTION("datatype = int32_t -> int16_t") { test_reg_pack<int32_t,int16_t>(); }
 	SECTION("datatype = int16_t -> int8_t") { test_reg_pack<int16_t,int8_t>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = uint32_t -> uint16_t") { test_reg_pack<uint32_t,uint16_t>(); }
+	SECTION("datatype = uint16_t -> uint8_t") { test_reg_pack<uint16_t,uint8_t>(); }
+#endif
 #endif
 }
 #endif
@@ -96,6 +100,10 @@ TEST_CASE("Pack - mipp::Reg", "[mipp::pack]")
 #if defined(MIPP_BW)
 	SECTION("datatype = int32_t -> int16_t") { test_Reg_pack<int32_t,int16_t>(); }
 	SECTION("datatype = int16_t -> int8_t") { test_Reg_pack<int16_t,int8_t>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = uint32_t -> uint16_t") { test_Reg_pack<uint32_t,uint16_t>(); }
+	SECTION("datatype = uint16_t -> uint8_t") { test_Reg_pack<uint16_t,uint8_t>(); }
+#endif
 #endif
 }
 #endif
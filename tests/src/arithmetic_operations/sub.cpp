@@ -6,12 +6,17 @@
 #include <mipp.h>
 #include <catch.hpp>
 
+#include "../test_data.hpp"
+
 template <typename T>
 void test_reg_sub()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -24,6 +29,8 @@ void test_reg_sub()
 	for (auto i = 0; i < mipp::N<T>(); i++)
 	{
 		T res = inputs1[i] - inputs2[i];
+		if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+			res = (T)0;
 		REQUIRE(mipp::get<T>(r3, i) == res);
 	}
 }
@@ -39,12 +46,16 @@ TEST_CASE("Subtraction - mipp::reg", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_sub<uint8_t>(); }
 #endif
 }
 #endif
@@ -53,8 +64,11 @@ template <typename T>
 void test_Reg_sub()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -67,6 +81,8 @@ void test_Reg_sub()
 	for (auto i = 0; i < mipp::N<T>(); i++)
 	{
 		T res = inputs1[i] - inputs2[i];
+		if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+			res = (T)0;
 		REQUIRE(r3[i] == res);
 	}
 }
@@ -81,12 +97,16 @@ TEST_CASE("Subtraction - mipp::Reg", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_sub<uint8_t>(); }
 #endif
 }
 
@@ -95,8 +115,11 @@ void test_reg_maskz_sub()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -118,6 +141,8 @@ void test_reg_maskz_sub()
 		if (mask[i])
 		{
 			T res = inputs1[i] - inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+				res = (T)0;
 			REQUIRE(mipp::get<T>(r3, i) == res);
 		}
 		else
@@ -136,12 +161,16 @@ TEST_CASE("Subtraction - mipp::reg - maskz", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_maskz_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_maskz_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_maskz_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_maskz_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_maskz_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_maskz_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_maskz_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_maskz_sub<uint8_t>(); }
 #endif
 }
 #endif
@@ -151,8 +180,11 @@ void test_Reg_maskz_sub()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 
 	bool mask[N];
 	std::fill(mask,       mask + N/2, true );
@@ -174,6 +206,8 @@ void test_Reg_maskz_sub()
 		if (mask[i])
 		{
 			T res = inputs1[i] - inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+				res = (T)0;
 			REQUIRE(r3[i] == res);
 		}
 		else
@@ -191,12 +225,16 @@ TEST_CASE("Subtraction - mipp::Reg - maskz", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_maskz_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_maskz_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_maskz_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_maskz_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_maskz_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_maskz_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_maskz_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_maskz_sub<uint8_t>(); }
 #endif
 }
 
@@ -205,8 +243,11 @@ void test_reg_mask_sub()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -230,6 +271,8 @@ void test_reg_mask_sub()
 		if (mask[i])
 		{
 			T res = inputs1[i] - inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+				res = (T)0;
 			REQUIRE(mipp::get<T>(r4, i) == res);
 		}
 		else
@@ -248,12 +291,16 @@ TEST_CASE("Subtraction - mipp::reg - mask", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_mask_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_mask_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_reg_mask_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_mask_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_mask_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_mask_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_mask_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_mask_sub<uint8_t>(); }
 #endif
 }
 #endif
@@ -263,8 +310,11 @@ void test_Reg_mask_sub()
 {
 	constexpr int N = mipp::N<T>();
 	T inputs1[N], inputs2[N], inputs3[N];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	constexpr int M = mipp::N<T>() < 63 ? mipp::N<T>() : 63;
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - M / 2) : (T)1;
+	iota_mod(inputs1, mipp::N<T>(), first, 63);
+	iota_mod(inputs2, mipp::N<T>(), first, 63);
 	std::iota(inputs3, inputs3 + mipp::N<T>(), (T)0);
 
 	bool mask[N];
@@ -288,6 +338,8 @@ void test_Reg_mask_sub()
 		if (mask[i])
 		{
 			T res = inputs1[i] - inputs2[i];
+			if (std::is_unsigned<T>::value && sizeof(T) <= 2 && inputs1[i] < inputs2[i]) // saturation
+				res = (T)0;
 			REQUIRE(r4[i] == res);
 		}
 		else
@@ -305,11 +357,15 @@ TEST_CASE("Subtraction - mipp::Reg - mask", "[mipp::sub]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_mask_sub<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_mask_sub<uint64_t>(); }
 #endif
 	SECTION("datatype = int32_t") { test_Reg_mask_sub<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_mask_sub<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_mask_sub<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_mask_sub<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_mask_sub<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_mask_sub<uint8_t>(); }
 #endif
 }
\ No newline at end of file
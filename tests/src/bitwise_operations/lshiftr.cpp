@@ -6,13 +6,15 @@
 #include <mipp.h>
 #include <catch.hpp>
 
+#include "../test_data.hpp"
+
 template <typename T>
 void test_reg_lshiftr()
 {
 	T inputs1[mipp::N<T>()];
 	T inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)0);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)0);
+	iota_mod(inputs1, mipp::N<T>(), (T)0);
+	iota_mod(inputs2, mipp::N<T>(), (T)0, (int)sizeof(T) * 8);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -56,8 +58,8 @@ void test_Reg_lshiftr()
 {
 	T inputs1[mipp::N<T>()];
 	T inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)0);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)0);
+	iota_mod(inputs1, mipp::N<T>(), (T)0);
+	iota_mod(inputs2, mipp::N<T>(), (T)0, (int)sizeof(T) * 8);
 
 	std::mt19937 g;
 	std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -6,6 +6,8 @@
 #include <mipp.h>
 #include <catch.hpp>
 
+#include "../test_data.hpp"
+
 
 template <typename T, int n = (sizeof(T) * 8 -1)>
 struct reg_rshift
@@ -15,7 +17,7 @@ struct reg_rshift
 		reg_rshift<T,n-1>::test();
 
 		T inputs1[mipp::N<T>()];
-		std::iota(inputs1, inputs1 + mipp::N<T>(), std::numeric_limits<T>::max() - (T)mipp::N<T>());
+		iota_mod(inputs1, mipp::N<T>(), std::numeric_limits<T>::max(), 100, -1);
 
 		std::mt19937 g;
 		std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -43,12 +45,16 @@ TEST_CASE("Binary right shift - mipp::reg", "[mipp::rshift]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { reg_rshift<int64_t>::test(); }
+	SECTION("datatype = uint64_t") { reg_rshift<uint64_t>::test(); }
 #endif
 	SECTION("datatype = int32_t") { reg_rshift<int32_t>::test(); }
+	SECTION("datatype = uint32_t") { reg_rshift<uint32_t>::test(); }
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { reg_rshift<int16_t>::test(); }
+	SECTION("datatype = uint16_t") { reg_rshift<uint16_t>::test(); }
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 	SECTION("datatype = int8_t") { reg_rshift<int8_t >::test(); }
+	SECTION("datatype = uint8_t") { reg_rshift<uint8_t>::test(); }
 #endif
 #endif
 #endif
@@ -63,7 +69,7 @@ struct Reg_rshift
 		Reg_rshift<T,n-1>::test();
 
 		T inputs1[mipp::N<T>()];
-		std::iota(inputs1, inputs1 + mipp::N<T>(), std::numeric_limits<T>::max() - (T)mipp::N<T>());
+		iota_mod(inputs1, mipp::N<T>(), std::numeric_limits<T>::max(), 100, -1);
 
 		std::mt19937 g;
 		std::shuffle(inputs1, inputs1 + mipp::N<T>(), g);
@@ -90,12 +96,16 @@ TEST_CASE("Binary right shift - mipp::Reg", "[mipp::rshift]")
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { Reg_rshift<int64_t>::test(); }
+	SECTION("datatype = uint64_t") { Reg_rshift<uint64_t>::test(); }
 #endif
 	SECTION("datatype = int32_t") { Reg_rshift<int32_t>::test(); }
+	SECTION("datatype = uint32_t") { Reg_rshift<uint32_t>::test(); }
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { Reg_rshift<int16_t>::test(); }
+	SECTION("datatype = uint16_t") { Reg_rshift<uint16_t>::test(); }
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 	SECTION("datatype = int8_t") { Reg_rshift<int8_t >::test(); }
+	SECTION("datatype = uint8_t") { Reg_rshift<uint8_t>::test(); }
 #endif
 #endif
 #endif
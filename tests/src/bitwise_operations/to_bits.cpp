@@ -0,0 +1,109 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// random masks, then masks with only one element set, all the elements unset and all the elements set
+template <int N>
+void init_to_bits(bool inputs[N], const int j, std::mt19937 &g)
+{
+	std::uniform_int_distribution<int> dis(0, 1);
+	for (auto i = 0; i < N; i++)
+		switch (j % 4)
+		{
+			case 0:  inputs[i] = dis(g) ? true : false; break;
+			case 1:  inputs[i] = i == (j / 4) % N;      break;
+			case 2:  inputs[i] = false;                 break;
+			default: inputs[i] = true;                  break;
+		}
+}
+
+template <int N>
+void check_to_bits(const bool inputs[N], const uint64_t bits, const uint32_t popcnt, const uint32_t ctz,
+                   const uint32_t clz, const bool any, const bool all)
+{
+	uint64_t ref_bits = 0;
+	uint32_t ref_popcnt = 0, ref_ctz = N, ref_clz = N;
+	for (auto i = 0; i < N; i++)
+		if (inputs[i])
+		{
+			ref_bits |= (uint64_t)1 << i;
+			ref_popcnt++;
+			ref_ctz = std::min(ref_ctz, (uint32_t)i);
+			ref_clz = (uint32_t)(N -1 -i);
+		}
+
+	REQUIRE(bits   == ref_bits                 );
+	REQUIRE(popcnt == ref_popcnt               );
+	REQUIRE(ctz    == ref_ctz                  );
+	REQUIRE(clz    == ref_clz                  );
+	REQUIRE(any    == (ref_popcnt >  0)        );
+	REQUIRE(all    == (ref_popcnt == (uint32_t)N));
+}
+
+template <int N>
+void test_msk_to_bits()
+{
+	bool inputs1[N];
+	std::mt19937 g;
+
+	for (auto j = 0; j < 4 * N + 100; j++)
+	{
+		init_to_bits<N>(inputs1, j, g);
+
+		mipp::msk m1 = mipp::set<N>(inputs1);
+
+		check_to_bits<N>(inputs1, mipp::to_bits<N>(m1), mipp::popcnt<N>(m1), mipp::ctz<N>(m1), mipp::clz<N>(m1),
+		                 mipp::any<N>(m1), mipp::all<N>(m1));
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Mask to bits - mipp::msk", "[mipp::to_bits]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_msk_to_bits<mipp::N<int64_t>()>(); }
+#endif
+	SECTION("datatype = int32_t") { test_msk_to_bits<mipp::N<int32_t>()>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_msk_to_bits<mipp::N<int16_t>()>(); }
+#if !defined(MIPP_EMU) || MIPP_REGISTER_SIZE <= 512 // 128 elements do not fit in the 64-bit integer
+	SECTION("datatype = int8_t") { test_msk_to_bits<mipp::N<int8_t>()>(); }
+#endif
+#endif
+}
+#endif
+
+template <int N>
+void test_Msk_to_bits()
+{
+	bool inputs1[N];
+	std::mt19937 g;
+
+	for (auto j = 0; j < 4 * N + 100; j++)
+	{
+		init_to_bits<N>(inputs1, j, g);
+
+		mipp::Msk<N> m1 = inputs1;
+
+		check_to_bits<N>(inputs1, mipp::to_bits(m1), mipp::popcnt(m1), mipp::ctz(m1), mipp::clz(m1), mipp::any(m1),
+		                 m1.all());
+	}
+}
+
+TEST_CASE("Mask to bits - mipp::Msk", "[mipp::to_bits]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Msk_to_bits<mipp::N<int64_t>()>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Msk_to_bits<mipp::N<int32_t>()>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Msk_to_bits<mipp::N<int16_t>()>(); }
+#if !defined(MIPP_EMU) || MIPP_REGISTER_SIZE <= 512 // 128 elements do not fit in the 64-bit integer
+	SECTION("datatype = int8_t") { test_Msk_to_bits<mipp::N<int8_t>()>(); }
+#endif
+#endif
+}
@@ -0,0 +1,54 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+static int kernel_no    () { return 0; }
+static int kernel_native() { return 1; }
+
+TEST_CASE("Dispatch - ISA detection", "[mipp::dispatch]")
+{
+	// the tests are running on the compilation machine, so the compiled ISA has to be supported
+	REQUIRE(mipp::isa_supported(mipp::CompiledISA));
+	REQUIRE(mipp::isa_supported(mipp::ISA::NO));
+	REQUIRE(mipp::isa_supported(mipp::best_isa()));
+
+	if (std::getenv("MIPP_ISA") == nullptr)
+		REQUIRE((int)mipp::best_isa() >= (int)mipp::CompiledISA);
+
+	REQUIRE(mipp::isa_name(mipp::ISA::AVX2) == "AVX2");
+	REQUIRE(mipp::isa_name(mipp::ISA::SSE4_2) == "SSE4.2");
+}
+
+TEST_CASE("Dispatch - kernel selection", "[mipp::dispatch]")
+{
+	using kern_t = int (*)();
+
+	SECTION("best kernel")
+	{
+		kern_t k = mipp::dispatch<kern_t>({{mipp::ISA::NO, &kernel_no}, {mipp::best_isa(), &kernel_native}});
+		REQUIRE(k() == (mipp::best_isa() == mipp::ISA::NO ? 0 : 1));
+	}
+
+	SECTION("order independent")
+	{
+		kern_t k = mipp::dispatch<kern_t>({{mipp::best_isa(), &kernel_native}, {mipp::ISA::NO, &kernel_no}});
+		REQUIRE(k() == (mipp::best_isa() == mipp::ISA::NO ? 0 : 1));
+	}
+
+	SECTION("unsupported kernels are skipped")
+	{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		const mipp::ISA foreign = mipp::ISA::NEONv2;
+#else
+		const mipp::ISA foreign = mipp::ISA::AVX512BW;
+#endif
+		kern_t k = mipp::dispatch<kern_t>({{foreign, &kernel_native}, {mipp::ISA::NO, &kernel_no}});
+		REQUIRE(k() == 0);
+
+		REQUIRE_THROWS(mipp::dispatch<kern_t>({{foreign, &kernel_native}}));
+	}
+}
@@ -10,8 +10,10 @@ template <typename T>
 void test_reg_cmple()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	for (auto t = 0; t < 100; t++)
@@ -47,13 +49,17 @@ TEST_CASE("Compare lower or equal - mipp::reg", "[mipp::cmple]")
 #if !defined(MIPP_SSE)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_cmple<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_cmple<uint64_t>(); }
 #endif
 #endif
 	SECTION("datatype = int32_t") { test_reg_cmple<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_cmple<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_cmple<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_cmple<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_cmple<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_cmple<uint8_t>(); }
 #endif
 }
 #endif
@@ -62,8 +68,10 @@ template <typename T>
 void test_Reg_cmple()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	for (auto t = 0; t < 100; t++)
@@ -91,12 +99,16 @@ TEST_CASE("Compare lower or equal - mipp::Reg", "[mipp::cmple]")
 #if !defined(MIPP_SSE)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_cmple<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_cmple<uint64_t>(); }
 #endif
 #endif
 	SECTION("datatype = int32_t") { test_Reg_cmple<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_cmple<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_cmple<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_cmple<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_cmple<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_cmple<uint8_t>(); }
 #endif
 }
@@ -10,8 +10,10 @@ template <typename T>
 void test_reg_cmplt()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	for (auto t = 0; t < 100; t++)
@@ -47,13 +49,17 @@ TEST_CASE("Compare lower than - mipp::reg", "[mipp::cmplt]")
 #if !defined(MIPP_SSE)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_reg_cmplt<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_cmplt<uint64_t>(); }
 #endif
 #endif
 	SECTION("datatype = int32_t") { test_reg_cmplt<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_cmplt<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_reg_cmplt<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_cmplt<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_reg_cmplt<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_cmplt<uint8_t>(); }
 #endif
 }
 #endif
@@ -62,8 +68,10 @@ template <typename T>
 void test_Reg_cmplt()
 {
 	T inputs1[mipp::N<T>()], inputs2[mipp::N<T>()];
-	std::iota(inputs1, inputs1 + mipp::N<T>(), (T)1);
-	std::iota(inputs2, inputs2 + mipp::N<T>(), (T)1);
+	// unsigned values around the sign bit to catch the signed instructions
+	const T first = std::is_unsigned<T>::value ? (T)(std::numeric_limits<T>::max() / 2 - mipp::N<T>() / 2) : (T)1;
+	std::iota(inputs1, inputs1 + mipp::N<T>(), first);
+	std::iota(inputs2, inputs2 + mipp::N<T>(), first);
 
 	std::mt19937 g;
 	for (auto t = 0; t < 100; t++)
@@ -91,12 +99,16 @@ TEST_CASE("Compare lower than - mipp::Reg", "[mipp::cmplt]")
 #if !defined(MIPP_SSE)
 #if defined(MIPP_64BIT)
 	SECTION("datatype = int64_t") { test_Reg_cmplt<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_cmplt<uint64_t>(); }
 #endif
 #endif
 	SECTION("datatype = int32_t") { test_Reg_cmplt<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_cmplt<uint32_t>(); }
 #endif
 #if defined(MIPP_BW)
 	SECTION("datatype = int16_t") { test_Reg_cmplt<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_cmplt<uint16_t>(); }
 	SECTION("datatype = int8_t") { test_Reg_cmplt<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_cmplt<uint8_t>(); }
 #endif
 }
@@ -0,0 +1,101 @@
+#include "math_test.hpp"
+
+template <typename T, mipp::Accuracy A>
+void test_special_values()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	REQUIRE(mipp::exp<T,A>(mipp::Reg<T>( inf))[0] == inf);
+	REQUIRE(mipp::exp<T,A>(mipp::Reg<T>(-inf))[0] == (T)0);
+	REQUIRE(std::isnan(mipp::exp<T,A>(mipp::Reg<T>(nan))[0]));
+
+	REQUIRE(mipp::log<T,A>(mipp::Reg<T>( inf))[0] == inf);
+	REQUIRE(mipp::log<T,A>(mipp::Reg<T>((T)0))[0] == -inf);
+	REQUIRE(mipp::log<T,A>(mipp::Reg<T>((T)1))[0] == (T)0);
+	REQUIRE(std::isnan(mipp::log<T,A>(mipp::Reg<T>((T)-1))[0]));
+	REQUIRE(std::isnan(mipp::log<T,A>(mipp::Reg<T>(nan))[0]));
+
+	mipp::Reg<T> s, c;
+	mipp::sincos<T,A>(mipp::Reg<T>((T)0), s, c);
+	REQUIRE(s[0] == (T)0);
+	if (A == mipp::precise)
+	{
+		REQUIRE(c[0] == (T)1);
+		REQUIRE(mipp::exp<T,A>(mipp::Reg<T>((T)0))[0] == (T)1);
+	}
+	mipp::sincos<T,A>(mipp::Reg<T>(-(T)0), s, c);
+	REQUIRE(std::signbit(s[0]));
+	REQUIRE(std::isnan(mipp::sin<T,A>(mipp::Reg<T>(inf))[0]));
+	REQUIRE(std::isnan(mipp::cos<T,A>(mipp::Reg<T>(nan))[0]));
+}
+
+template <typename T>
+void test_tiers(const T sin_range)
+{
+	auto lexp = [](long double x) { return std::exp(x); };
+	auto llog = [](long double x) { return std::log(x); };
+	auto lsin = [](long double x) { return std::sin(x); };
+	auto lcos = [](long double x) { return std::cos(x); };
+
+	const T exp_max = std::log(std::numeric_limits<T>::max()) - (T)1;
+	const T exp_min = std::log(std::numeric_limits<T>::min()) + (T)1;
+
+	// 'precise' is correctly rounded or faithful: 1 ULP at most
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::exp<T,mipp::precise>(x); }, lexp,
+	                 exp_min, exp_max, 1., 0.);
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::log<T,mipp::precise>(x); }, llog,
+	                 std::numeric_limits<T>::min(), (T)8, 1., 0.);
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::sin<T,mipp::precise>(x); }, lsin,
+	                 -sin_range, sin_range, 1., 0.);
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::cos<T,mipp::precise>(x); }, lcos,
+	                 -sin_range, sin_range, 1., 0.);
+
+	// 'fast' is a relative error
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::exp<T,mipp::fast>(x); }, lexp,
+	                 exp_min, exp_max, 0., 2e-4);
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::log<T,mipp::fast>(x); }, llog,
+	                 (T)1e-3, (T)8, 0., 2e-4);
+}
+
+// the absolute error of 'fast' sin and cos, the relative error is unbounded around the zeros
+template <typename T>
+void test_fast_sincos()
+{
+	std::mt19937 g;
+	std::uniform_real_distribution<T> dis((T)-100, (T)100);
+	constexpr int N = mipp::N<T>();
+	T inputs[N];
+	for (auto n = 0; n < 2000; n++)
+	{
+		for (auto i = 0; i < N; i++)
+			inputs[i] = dis(g);
+		mipp::Reg<T> s, c;
+		mipp::sincos<T,mipp::fast>(mipp::Reg<T>(inputs), s, c);
+		for (auto i = 0; i < N; i++)
+		{
+			REQUIRE(std::abs((long double)s[i] - std::sin((long double)inputs[i])) <= 2e-4L);
+			REQUIRE(std::abs((long double)c[i] - std::cos((long double)inputs[i])) <= 2e-4L);
+		}
+	}
+}
+
+TEST_CASE("Accuracy tiers - mipp::Reg", "[mipp::exp][mipp::log][mipp::sin][mipp::cos]")
+{
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") {
+		test_tiers<double>((double)1e6);
+		test_fast_sincos<double>();
+		test_special_values<double,mipp::fast>();
+		test_special_values<double,mipp::precise>();
+	}
+#endif
+#endif
+	SECTION("datatype = float") {
+		test_tiers<float>((float)1e4);
+		test_fast_sincos<float>();
+		test_special_values<float,mipp::fast>();
+		test_special_values<float,mipp::precise>();
+	}
+}
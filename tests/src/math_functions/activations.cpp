@@ -0,0 +1,214 @@
+#include "math_test.hpp"
+
+// the random inputs are checked in ULP ('max_ulp') for 'balanced' and 'precise', in relative error ('eps') for 'fast'
+// ('max_ulp' is 0), the special values are checked with 'eps'
+
+template <typename T, mipp::Accuracy A>
+void test_tanh(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::tanh<T,A>(x); };
+	auto ref = [](long double x) { return std::tanh(x); };
+
+	test_accuracy<T>(f, ref, (T)-5, (T)5, max_ulp, eps);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.3, (T)-0.6, (T)0.7, (T)-2.5, (T)20, (T)-1e4, inf, -inf,
+	                         nan, (T)1.5 }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::tanh<T>(x.r)); }, ref, (T)-5, (T)5, max_ulp, eps);
+#endif
+}
+
+template <typename T, mipp::Accuracy A>
+void test_sigmoid(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::sigmoid<T,A>(x); };
+	auto ref = [](long double x) { return 1 / (1 + std::exp(-x)); };
+
+	test_accuracy<T>(f, ref, (T)-5, (T)5, max_ulp, eps);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.3, (T)-0.6, (T)0.7, (T)-2.5, (T)20, (T)-1e4, inf, -inf,
+	                         nan, (T)1.5 }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::sigmoid<T>(x.r)); }, ref, (T)-5, (T)5, max_ulp, eps);
+#endif
+}
+
+template <typename T, mipp::Accuracy A>
+void test_softplus(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::softplus<T,A>(x); };
+	auto ref = [](long double x) { return std::max(x, 0.L) + std::log1p(std::exp(-std::abs(x))); };
+
+	test_accuracy<T>(f, ref, (T)-5, (T)5, max_ulp, eps);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.3, (T)-0.6, (T)0.7, (T)-2.5, (T)20, (T)-1e4, inf, -inf,
+	                         nan, (T)1.5 }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::softplus<T>(x.r)); }, ref, (T)-5, (T)5, max_ulp, eps);
+#endif
+}
+
+template <typename T, mipp::Accuracy A>
+void test_logaddexp(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto ref = [](long double a, long double b) {
+		return a == b ? a + 0.693147180559945309417L : std::max(a, b) + std::log1p(std::exp(-std::abs(a - b)));
+	};
+
+	test_accuracy<T>([](mipp::Reg<T> a) { return mipp::logaddexp<T,A>(a, mipp::Reg<T>((T)1.5)); },
+	                 [ref](long double a) { return ref(a, (long double)(T)1.5); }, (T)-20, (T)20, max_ulp, eps);
+	// all the pairs of special values (equal arguments, opposite infinities and NaNs)
+	test_values2<T>([](mipp::Reg<T> a, mipp::Reg<T> b) { return mipp::logaddexp<T,A>(a, b); }, ref,
+	                { (T)0, -(T)0, (T)1, (T)-3, (T)30, inf, -inf, nan }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> a) { return mipp::Reg<T>(mipp::logaddexp<T>(a.r, mipp::set1<T>((T)1.5))); },
+		                 [ref](long double a) { return ref(a, (long double)(T)1.5); }, (T)-20, (T)20, max_ulp, eps);
+#endif
+}
+
+template <typename T, mipp::Accuracy A>
+void test_erf(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::erf<T,A>(x); };
+	auto ref = [](long double x) { return std::erf(x); };
+
+	test_accuracy<T>(f, ref, (T)-5, (T)5, max_ulp, eps);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.3, (T)-0.6, (T)0.7, (T)-2.5, (T)4, (T)-1e4, inf, -inf,
+	                         nan, (T)1.5 }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::erf<T>(x.r)); }, ref, (T)-5, (T)5, max_ulp, eps);
+#endif
+}
+
+template <typename T, mipp::Accuracy A>
+void test_erfc(const double max_ulp, const double eps)
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::erfc<T,A>(x); };
+	auto ref = [](long double x) { return std::erfc(x); };
+
+	test_accuracy<T>(f, ref, (T)-5, (T)5, max_ulp, eps);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.3, (T)-0.6, (T)0.7, (T)-2.5, (T)9, (T)-1e4, inf, -inf,
+	                         nan, (T)1.5 }, eps);
+#ifndef MIPP_NO_INTRINSICS
+	if (A == mipp::balanced) // the 'mipp::reg' interface
+		test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::erfc<T>(x.r)); }, ref, (T)-5, (T)5, max_ulp, eps);
+#endif
+}
+
+TEST_CASE("Hyperbolic tangent - mipp::Reg", "[mipp::tanh]")
+{
+	SECTION("datatype = float" ) {
+		test_tanh<float,mipp::balanced>(2., std::numeric_limits<float>::epsilon() * 4);
+		test_tanh<float,mipp::fast>(0., 2e-4);
+		test_tanh<float,mipp::precise>(2., std::numeric_limits<float>::epsilon() * 4);
+	}
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") {
+		test_tanh<double,mipp::balanced>(2., std::numeric_limits<double>::epsilon() * 4);
+#if !defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2
+		test_tanh<double,mipp::fast>(0., 2e-4);
+		test_tanh<double,mipp::precise>(2., std::numeric_limits<double>::epsilon() * 4);
+#endif
+	}
+#endif
+}
+
+TEST_CASE("Sigmoid - mipp::Reg", "[mipp::sigmoid]")
+{
+	SECTION("datatype = float" ) {
+		test_sigmoid<float,mipp::balanced>(3., std::numeric_limits<float>::epsilon() * 4);
+		test_sigmoid<float,mipp::fast>(0., 2e-4);
+		test_sigmoid<float,mipp::precise>(3., std::numeric_limits<float>::epsilon() * 4);
+	}
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") {
+		test_sigmoid<double,mipp::balanced>(3., std::numeric_limits<double>::epsilon() * 4);
+#if !defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2
+		test_sigmoid<double,mipp::fast>(0., 2e-4);
+		test_sigmoid<double,mipp::precise>(3., std::numeric_limits<double>::epsilon() * 4);
+#endif
+	}
+#endif
+}
+
+TEST_CASE("Softplus - mipp::Reg", "[mipp::softplus]")
+{
+	SECTION("datatype = float" ) {
+		test_softplus<float,mipp::balanced>(3., std::numeric_limits<float>::epsilon() * 4);
+		test_softplus<float,mipp::fast>(0., 2e-4);
+		test_softplus<float,mipp::precise>(3., std::numeric_limits<float>::epsilon() * 4);
+	}
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") {
+		test_softplus<double,mipp::balanced>(3., std::numeric_limits<double>::epsilon() * 4);
+#if !defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2
+		test_softplus<double,mipp::fast>(0., 2e-4);
+		test_softplus<double,mipp::precise>(3., std::numeric_limits<double>::epsilon() * 4);
+#endif
+	}
+#endif
+}
+
+TEST_CASE("Logarithm of the sum of exponentials - mipp::Reg", "[mipp::logaddexp]")
+{
+	SECTION("datatype = float" ) {
+		test_logaddexp<float,mipp::balanced>(2., std::numeric_limits<float>::epsilon() * 4);
+		test_logaddexp<float,mipp::fast>(0., 2e-4);
+		test_logaddexp<float,mipp::precise>(2., std::numeric_limits<float>::epsilon() * 4);
+	}
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") {
+		test_logaddexp<double,mipp::balanced>(2., std::numeric_limits<double>::epsilon() * 4);
+#if !defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2
+		test_logaddexp<double,mipp::fast>(0., 2e-4);
+		test_logaddexp<double,mipp::precise>(2., std::numeric_limits<double>::epsilon() * 4);
+#endif
+	}
+#endif
+}
+
+TEST_CASE("Error function - mipp::Reg", "[mipp::erf]")
+{
+	SECTION("datatype = float" ) {
+		test_erf<float,mipp::balanced>(2., std::numeric_limits<float>::epsilon() * 4);
+		test_erf<float,mipp::fast>(0., 2e-4);
+		test_erf<float,mipp::precise>(2., std::numeric_limits<float>::epsilon() * 4);
+	}
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") {
+		test_erf<double,mipp::balanced>(2., std::numeric_limits<double>::epsilon() * 4);
+		test_erf<double,mipp::fast>(0., 2e-4);
+		test_erf<double,mipp::precise>(2., std::numeric_limits<double>::epsilon() * 4);
+	}
+#endif
+}
+
+TEST_CASE("Complementary error function - mipp::Reg", "[mipp::erfc]")
+{
+	SECTION("datatype = float" ) {
+		test_erfc<float,mipp::balanced>(7., std::numeric_limits<float>::epsilon() * 8);
+		test_erfc<float,mipp::fast>(0., 2e-4);
+		test_erfc<float,mipp::precise>(7., std::numeric_limits<float>::epsilon() * 8);
+	}
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") {
+		test_erfc<double,mipp::balanced>(7., std::numeric_limits<double>::epsilon() * 8);
+		test_erfc<double,mipp::fast>(0., 2e-4);
+		test_erfc<double,mipp::precise>(7., std::numeric_limits<double>::epsilon() * 8);
+	}
+#endif
+}
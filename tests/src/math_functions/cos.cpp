@@ -30,7 +30,7 @@ void test_reg_cos()
 TEST_CASE("Cosine - mipp::reg", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_reg_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_cos<double>(); }
 #endif
 }
@@ -60,7 +60,7 @@ void test_Reg_cos()
 TEST_CASE("Cosine - mipp::Reg", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_Reg_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_cos<double>(); }
 #endif
 }
@@ -103,7 +103,7 @@ void test_reg_maskz_cos()
 TEST_CASE("Cosine - mipp::reg - maskz", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_reg_maskz_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_maskz_cos<double>(); }
 #endif
 }
@@ -145,7 +145,7 @@ void test_Reg_maskz_cos()
 TEST_CASE("Cosine - mipp::Reg - maskz", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_Reg_maskz_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_maskz_cos<double>(); }
 #endif
 }
@@ -189,7 +189,7 @@ void test_reg_mask_cos()
 TEST_CASE("Cosine - mipp::reg - mask", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_reg_mask_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_mask_cos<double>(); }
 #endif
 }
@@ -233,7 +233,7 @@ void test_Reg_mask_cos()
 TEST_CASE("Cosine - mipp::Reg - mask", "[mipp::cos]")
 {
 	SECTION("datatype = float" ) { test_Reg_mask_cos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_mask_cos<double>(); }
 #endif
 }
\ No newline at end of file
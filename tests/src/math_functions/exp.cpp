@@ -33,7 +33,7 @@ void test_reg_exp()
 TEST_CASE("Exponential - mipp::reg", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_reg_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_exp<double>(); }
 #endif
 }
@@ -65,7 +65,7 @@ void test_Reg_exp()
 TEST_CASE("Exponential - mipp::Reg", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_Reg_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_exp<double>(); }
 #endif
 }
@@ -110,7 +110,7 @@ void test_reg_maskz_exp()
 TEST_CASE("Exponential - mipp::reg - maskz", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_reg_maskz_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_maskz_exp<double>(); }
 #endif
 }
@@ -155,7 +155,7 @@ void test_Reg_maskz_exp()
 TEST_CASE("Exponential - mipp::Reg - maskz", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_Reg_maskz_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_maskz_exp<double>(); }
 #endif
 }
@@ -202,7 +202,7 @@ void test_reg_mask_exp()
 TEST_CASE("Exponential - mipp::reg - mask", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_reg_mask_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_mask_exp<double>(); }
 #endif
 }
@@ -249,7 +249,7 @@ void test_Reg_mask_exp()
 TEST_CASE("Exponential - mipp::Reg - mask", "[mipp::exp]")
 {
 	SECTION("datatype = float" ) { test_Reg_mask_exp<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_mask_exp<double>(); }
 #endif
 }
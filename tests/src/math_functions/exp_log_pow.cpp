@@ -0,0 +1,227 @@
+#include "math_test.hpp"
+
+template <typename T>
+void test_exp2()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::exp2(x); };
+	auto ref = [](long double x) { return std::exp2(x); };
+
+	test_accuracy<T>(f, ref, (T)-20, (T)20, 1.5, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)0.5, (T)-2.5, (T)200, (T)-2000, inf, -inf, nan, (T)3 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::exp2<T>(x.r)); }, ref, (T)-20, (T)20, 1.5, 0.);
+#endif
+}
+
+template <typename T>
+void test_expm1()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::expm1(x); };
+	auto ref = [](long double x) { return std::expm1(x); };
+
+	test_accuracy<T>(f, ref, (T)-2, (T)2, 2., 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)0.5, (T)-2.5, (T)1e4, (T)-1e4, inf, -inf, nan, (T)30 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::expm1<T>(x.r)); }, ref, (T)-2, (T)2, 2., 0.);
+#endif
+}
+
+template <typename T>
+void test_log2()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::log2(x); };
+	auto ref = [](long double x) { return std::log2(x); };
+
+	test_accuracy<T>(f, ref, (T)0.001, (T)1000, 1.5, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)0.5, (T)1024, (T)1e-30, (T)3, inf, -inf, nan, (T)2.5 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::log2<T>(x.r)); }, ref, (T)0.001, (T)1000, 1.5, 0.);
+#endif
+}
+
+template <typename T>
+void test_log10()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::log10(x); };
+	auto ref = [](long double x) { return std::log10(x); };
+
+	test_accuracy<T>(f, ref, (T)0.001, (T)1000, 1.5, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)10, (T)1000, (T)1e-30, (T)3, inf, -inf, nan, (T)2.5 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::log10<T>(x.r)); }, ref, (T)0.001, (T)1000, 1.5, 0.);
+#endif
+}
+
+template <typename T>
+void test_log1p()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::log1p(x); };
+	auto ref = [](long double x) { return std::log1p(x); };
+
+	test_accuracy<T>(f, ref, (T)-0.9, (T)10, 1.5, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1e-20, (T)-1e-5, (T)-1, (T)-2, (T)1e30, (T)3, inf, -inf, nan, (T)-0.5 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::log1p<T>(x.r)); }, ref, (T)-0.9, (T)10, 1.5, 0.);
+#endif
+}
+
+template <typename T>
+void test_cbrt()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::cbrt(x); };
+	auto ref = [](long double x) { return std::cbrt(x); };
+#ifndef MIPP_NO_INTRINSICS
+	const double max_ulp = 1.5;
+#else
+	const double max_ulp = 4.; // 'std::cbrt' of the C library
+#endif
+
+	test_accuracy<T>(f, ref, (T)-1000, (T)1000, max_ulp, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)8, (T)-27, (T)1e-30, (T)3, inf, -inf, nan, (T)-2.5 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::cbrt<T>(x.r)); }, ref, (T)-1000, (T)1000, 1.5, 0.);
+#endif
+}
+
+template <typename T>
+void test_pow()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	const double eps = std::numeric_limits<T>::epsilon() * 4;
+	auto f = [](mipp::Reg<T> x, mipp::Reg<T> y) { return mipp::pow(x, y); };
+
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::pow(x, mipp::Reg<T>((T)2.7)); },
+	                 [](long double x) { return std::pow(x, (long double)(T)2.7); }, (T)0.01, (T)100, 3., 0.);
+	test_accuracy<T>([](mipp::Reg<T> y) { return mipp::pow(mipp::Reg<T>((T)2.5), y); },
+	                 [](long double y) { return std::pow(2.5L, y); }, (T)-20, (T)20, 3., 0.);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::pow<T>(x.r, mipp::set1<T>((T)2.7))); },
+	                 [](long double x) { return std::pow(x, (long double)(T)2.7); }, (T)0.01, (T)100, 3., 0.);
+#endif
+
+	// all the pairs of special values against the C library
+	test_values2<T>(f, [](long double x, long double y) { return std::pow(x, y); },
+	                { (T)0, -(T)0, (T)1, (T)-1, (T)2, (T)-3, (T)0.5, (T)-2.5, (T)1e6, inf, -inf, nan }, eps);
+
+	// the negative bases, the zeros with negative exponents and the infinities: '{ x, y, pow(x, y) }'
+	test_cases2<T>(f, { {{ (T)-2,  (T)3,    (T)-8     }}, {{ (T)-2,  (T)2,    (T)4      }},
+	                    {{ (T)-2,  (T)-3,   (T)-0.125 }}, {{ (T)-2.5, (T)2,   (T)6.25   }},
+	                    {{ (T)-2,  (T)0.5,  nan       }}, {{ (T)-8,  (T)-1.5, nan       }},
+	                    {{ (T)0,   (T)-1,   inf       }}, {{ -(T)0,  (T)-1,   -inf      }},
+	                    {{ -(T)0,  (T)-2,   inf       }}, {{ (T)0,   (T)-0.5, inf       }},
+	                    {{ -(T)0,  (T)3,    -(T)0     }}, {{ -(T)0,  (T)2,    (T)0      }},
+	                    {{ inf,    (T)-1,   (T)0      }}, {{ inf,    (T)2,    inf       }},
+	                    {{ -inf,   (T)3,    -inf      }}, {{ -inf,   (T)2,    inf       }},
+	                    {{ -inf,   (T)-3,   -(T)0     }}, {{ -inf,   (T)-2,   (T)0      }},
+	                    {{ (T)0.5, inf,     (T)0      }}, {{ (T)0.5, -inf,    inf       }},
+	                    {{ (T)2,   inf,     inf       }}, {{ (T)2,   -inf,    (T)0      }},
+	                    {{ (T)-1,  inf,     (T)1      }}, {{ (T)-1,  -inf,    (T)1      }},
+	                    {{ (T)1,   nan,     (T)1      }}, {{ nan,    (T)0,    (T)1      }},
+	                    {{ nan,    (T)1,    nan       }} }, eps);
+}
+
+template <typename T>
+void test_powi()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	// products for |n| <= 4 (up to 4 roundings for n = -4), 'pow' for the other exponents
+	for (auto n = -7; n <= 7; n++)
+		test_accuracy<T>([n](mipp::Reg<T> x) { return mipp::powi(x, n); },
+		                 [n](long double x) { return std::pow(x, (long double)n); }, (T)-4, (T)4, 3.5, 0.);
+
+	// '{ x, n, powi(x, n) }'
+	test_cases2<T>([](mipp::Reg<T> x, mipp::Reg<T> n) { return mipp::powi(x, (int)n[0]); },
+	               { {{ (T)-2, (T)3,  (T)-8          }}, {{ (T)-2, (T)-3, (T)-0.125     }},
+	                 {{ (T)-3, (T)7,  (T)-2187       }}, {{ (T)-2, (T)-7, (T)-0.0078125 }},
+	                 {{ (T)0,  (T)-1, inf            }}, {{ -(T)0, (T)-1, -inf          }},
+	                 {{ -(T)0, (T)-2, inf            }}, {{ -(T)0, (T)-7, -inf          }},
+	                 {{ -(T)0, (T)3,  -(T)0          }}, {{ inf,   (T)-2, (T)0          }},
+	                 {{ -inf,  (T)3,  -inf           }}, {{ -inf,  (T)-3, -(T)0         }},
+	                 {{ nan,   (T)0,  (T)1           }}, {{ nan,   (T)2,  nan           }} },
+	               std::numeric_limits<T>::epsilon() * 4);
+}
+
+TEST_CASE("Exponential of base 2 - mipp::Reg", "[mipp::exp2]")
+{
+	SECTION("datatype = float" ) { test_exp2<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_exp2<double>(); }
+#endif
+}
+
+TEST_CASE("Exponential minus one - mipp::Reg", "[mipp::expm1]")
+{
+	SECTION("datatype = float" ) { test_expm1<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_expm1<double>(); }
+#endif
+}
+
+TEST_CASE("Logarithm of base 2 - mipp::Reg", "[mipp::log2]")
+{
+	SECTION("datatype = float" ) { test_log2<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_log2<double>(); }
+#endif
+}
+
+TEST_CASE("Logarithm of base 10 - mipp::Reg", "[mipp::log10]")
+{
+	SECTION("datatype = float" ) { test_log10<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_log10<double>(); }
+#endif
+}
+
+TEST_CASE("Logarithm of one plus x - mipp::Reg", "[mipp::log1p]")
+{
+	SECTION("datatype = float" ) { test_log1p<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_log1p<double>(); }
+#endif
+}
+
+TEST_CASE("Cube root - mipp::Reg", "[mipp::cbrt]")
+{
+	SECTION("datatype = float" ) { test_cbrt<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_cbrt<double>(); }
+#endif
+}
+
+TEST_CASE("Power - mipp::Reg", "[mipp::pow]")
+{
+	SECTION("datatype = float" ) { test_pow<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_pow<double>(); }
+#endif
+}
+
+TEST_CASE("Integer power - mipp::Reg", "[mipp::powi]")
+{
+	SECTION("datatype = float" ) { test_powi<float>(); }
+#if defined(MIPP_64BIT) && (!defined(MIPP_AVX) || MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = double") { test_powi<double>(); }
+#endif
+}
@@ -0,0 +1,115 @@
+#include "math_test.hpp"
+
+template <typename T>
+void test_atan()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::atan(x); };
+	auto ref = [](long double x) { return std::atan(x); };
+
+	test_accuracy<T>(f, ref, (T)-20, (T)20, 2.5, 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)0.5, (T)-2.5, (T)1e20, inf, -inf, nan, (T)0.4 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::atan<T>(x.r)); }, ref, (T)-20, (T)20, 2.5, 0.);
+#endif
+}
+
+TEST_CASE("Arc tangent - mipp::Reg", "[mipp::atan]")
+{
+	SECTION("datatype = float" ) { test_atan<float>(); }
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_atan<double>(); }
+#endif
+}
+
+template <typename T>
+void test_asin()
+{
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::asin(x); };
+	auto ref = [](long double x) { return std::asin(x); };
+
+	test_accuracy<T>(f, ref, (T)-1, (T)1, 2., 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)0.5, (T)-0.75, (T)0.99, (T)2, (T)-1e-20, nan, (T)0.3 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::asin<T>(x.r)); }, ref, (T)-1, (T)1, 2., 0.);
+#endif
+}
+
+TEST_CASE("Arc sine - mipp::Reg", "[mipp::asin]")
+{
+	SECTION("datatype = float" ) { test_asin<float>(); }
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_asin<double>(); }
+#endif
+}
+
+template <typename T>
+void test_acos()
+{
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	auto f   = [](mipp::Reg<T> x) { return mipp::acos(x); };
+	auto ref = [](long double x) { return std::acos(x); };
+
+	test_accuracy<T>(f, ref, (T)-1, (T)1, 2., 0.);
+	test_values<T>(f, ref, { (T)0, -(T)0, (T)1, (T)-1, (T)0.5, (T)-0.75, (T)0.99, (T)2, (T)-0.999, nan, (T)0.3 },
+	               std::numeric_limits<T>::epsilon() * 4);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> x) { return mipp::Reg<T>(mipp::acos<T>(x.r)); }, ref, (T)-1, (T)1, 2., 0.);
+#endif
+}
+
+TEST_CASE("Arc cosine - mipp::Reg", "[mipp::acos]")
+{
+	SECTION("datatype = float" ) { test_acos<float>(); }
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_acos<double>(); }
+#endif
+}
+
+template <typename T>
+void test_atan2()
+{
+	const T inf = std::numeric_limits<T>::infinity();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+	const T pi  = (T)3.14159265358979323846;
+	const double eps = std::numeric_limits<T>::epsilon() * 4;
+
+	// the two half-planes of 'x'
+	test_accuracy<T>([](mipp::Reg<T> y) { return mipp::atan2(y, mipp::Reg<T>((T)2.5)); },
+	                 [](long double y) { return std::atan2(y, 2.5L); }, (T)-20, (T)20, 2., 0.);
+	test_accuracy<T>([](mipp::Reg<T> y) { return mipp::atan2(y, mipp::Reg<T>((T)-3)); },
+	                 [](long double y) { return std::atan2(y, -3.L); }, (T)-20, (T)20, 2., 0.);
+#ifndef MIPP_NO_INTRINSICS
+	test_accuracy<T>([](mipp::Reg<T> y) { return mipp::Reg<T>(mipp::atan2<T>(y.r, mipp::set1<T>((T)-3))); },
+	                 [](long double y) { return std::atan2(y, -3.L); }, (T)-20, (T)20, 2., 0.);
+#endif
+
+	// all the pairs of special values against the C library
+	test_values2<T>([](mipp::Reg<T> y, mipp::Reg<T> x) { return mipp::atan2(y, x); },
+	                [](long double y, long double x) { return std::atan2(y, x); },
+	                { (T)0, -(T)0, (T)1, (T)-1, (T)3, inf, -inf, nan }, eps);
+
+	// the quadrants of the signed zeros and of the infinities: '{ y, x, atan2(y, x) }'
+	test_cases2<T>([](mipp::Reg<T> y, mipp::Reg<T> x) { return mipp::atan2(y, x); },
+	               { {{  (T)0,  (T)0,  (T)0      }}, {{ -(T)0,  (T)0, -(T)0      }},
+	                 {{  (T)0, -(T)0,  pi        }}, {{ -(T)0, -(T)0, -pi        }},
+	                 {{  (T)0, (T)-1,  pi        }}, {{ -(T)0, (T)-1, -pi        }},
+	                 {{  (T)1,  (T)0,  pi / 2    }}, {{ (T)-1, -(T)0, -pi / 2    }},
+	                 {{  inf,   inf,   pi / 4    }}, {{  inf,  -inf,   3 * pi / 4 }},
+	                 {{ -inf,   inf,  -pi / 4    }}, {{ -inf,  -inf,  -3 * pi / 4 }},
+	                 {{  (T)1,  inf,   (T)0      }}, {{ (T)-1,  inf,  -(T)0      }},
+	                 {{  (T)1, -inf,   pi        }}, {{ (T)-1, -inf,  -pi        }},
+	                 {{  nan,  (T)1,   nan       }}, {{  (T)1,  nan,   nan       }} }, eps);
+}
+
+TEST_CASE("Arc tangent of y / x - mipp::Reg", "[mipp::atan2]")
+{
+	SECTION("datatype = float" ) { test_atan2<float>(); }
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_atan2<double>(); }
+#endif
+}
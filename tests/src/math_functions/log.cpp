@@ -30,7 +30,7 @@ void test_reg_log()
 TEST_CASE("Logarithm - mipp::reg", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_reg_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_log<double>(); }
 #endif
 }
@@ -60,7 +60,7 @@ void test_Reg_log()
 TEST_CASE("Logarithm - mipp::Reg", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_Reg_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_log<double>(); }
 #endif
 }
@@ -103,7 +103,7 @@ void test_reg_maskz_log()
 TEST_CASE("Logarithm - mipp::reg - maskz", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_reg_maskz_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_maskz_log<double>(); }
 #endif
 }
@@ -145,7 +145,7 @@ void test_Reg_maskz_log()
 TEST_CASE("Logarithm - mipp::Reg - maskz", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_Reg_maskz_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_maskz_log<double>(); }
 #endif
 }
@@ -189,7 +189,7 @@ void test_reg_mask_log()
 TEST_CASE("Logarithm - mipp::reg - mask", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_reg_mask_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_mask_log<double>(); }
 #endif
 }
@@ -233,7 +233,7 @@ void test_Reg_mask_log()
 TEST_CASE("Logarithm - mipp::Reg - mask", "[mipp::log]")
 {
 	SECTION("datatype = float" ) { test_Reg_mask_log<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_mask_log<double>(); }
 #endif
 }
\ No newline at end of file
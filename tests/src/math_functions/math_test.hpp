@@ -0,0 +1,118 @@
+#ifndef MIPP_TESTS_MATH_TEST_HPP_
+#define MIPP_TESTS_MATH_TEST_HPP_
+
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// checkers shared by the math function tests: 'f' computes the function on a 'mipp::Reg<T>', 'ref' is the reference
+// computed in 'long double'
+
+// error of 'y' in units in the last place of the exact result 'ref'
+template <typename T>
+double ulp_error(const T y, const long double ref)
+{
+	const T r = (T)ref;
+	const T a = std::abs(r) < std::numeric_limits<T>::min() ? std::numeric_limits<T>::denorm_min()
+	                                                         : std::nextafter(std::abs(r), std::numeric_limits<T>::infinity()) - std::abs(r);
+	return (double)(std::abs((long double)y - ref) / (long double)a);
+}
+
+// random inputs in [vmin, vmax]: at most 'max_ulp' ULP, or the relative error 'max_rel' if 'max_ulp' is 0
+template <typename T, class F, class R>
+void test_accuracy(F f, R ref, const T vmin, const T vmax, const double max_ulp, const double max_rel)
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_real_distribution<T> dis(vmin, vmax);
+
+	T inputs[N], outputs[N];
+	for (auto n = 0; n < 2000; n++)
+	{
+		for (auto i = 0; i < N; i++)
+			inputs[i] = dis(g);
+
+		f(mipp::Reg<T>(inputs)).storeu(outputs);
+		for (auto i = 0; i < N; i++)
+		{
+			const long double r = ref((long double)inputs[i]);
+			if (max_ulp > 0)
+				REQUIRE(ulp_error<T>(outputs[i], r) <= max_ulp);
+			else
+				REQUIRE(std::abs((long double)outputs[i] - r) <= (long double)max_rel * std::abs(r));
+		}
+	}
+}
+
+// NaN if 'res' is NaN, the value and the sign of 'res' otherwise
+template <typename T>
+void check_value(const T y, const T res, const double eps)
+{
+	if (std::isnan(res))
+		REQUIRE(std::isnan(y));
+	else
+	{
+		REQUIRE(y == Approx(res).epsilon(eps));
+		REQUIRE(std::signbit(y) == std::signbit(res));
+	}
+}
+
+// the special values (zeros, infinities, NaN, ...) in all the lanes
+template <typename T, class F, class R>
+void test_values(F f, R ref, const std::vector<T> &values, const double eps)
+{
+	constexpr int N = mipp::N<T>();
+	const int S = (int)values.size();
+
+	for (auto k = 0; k < S; k += N)
+	{
+		T inputs[N];
+		for (auto i = 0; i < N; i++)
+			inputs[i] = values[(k + i) % S];
+
+		const mipp::Reg<T> y = f(mipp::Reg<T>(inputs));
+		for (auto i = 0; i < N; i++)
+			check_value<T>(y[i], (T)ref((long double)inputs[i]), eps);
+	}
+}
+
+// all the pairs of 'values' for a function of two arguments
+template <typename T, class F, class R>
+void test_values2(F f, R ref, const std::vector<T> &values, const double eps)
+{
+	constexpr int N = mipp::N<T>();
+	const int S = (int)values.size();
+
+	for (auto k = 0; k < S * S; k += N)
+	{
+		T inputs1[N], inputs2[N];
+		for (auto i = 0; i < N; i++)
+		{
+			inputs1[i] = values[((k + i) / S) % S];
+			inputs2[i] = values[(k + i) % S];
+		}
+
+		const mipp::Reg<T> y = f(mipp::Reg<T>(inputs1), mipp::Reg<T>(inputs2));
+		for (auto i = 0; i < N; i++)
+			check_value<T>(y[i], (T)ref((long double)inputs1[i], (long double)inputs2[i]), eps);
+	}
+}
+
+// the cases '{ a, b, f(a, b) }' with a known result, independently of the reference
+template <typename T, class F>
+void test_cases2(F f, const std::vector<std::array<T,3>> &cases, const double eps)
+{
+	for (const auto &c : cases)
+	{
+		const mipp::Reg<T> y = f(mipp::Reg<T>(c[0]), mipp::Reg<T>(c[1]));
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			check_value<T>(y[i], c[2], eps);
+	}
+}
+
+#endif /* MIPP_TESTS_MATH_TEST_HPP_ */
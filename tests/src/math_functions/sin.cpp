@@ -30,7 +30,7 @@ void test_reg_sin()
 TEST_CASE("Sine - mipp::reg", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_reg_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_sin<double>(); }
 #endif
 }
@@ -60,7 +60,7 @@ void test_Reg_sin()
 TEST_CASE("Sine - mipp::Reg", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_Reg_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_sin<double>(); }
 #endif
 }
@@ -103,7 +103,7 @@ void test_reg_maskz_sin()
 TEST_CASE("Sine - mipp::reg - maskz", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_reg_maskz_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_maskz_sin<double>(); }
 #endif
 }
@@ -145,7 +145,7 @@ void test_Reg_maskz_sin()
 TEST_CASE("Sine - mipp::Reg - maskz", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_Reg_maskz_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_maskz_sin<double>(); }
 #endif
 }
@@ -189,7 +189,7 @@ void test_reg_mask_sin()
 TEST_CASE("Sine - mipp::reg - mask", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_reg_mask_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_mask_sin<double>(); }
 #endif
 }
@@ -233,7 +233,7 @@ void test_Reg_mask_sin()
 TEST_CASE("Sine - mipp::Reg - mask", "[mipp::sin]")
 {
 	SECTION("datatype = float" ) { test_Reg_mask_sin<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_mask_sin<double>(); }
 #endif
 }
\ No newline at end of file
@@ -36,7 +36,7 @@ void test_reg_sincos()
 TEST_CASE("Sine & Cosine - mipp::reg", "[mipp::sincos]")
 {
 	SECTION("datatype = float" ) { test_reg_sincos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_reg_sincos<double>(); }
 #endif
 }
@@ -71,7 +71,7 @@ void test_Reg_sincos()
 TEST_CASE("Sine & Cosine - mipp::Reg", "[mipp::sincos]")
 {
 	SECTION("datatype = float" ) { test_Reg_sincos<float>(); }
-#if defined(MIPP_64BIT) && (defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC))
+#if defined(MIPP_64BIT)
 	SECTION("datatype = double") { test_Reg_sincos<double>(); }
 #endif
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T, class A>
+void test_allocator(const size_t size)
+{
+	std::vector<T, A> v(size);
+	REQUIRE(mipp::isAligned(v.data()));
+	REQUIRE(((uintptr_t)v.data() % mipp::RequiredAlignment) == 0);
+
+	std::iota(v.begin(), v.end(), (T)0);
+	v.resize(2 * size + 1, (T)1);
+	size_t n_errors = 0;
+	for (size_t i = 0; i < size; i++)
+		n_errors += v[i] != (T)i;
+	REQUIRE(n_errors == 0);
+	REQUIRE(((uintptr_t)v.data() % mipp::RequiredAlignment) == 0);
+}
+
+TEST_CASE("Allocator - mipp::allocator", "[mipp::allocator]")
+{
+	SECTION("datatype = float") { test_allocator<float, mipp::allocator<float>>(1000); }
+	SECTION("datatype = int8_t") { test_allocator<int8_t, mipp::allocator<int8_t>>(1000); }
+
+	SECTION("overflow")
+	{
+		REQUIRE(mipp::malloc<double>(SIZE_MAX / 4) == nullptr);
+		REQUIRE_THROWS_AS(mipp::allocator<double>().allocate(SIZE_MAX / 4), std::bad_alloc);
+	}
+}
+
+TEST_CASE("Allocator - mipp::huge_allocator", "[mipp::allocator]")
+{
+	// below and above the 'MIPP_HUGE_PAGES_THRESHOLD'
+	SECTION("datatype = float") { test_allocator<float, mipp::huge_allocator<float>>(1000); }
+	SECTION("datatype = float (large)")
+	{
+		test_allocator<float, mipp::huge_allocator<float>>((size_t)MIPP_HUGE_PAGES_THRESHOLD / sizeof(float) + 3);
+	}
+	SECTION("datatype = double (large)")
+	{
+		mipp::vector<double, mipp::huge_allocator<double>> v((size_t)MIPP_HUGE_PAGES_THRESHOLD, 2.0);
+		REQUIRE(std::all_of(v.begin(), v.end(), [](const double d) { return d == 2.0; }));
+	}
+}
+
+TEST_CASE("Allocator - mipp::pool_allocator", "[mipp::allocator]")
+{
+	SECTION("datatype = float") { test_allocator<float, mipp::pool_allocator<float>>(1000); }
+	SECTION("datatype = int16_t") { test_allocator<int16_t, mipp::pool_allocator<int16_t>>(1); }
+	SECTION("datatype = double (large)")
+	{
+		test_allocator<double, mipp::pool_allocator<double>>(((size_t)1 << MIPP_POOL_MAX_BLOCK_LOG2) / sizeof(double));
+	}
+
+	SECTION("reuse")
+	{
+		const void *ptr;
+		{
+			mipp::vector<float, mipp::pool_allocator<float>> v(100);
+			ptr = (const void*)v.data();
+		}
+		// the block has been cached by the previous deallocation, it is the same size class
+		mipp::vector<int32_t, mipp::pool_allocator<int32_t>> v(120);
+		REQUIRE((const void*)v.data() == ptr);
+	}
+}
@@ -0,0 +1,134 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// random masks, then all the elements unset and all the elements set
+template <int N>
+void init_compress_mask(bool mask[N], const int j, std::mt19937 &g)
+{
+	std::uniform_int_distribution<int> dis(0, 1);
+	for (auto i = 0; i < N; i++)
+		mask[i] = (j == 0) ? false : (j == 1) ? true : dis(g) ? true : false;
+}
+
+template <typename T>
+void check_compress(const T inputs[mipp::N<T>()], const bool mask[mipp::N<T>()], const T outputs[mipp::N<T>()])
+{
+	auto k = 0;
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		if (mask[i])
+			REQUIRE(outputs[k++] == inputs[i]);
+	for (; k < mipp::N<T>(); k++)
+		REQUIRE(outputs[k] == (T)0);
+}
+
+template <typename T>
+void check_compress_store(const T inputs[mipp::N<T>()], const bool mask[mipp::N<T>()], const T outputs[mipp::N<T>()],
+                          const uint32_t n)
+{
+	uint32_t k = 0;
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		if (mask[i])
+			REQUIRE(outputs[k++] == inputs[i]);
+	REQUIRE(n == k);
+	for (; k < (uint32_t)mipp::N<T>(); k++)
+		REQUIRE(outputs[k] == (T)42);
+}
+
+template <typename T>
+void test_reg_compress()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N], outputs[N];
+	bool mask[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	std::mt19937 g;
+
+	for (auto j = 0; j < 100; j++)
+	{
+		init_compress_mask<N>(mask, j, g);
+
+		mipp::reg r1 = mipp::load<T>(inputs1);
+		mipp::msk m1 = mipp::set<N>(mask);
+
+		mipp::storeu<T>(outputs, mipp::compress<T>(r1, m1));
+		check_compress<T>(inputs1, mask, outputs);
+
+		std::fill(outputs, outputs + N, (T)42);
+		auto n = mipp::compress_store<T>(outputs, r1, m1);
+		check_compress_store<T>(inputs1, mask, outputs, n);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Compress - mipp::reg", "[mipp::compress]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_compress<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_compress<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_compress<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_compress<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_compress<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_compress<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_compress<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_compress<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_compress<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_compress<uint8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_compress()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N], outputs[N];
+	bool mask[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	std::mt19937 g;
+
+	for (auto j = 0; j < 100; j++)
+	{
+		init_compress_mask<N>(mask, j, g);
+
+		mipp::Reg<T> r1 = inputs1;
+		mipp::Msk<N> m1 = mask;
+
+		mipp::compress(r1, m1).storeu(outputs);
+		check_compress<T>(inputs1, mask, outputs);
+
+		std::fill(outputs, outputs + N, (T)42);
+		auto n = mipp::compress_store(outputs, r1, m1);
+		check_compress_store<T>(inputs1, mask, outputs, n);
+	}
+}
+
+TEST_CASE("Compress - mipp::Reg", "[mipp::compress]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_compress<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_compress<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_compress<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_compress<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_compress<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_compress<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_compress<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_compress<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_compress<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_compress<uint8_t>(); }
+#endif
+}
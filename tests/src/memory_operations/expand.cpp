@@ -0,0 +1,116 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// random masks, then all the elements unset and all the elements set
+template <int N>
+void init_expand_mask(bool mask[N], const int j, std::mt19937 &g)
+{
+	std::uniform_int_distribution<int> dis(0, 1);
+	for (auto i = 0; i < N; i++)
+		mask[i] = (j == 0) ? false : (j == 1) ? true : dis(g) ? true : false;
+}
+
+template <typename T>
+void check_expand(const T inputs[mipp::N<T>()], const bool mask[mipp::N<T>()], const T outputs[mipp::N<T>()])
+{
+	auto k = 0;
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		REQUIRE(outputs[i] == (mask[i] ? inputs[k++] : (T)0));
+}
+
+template <typename T>
+void test_reg_expand()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N], outputs[N];
+	bool mask[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	std::mt19937 g;
+
+	for (auto j = 0; j < 100; j++)
+	{
+		init_expand_mask<N>(mask, j, g);
+
+		mipp::reg r1 = mipp::load<T>(inputs1);
+		mipp::msk m1 = mipp::set<N>(mask);
+
+		mipp::storeu<T>(outputs, mipp::expand<T>(r1, m1));
+		check_expand<T>(inputs1, mask, outputs);
+
+		// 'expand' is the inverse of 'compress' on the selected elements
+		mipp::storeu<T>(outputs, mipp::compress<T>(mipp::expand<T>(r1, m1), m1));
+		const auto n = mipp::popcnt<N>(m1);
+		for (uint32_t i = 0; i < n; i++)
+			REQUIRE(outputs[i] == inputs1[i]);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Expand - mipp::reg", "[mipp::expand]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_expand<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_expand<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_expand<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_expand<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_expand<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_expand<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_expand<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_expand<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_expand<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_expand<uint8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_expand()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N], outputs[N];
+	bool mask[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	std::mt19937 g;
+
+	for (auto j = 0; j < 100; j++)
+	{
+		init_expand_mask<N>(mask, j, g);
+
+		mipp::Reg<T> r1 = inputs1;
+		mipp::Msk<N> m1 = mask;
+
+		mipp::expand(r1, m1).storeu(outputs);
+		check_expand<T>(inputs1, mask, outputs);
+	}
+}
+
+TEST_CASE("Expand - mipp::Reg", "[mipp::expand]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_expand<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_expand<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_expand<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_expand<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_expand<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_expand<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_expand<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_expand<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_expand<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_expand<uint8_t>(); }
+#endif
+}
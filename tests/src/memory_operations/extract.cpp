@@ -0,0 +1,107 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// negative values are used to check the sign extension of the small integers
+template <typename T>
+void init_extract(T inputs[mipp::N<T>()])
+{
+	for (auto i = 0; i < mipp::N<T>(); i++)
+		inputs[i] = (i % 2) ? (T)-(i +1) : (T)(i +1);
+}
+
+template <typename T, int I>
+struct test_reg_extract_ct
+{
+	static void apply(const mipp::reg r, const T inputs[mipp::N<T>()])
+	{
+		REQUIRE(mipp::extract<T,I>(r) == inputs[I]);
+		test_reg_extract_ct<T,I -1>::apply(r, inputs);
+	}
+};
+
+template <typename T>
+struct test_reg_extract_ct<T,-1>
+{
+	static void apply(const mipp::reg, const T*) {}
+};
+
+template <typename T>
+void test_reg_extract()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	init_extract<T>(inputs1);
+
+	mipp::reg r1 = mipp::load<T>(inputs1);
+
+	test_reg_extract_ct<T,N -1>::apply(r1, inputs1);
+	for (auto i = 0; i < N; i++)
+		REQUIRE(mipp::extract<T>(r1, i) == inputs1[i]);
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Extract - mipp::reg", "[mipp::extract]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_extract<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_extract<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_extract<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_extract<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_extract<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_extract<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_extract<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_extract<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_extract<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_extract<uint8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_extract()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	init_extract<T>(inputs1);
+
+	mipp::Reg<T> r1 = inputs1;
+
+	REQUIRE(mipp::extract<T,0  >(r1) == inputs1[0  ]);
+	REQUIRE(mipp::extract<T,N-1>(r1) == inputs1[N-1]);
+	for (auto i = 0; i < N; i++)
+	{
+		REQUIRE(mipp::extract(r1, i) == inputs1[i]);
+		REQUIRE(r1[i] == inputs1[i]);
+	}
+}
+
+TEST_CASE("Extract - mipp::Reg", "[mipp::extract]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_extract<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_extract<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_extract<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_extract<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_extract<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_extract<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_extract<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_extract<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_extract<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_extract<uint8_t>(); }
+#endif
+}
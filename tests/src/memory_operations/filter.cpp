@@ -0,0 +1,60 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// keeps the elements greater than a threshold, the out of place and the in place versions are compared to
+// 'std::copy_if'
+template <typename T>
+void test_filter()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-50, 50);
+	const T threshold = (T)10;
+
+	for (auto size = 1; size <= 10 * N + N - 1; size++)
+	{
+		std::vector<T> inputs(size), outputs(size), ref;
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+		std::copy_if(inputs.begin(), inputs.end(), std::back_inserter(ref), [&](const T v) { return v > threshold; });
+
+		auto pred = [&](const mipp::Reg<T> r) { return r > mipp::Reg<T>(threshold); };
+
+		auto n = mipp::filter(inputs.data(), inputs.size(), outputs.data(), pred);
+		REQUIRE(n == ref.size());
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(outputs[i] == ref[i]);
+
+		n = mipp::filter(inputs.data(), inputs.size(), inputs.data(), pred);
+		REQUIRE(n == ref.size());
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(inputs[i] == ref[i]);
+	}
+}
+
+TEST_CASE("Filter - mipp::Reg", "[mipp::filter]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_filter<double>(); }
+#endif
+	SECTION("datatype = float") { test_filter<float>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE)
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_filter<int64_t>(); }
+#endif
+#endif
+	SECTION("datatype = int32_t") { test_filter<int32_t>(); }
+#endif
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_filter<int16_t>(); }
+	SECTION("datatype = int8_t") { test_filter<int8_t>(); }
+#endif
+}
@@ -0,0 +1,111 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T, typename TI>
+void test_reg_gather()
+{
+	constexpr int M = 2 * mipp::N<T>();
+	T mem[M];
+	std::iota(mem, mem + M, (T)1);
+
+	TI all_idx[M];
+	std::iota(all_idx, all_idx + M, (TI)0);
+
+	std::mt19937 g;
+	for (auto t = 0; t < 10; t++)
+	{
+		std::shuffle(all_idx, all_idx + M, g);
+		mipp::reg idx = mipp::loadu<TI>(all_idx);
+
+		mipp::reg r = mipp::gather<T,TI>(mem, idx);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			REQUIRE(mipp::get<T>(r, i) == mem[all_idx[i]]);
+
+		bool mask[mipp::N<T>()];
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			mask[i] = g() & 1;
+		mipp::msk m = mipp::set<mipp::N<T>()>(mask);
+		mipp::reg src = mipp::set1<T>((T)-1);
+
+		mipp::reg rm = mipp::gather<T,TI>(m, src, mem, idx);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			REQUIRE(mipp::get<T>(rm, i) == (mask[i] ? mem[all_idx[i]] : (T)-1));
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Gather - mipp::reg", "[mipp::gather]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_gather<double,int64_t>(); }
+#endif
+	SECTION("datatype = float") { test_reg_gather<float,int32_t>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_gather<int64_t,int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_gather<int32_t,int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_gather<int16_t,int16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_gather<int8_t,int8_t>(); }
+#endif
+}
+#endif
+
+template <typename T, typename TI>
+void test_Reg_gather()
+{
+	constexpr int M = 2 * mipp::N<T>();
+	T mem[M];
+	std::iota(mem, mem + M, (T)1);
+
+	TI all_idx[M];
+	std::iota(all_idx, all_idx + M, (TI)0);
+
+	std::mt19937 g;
+	for (auto t = 0; t < 10; t++)
+	{
+		std::shuffle(all_idx, all_idx + M, g);
+		mipp::Reg<TI> idx; idx.loadu(all_idx);
+
+		mipp::Reg<T> r = mipp::gather<T,TI>(mem, idx);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			REQUIRE(r[i] == mem[all_idx[i]]);
+
+		bool mask[mipp::N<T>()];
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			mask[i] = g() & 1;
+		mipp::Msk<mipp::N<T>()> m = mask;
+		mipp::Reg<T> src = (T)-1;
+
+		mipp::Reg<T> rm = mipp::gather<T,TI>(m, src, mem, idx);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			REQUIRE(rm[i] == (mask[i] ? mem[all_idx[i]] : (T)-1));
+	}
+}
+
+TEST_CASE("Gather - mipp::Reg", "[mipp::gather]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_gather<double,int64_t>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_gather<float,int32_t>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_gather<int64_t,int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_gather<int32_t,int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_gather<int16_t,int16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_gather<int8_t,int8_t>(); }
+#endif
+}
@@ -262,7 +262,7 @@ void test_reg_interleave4()
 }
 
 #ifndef MIPP_NO
-#if defined(MIPP_AVX512)
+#if defined(MIPP_AVX512) || (defined(MIPP_EMU) && MIPP_REGISTER_SIZE >= 512)
 TEST_CASE("Interleave4 - mipp::reg", "[mipp::interleave4]")
 {
 #if defined(MIPP_64BIT)
@@ -315,7 +315,7 @@ void test_Reg_interleave4()
 	}
 }
 
-#if defined(MIPP_AVX512)
+#if defined(MIPP_AVX512) || (defined(MIPP_EMU) && MIPP_REGISTER_SIZE >= 512)
 TEST_CASE("Interleave4 - mipp::Reg", "[mipp::interleave4]")
 {
 #if defined(MIPP_64BIT)
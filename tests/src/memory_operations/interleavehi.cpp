@@ -219,7 +219,7 @@ void test_reg_interleavehi4()
 }
 
 #ifndef MIPP_NO
-#if defined(MIPP_AVX512)
+#if defined(MIPP_AVX512) || (defined(MIPP_EMU) && MIPP_REGISTER_SIZE >= 512)
 TEST_CASE("Interleave4 high - mipp::reg", "[mipp::interleavehi4]")
 {
 #if defined(MIPP_64BIT)
@@ -265,7 +265,7 @@ void test_Reg_interleavehi4()
 	}
 }
 
-#if defined(MIPP_AVX512)
+#if defined(MIPP_AVX512) || (defined(MIPP_EMU) && MIPP_REGISTER_SIZE >= 512)
 TEST_CASE("Interleave4 high - mipp::Reg", "[mipp::interleavehi4]")
 {
 #if defined(MIPP_64BIT)
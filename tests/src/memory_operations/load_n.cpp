@@ -0,0 +1,79 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_reg_load_n()
+{
+	T inputs[mipp::N<T>()];
+	std::iota(inputs, inputs + mipp::N<T>(), (T)1);
+
+	for (auto n = 0; n <= mipp::N<T>(); n++)
+	{
+		mipp::reg r = mipp::load_n<T>(inputs, n);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			if (i < n)
+				REQUIRE(mipp::get<T>(r, i) == inputs[i]);
+			else
+				REQUIRE(mipp::get<T>(r, i) == (T)0);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Load n - mipp::reg", "[mipp::load_n]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_load_n<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_load_n<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_load_n<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_load_n<int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_load_n<int16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_load_n<int8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_load_n()
+{
+	T inputs[mipp::N<T>()];
+	std::iota(inputs, inputs + mipp::N<T>(), (T)1);
+
+	for (auto n = 0; n <= mipp::N<T>(); n++)
+	{
+		mipp::Reg<T> r; r.load_n(inputs, n);
+
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			if (i < n)
+				REQUIRE(r[i] == inputs[i]);
+			else
+				REQUIRE(r[i] == (T)0);
+	}
+}
+
+TEST_CASE("Load n - mipp::Reg", "[mipp::load_n]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_load_n<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_load_n<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_load_n<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_load_n<int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_load_n<int16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_load_n<int8_t>(); }
+#endif
+}
@@ -0,0 +1,34 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_msk_mask_n()
+{
+	constexpr int N = mipp::N<T>();
+	for (auto n = 0; n <= N + 1; n++)
+	{
+		mipp::Msk<N> m = mipp::mask_n<N>(n);
+
+		for (auto i = 0; i < N; i++)
+			REQUIRE(m[i] == (i < n));
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Mask n - mipp::Msk", "[mipp::mask_n]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_msk_mask_n<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_msk_mask_n<int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_msk_mask_n<int16_t>(); }
+	SECTION("datatype = int8_t") { test_msk_mask_n<int8_t>(); }
+#endif
+}
+#endif
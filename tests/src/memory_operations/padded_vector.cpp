@@ -0,0 +1,75 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <random>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_padded_vector()
+{
+	constexpr int N = mipp::N<T>();
+	const T inf = std::numeric_limits<T>::max();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-100, 100);
+
+	for (size_t size = 1; size <= (size_t)(4 * N + 1); size++)
+	{
+		mipp::padded_vector<T> v(size, (T)0, inf);
+		REQUIRE(v.size() == size);
+		REQUIRE(v.padded_size() % N == 0);
+		REQUIRE(v.padded_size() >= size);
+		REQUIRE(v.padded_size() < size + N);
+		REQUIRE(((uintptr_t)v.data() % mipp::RequiredAlignment) == 0);
+		for (size_t i = size; i < v.padded_size(); i++)
+			REQUIRE(v[i] == inf);
+
+		for (auto &x : v)
+			x = (T)dis(g);
+
+		// min search over full registers, without epilogue
+		mipp::Reg<T> rMin = inf;
+		for (size_t i = 0; i < v.padded_size(); i += N)
+			rMin = mipp::min(rMin, mipp::Reg<T>(&v[i]));
+		REQUIRE(mipp::hmin(rMin) == *std::min_element(v.begin(), v.end()));
+
+		// the new elements are set and the padding lanes are reset
+		v.resize(size + 1, (T)7);
+		REQUIRE(v[size] == (T)7);
+		for (size_t i = size + 1; i < v.padded_size(); i++)
+			REQUIRE(v[i] == inf);
+
+		v.push_back((T)8);
+		REQUIRE(v.back() == (T)8);
+		REQUIRE(v.size() == size + 2);
+		for (size_t i = size + 2; i < v.padded_size(); i++)
+			REQUIRE(v[i] == inf);
+
+		v.set_pad((T)0);
+		for (size_t i = v.size(); i < v.padded_size(); i++)
+			REQUIRE(v[i] == (T)0);
+	}
+}
+
+TEST_CASE("Padded vector - mipp::Reg", "[mipp::padded_vector]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_padded_vector<double>(); }
+#endif
+	SECTION("datatype = float") { test_padded_vector<float>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t") { test_padded_vector<int32_t>(); }
+#endif
+#endif
+#if defined(MIPP_BW)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
+	SECTION("datatype = int16_t") { test_padded_vector<int16_t>(); }
+#endif
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int8_t") { test_padded_vector<int8_t>(); }
+#endif
+#endif
+}
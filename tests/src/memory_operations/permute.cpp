@@ -0,0 +1,85 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <int... K> struct seq {};
+template <int N, int... K> struct make_seq : make_seq<N -1, N -1, K...> {};
+template <int... K> struct make_seq<0, K...> { using type = seq<K...>; };
+
+// the patterns are functions of the position 'k' in a register of 'n' elements
+struct p_identity  { static constexpr int get(int k, int  ) { return k;                                             } };
+struct p_reverse   { static constexpr int get(int k, int n) { return n -1 - k;                                      } };
+struct p_rot1      { static constexpr int get(int k, int n) { return (k + 1) % n;                                   } };
+struct p_rot_quart { static constexpr int get(int k, int n) { return (k + n / 4) % n;                               } };
+struct p_rot_half  { static constexpr int get(int k, int n) { return (k + n / 2) % n;                               } };
+struct p_bcast     { static constexpr int get(int  , int n) { return 1 % n;                                         } };
+struct p_pairs     { static constexpr int get(int k, int n) { return n > 1 ? k ^ 1 : k;                             } };
+struct p_lane4     { static constexpr int get(int k, int n) { return n >= 4 ? (k & ~3) | (3 - (k & 3)) : n -1 - k;  } };
+struct p_lanes8    { static constexpr int get(int k, int n) { return n >= 8 ? (k & ~7) | (((k & 7) * 3 + k / 8) & 7)
+                                                                            : (k * 3) % n;                          } };
+struct p_mix       { static constexpr int get(int k, int n) { return (k * 5 + 3) % n;                               } };
+
+template <typename T, class P, int... K>
+void test_permute_pattern(seq<K...>)
+{
+	constexpr int N = mipp::N<T>();
+	T inputs[N], outputs[N];
+	for (auto i = 0; i < N; i++)
+		inputs[i] = (T)i;
+
+	mipp::Reg<T> r;
+	r.loadu(inputs);
+	mipp::permute<T, P::get(K, N)...>(r).storeu(outputs);
+	for (auto i = 0; i < N; i++)
+		REQUIRE(outputs[i] == inputs[P::get(i, N)]);
+
+#ifndef MIPP_NO_INTRINSICS
+	std::fill(outputs, outputs + N, (T)0);
+	mipp::storeu<T>(outputs, mipp::permute<T, P::get(K, N)...>(r.r));
+	for (auto i = 0; i < N; i++)
+		REQUIRE(outputs[i] == inputs[P::get(i, N)]);
+#endif
+}
+
+template <typename T>
+void test_permute()
+{
+	using S = typename make_seq<mipp::N<T>()>::type;
+	test_permute_pattern<T,p_identity >(S());
+	test_permute_pattern<T,p_reverse  >(S());
+	test_permute_pattern<T,p_rot1     >(S());
+	test_permute_pattern<T,p_rot_quart>(S());
+	test_permute_pattern<T,p_rot_half >(S());
+	test_permute_pattern<T,p_bcast    >(S());
+	test_permute_pattern<T,p_pairs    >(S());
+	test_permute_pattern<T,p_lane4    >(S());
+	test_permute_pattern<T,p_lanes8   >(S());
+	test_permute_pattern<T,p_mix      >(S());
+}
+
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
+TEST_CASE("Compile-time permutation - mipp::permute", "[mipp::permute]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_permute<double>(); }
+#endif
+	SECTION("datatype = float") { test_permute<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_permute<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_permute<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_permute<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_permute<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_permute<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_permute<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_permute<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_permute<uint8_t>(); }
+#endif
+}
+#endif
@@ -0,0 +1,90 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <mipp.h>
+#include <catch.hpp>
+
+// the same kernel is instantiated for 'Reg<T>' and for 'Regs<T,K>'
+template <class R>
+R kernel_regs(const R a, const R b)
+{
+	return mipp::max(a * b + a - b, b);
+}
+
+template <typename T, int K>
+void test_Regs()
+{
+	constexpr int N = mipp::N<T>();
+	constexpr int S = K * N;
+	REQUIRE(mipp::Regs<T,K>::size() == S);
+
+	T inputs1[S], inputs2[S], outputs[S], ref[S];
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-8, 8);
+	for (auto i = 0; i < S; i++)
+	{
+		inputs1[i] = (T)dis(g);
+		inputs2[i] = (T)dis(g);
+	}
+
+	for (auto k = 0; k < K; k++)
+	{
+		mipp::Reg<T> r1 = mipp::Reg<T>(&inputs1[k * N]);
+		mipp::Reg<T> r2 = mipp::Reg<T>(&inputs2[k * N]);
+		kernel_regs(r1, r2).storeu(&ref[k * N]);
+	}
+
+	mipp::Regs<T,K> rs1(inputs1), rs2;
+	rs2.loadu(inputs2);
+	kernel_regs(rs1, rs2).storeu(outputs);
+	for (auto i = 0; i < S; i++)
+		REQUIRE(outputs[i] == ref[i]);
+
+	if (std::is_floating_point<T>::value)
+	{
+		mipp::fmadd(rs1, rs2, rs1).storeu(outputs);
+		for (auto i = 0; i < S; i++)
+			REQUIRE(outputs[i] == (T)(inputs1[i] * inputs2[i] + inputs1[i]));
+	}
+
+	auto rs3 = rs1.map(rs2, [](const mipp::Reg<T> a, const mipp::Reg<T> b) { return a * b; });
+	rs3 += mipp::Regs<T,K>((T)1);
+	rs3.storeu(outputs);
+	for (auto i = 0; i < S; i++)
+		REQUIRE(outputs[i] == (T)(inputs1[i] * inputs2[i] + (T)1));
+
+	REQUIRE(mipp::sum (rs1) == std::accumulate(inputs1, inputs1 + S, (T)0));
+	REQUIRE(mipp::hmin(rs1) == *std::min_element(inputs1, inputs1 + S));
+	REQUIRE(mipp::hmax(rs1) == *std::max_element(inputs1, inputs1 + S));
+
+	for (uint32_t n = 0; n <= (uint32_t)S; n++)
+	{
+		std::fill(outputs, outputs + S, (T)42);
+		mipp::Regs<T,K> rs;
+		rs.loadu_n(inputs1, n);
+		rs.storeu_n(outputs, n);
+		for (auto i = 0; i < S; i++)
+			REQUIRE(outputs[i] == ((uint32_t)i < n ? inputs1[i] : (T)42));
+		REQUIRE(rs.sum() == std::accumulate(inputs1, inputs1 + n, (T)0));
+	}
+}
+
+TEST_CASE("Multiple registers - mipp::Regs", "[mipp::Regs]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double, K = 1") { test_Regs<double,1>(); }
+	SECTION("datatype = double, K = 4") { test_Regs<double,4>(); }
+#endif
+	SECTION("datatype = float, K = 1") { test_Regs<float,1>(); }
+	SECTION("datatype = float, K = 2") { test_Regs<float,2>(); }
+	SECTION("datatype = float, K = 3") { test_Regs<float,3>(); }
+	SECTION("datatype = float, K = 4") { test_Regs<float,4>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t, K = 4") { test_Regs<int32_t,4>(); }
+#endif
+#endif
+}
@@ -0,0 +1,142 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+#include "../test_data.hpp"
+
+template <typename T, typename TI>
+void test_reg_scatter()
+{
+	// twice the elements of a register, as many as the 8-bit indices can reach with 128 elements
+	constexpr int M = 2 * mipp::N<T>() - 1 <= (int)std::numeric_limits<TI>::max() ? 2 * mipp::N<T>() : mipp::N<T>();
+	T inputs[mipp::N<T>()];
+	iota_mod(inputs, mipp::N<T>(), (T)1);
+	mipp::reg r = mipp::loadu<T>(inputs);
+
+	TI all_idx[M];
+	std::iota(all_idx, all_idx + M, (TI)0);
+
+	std::mt19937 g;
+	for (auto t = 0; t < 10; t++)
+	{
+		std::shuffle(all_idx, all_idx + M, g);
+		mipp::reg idx = mipp::loadu<TI>(all_idx);
+
+		T mem[M];
+		std::fill(mem, mem + M, (T)-1);
+		mipp::scatter<T,TI>(mem, idx, r);
+
+		T ref[M];
+		std::fill(ref, ref + M, (T)-1);
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			ref[all_idx[i]] = inputs[i];
+
+		for (auto i = 0; i < M; i++)
+			REQUIRE(mem[i] == ref[i]);
+
+		bool mask[mipp::N<T>()];
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			mask[i] = g() & 1;
+		mipp::msk m = mipp::set<mipp::N<T>()>(mask);
+
+		std::fill(mem, mem + M, (T)-1);
+		mipp::scatter<T,TI>(m, mem, idx, r);
+
+		std::fill(ref, ref + M, (T)-1);
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			if (mask[i])
+				ref[all_idx[i]] = inputs[i];
+
+		for (auto i = 0; i < M; i++)
+			REQUIRE(mem[i] == ref[i]);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Scatter - mipp::reg", "[mipp::scatter]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_scatter<double,int64_t>(); }
+#endif
+	SECTION("datatype = float") { test_reg_scatter<float,int32_t>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_scatter<int64_t,int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_scatter<int32_t,int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_scatter<int16_t,int16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_scatter<int8_t,int8_t>(); }
+#endif
+}
+#endif
+
+template <typename T, typename TI>
+void test_Reg_scatter()
+{
+	// twice the elements of a register, as many as the 8-bit indices can reach with 128 elements
+	constexpr int M = 2 * mipp::N<T>() - 1 <= (int)std::numeric_limits<TI>::max() ? 2 * mipp::N<T>() : mipp::N<T>();
+	T inputs[mipp::N<T>()];
+	iota_mod(inputs, mipp::N<T>(), (T)1);
+	mipp::Reg<T> r; r.loadu(inputs);
+
+	TI all_idx[M];
+	std::iota(all_idx, all_idx + M, (TI)0);
+
+	std::mt19937 g;
+	for (auto t = 0; t < 10; t++)
+	{
+		std::shuffle(all_idx, all_idx + M, g);
+		mipp::Reg<TI> idx; idx.loadu(all_idx);
+
+		T mem[M];
+		std::fill(mem, mem + M, (T)-1);
+		mipp::scatter<T,TI>(mem, idx, r);
+
+		T ref[M];
+		std::fill(ref, ref + M, (T)-1);
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			ref[all_idx[i]] = inputs[i];
+
+		for (auto i = 0; i < M; i++)
+			REQUIRE(mem[i] == ref[i]);
+
+		bool mask[mipp::N<T>()];
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			mask[i] = g() & 1;
+		mipp::Msk<mipp::N<T>()> m = mask;
+
+		std::fill(mem, mem + M, (T)-1);
+		mipp::scatter<T,TI>(m, mem, idx, r);
+
+		std::fill(ref, ref + M, (T)-1);
+		for (auto i = 0; i < mipp::N<T>(); i++)
+			if (mask[i])
+				ref[all_idx[i]] = inputs[i];
+
+		for (auto i = 0; i < M; i++)
+			REQUIRE(mem[i] == ref[i]);
+	}
+}
+
+TEST_CASE("Scatter - mipp::Reg", "[mipp::scatter]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_scatter<double,int64_t>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_scatter<float,int32_t>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_scatter<int64_t,int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_scatter<int32_t,int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_scatter<int16_t,int16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_scatter<int8_t,int8_t>(); }
+#endif
+}
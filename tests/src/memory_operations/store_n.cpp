@@ -0,0 +1,83 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_reg_store_n()
+{
+	T inputs[mipp::N<T>()], outputs[2 * mipp::N<T>()];
+	std::iota(inputs, inputs + mipp::N<T>(), (T)1);
+	mipp::reg r = mipp::loadu<T>(inputs);
+
+	for (auto n = 0; n <= mipp::N<T>(); n++)
+	{
+		std::fill(outputs, outputs + 2 * mipp::N<T>(), (T)-1);
+		mipp::store_n<T>(outputs, r, n);
+
+		for (auto i = 0; i < 2 * mipp::N<T>(); i++)
+			if (i < n)
+				REQUIRE(outputs[i] == inputs[i]);
+			else
+				REQUIRE(outputs[i] == (T)-1);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Store n - mipp::reg", "[mipp::store_n]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_store_n<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_store_n<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_store_n<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_store_n<int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_store_n<int16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_store_n<int8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_store_n()
+{
+	T inputs[mipp::N<T>()], outputs[2 * mipp::N<T>()];
+	std::iota(inputs, inputs + mipp::N<T>(), (T)1);
+	mipp::Reg<T> r = mipp::Reg<T>(inputs);
+
+	for (auto n = 0; n <= mipp::N<T>(); n++)
+	{
+		std::fill(outputs, outputs + 2 * mipp::N<T>(), (T)-1);
+		r.store_n(outputs, n);
+
+		for (auto i = 0; i < 2 * mipp::N<T>(); i++)
+			if (i < n)
+				REQUIRE(outputs[i] == inputs[i]);
+			else
+				REQUIRE(outputs[i] == (T)-1);
+	}
+}
+
+TEST_CASE("Store n - mipp::Reg", "[mipp::store_n]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_store_n<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_store_n<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_store_n<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_store_n<int32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_store_n<int16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_store_n<int8_t>(); }
+#endif
+}
@@ -0,0 +1,90 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T>
+void test_reg_stream()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	mipp::vector<T> outputs(4 * N, (T)0);
+
+	mipp::reg r1 = mipp::load<T>(inputs1);
+	for (auto i = 0; i < 4; i++)
+	{
+		mipp::prefetch<mipp::Hint::NTA>(inputs1);
+		mipp::stream<T>(&outputs[i * N], r1);
+	}
+	mipp::sfence();
+
+	for (auto i = 0; i < 4 * N; i++)
+		REQUIRE(outputs[i] == inputs1[i % N]);
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Stream - mipp::reg", "[mipp::stream]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_stream<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_stream<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_reg_stream<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_stream<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_reg_stream<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_stream<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_reg_stream<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_stream<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_reg_stream<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_stream<uint8_t>(); }
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_stream()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	std::iota(inputs1, inputs1 + N, (T)1);
+	mipp::vector<T> outputs(4 * N, (T)0);
+
+	mipp::Reg<T> r1 = inputs1;
+	for (auto i = 0; i < 4; i++)
+	{
+		mipp::prefetch(inputs1);
+		mipp::stream(&outputs[i * N], r1);
+	}
+	mipp::sfence();
+
+	for (auto i = 0; i < 4 * N; i++)
+		REQUIRE(outputs[i] == inputs1[i % N]);
+}
+
+TEST_CASE("Stream - mipp::Reg", "[mipp::stream]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_stream<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_stream<float>(); }
+
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_Reg_stream<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_stream<uint64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_Reg_stream<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_stream<uint32_t>(); }
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_Reg_stream<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_stream<uint16_t>(); }
+	SECTION("datatype = int8_t") { test_Reg_stream<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_stream<uint8_t>(); }
+#endif
+}
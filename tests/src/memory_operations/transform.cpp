@@ -0,0 +1,62 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+// the sizes around 'MIPP_STREAM_THRESHOLD' are tested with an aligned and a misaligned output, the large outputs are
+// written with non-temporal stores
+template <typename T>
+void test_transform()
+{
+	constexpr int N = mipp::N<T>();
+	const size_t big = (size_t)MIPP_STREAM_THRESHOLD / sizeof(T);
+	const size_t sizes[] = {1, (size_t)N -1, (size_t)N, (size_t)(3 * N + 1), big -1, big, big + 3 * N + 1};
+
+	for (auto size : sizes)
+	{
+		for (size_t offset = 0; offset < 2; offset++)
+		{
+			mipp::vector<T> inputs(size), outputs(size + offset, (T)0), ref(size);
+			for (size_t i = 0; i < size; i++)
+			{
+				inputs[i] = (T)(i % 100);
+				ref   [i] = (T)(i % 100 + 1);
+			}
+
+			mipp::transform(inputs.data(), size, outputs.data() + offset,
+			                [](const mipp::Reg<T> r) { return r + mipp::Reg<T>((T)1); });
+			REQUIRE(std::equal(ref.begin(), ref.end(), outputs.begin() + offset));
+
+			std::fill(outputs.begin(), outputs.end(), (T)0);
+			mipp::copy(inputs.data(), size, outputs.data() + offset);
+			REQUIRE(std::equal(inputs.begin(), inputs.end(), outputs.begin() + offset));
+
+			// in place
+			mipp::transform(inputs.data(), size, inputs.data(),
+			                [](const mipp::Reg<T> r) { return r + mipp::Reg<T>((T)1); });
+			REQUIRE(std::equal(ref.begin(), ref.end(), inputs.begin()));
+		}
+	}
+}
+
+TEST_CASE("Transform - mipp::Reg", "[mipp::transform]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_transform<double>(); }
+#endif
+	SECTION("datatype = float") { test_transform<float>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t") { test_transform<int64_t>(); }
+#endif
+	SECTION("datatype = int32_t") { test_transform<int32_t>(); }
+#endif
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t") { test_transform<int16_t>(); }
+	SECTION("datatype = int8_t") { test_transform<int8_t>(); }
+#endif
+}
@@ -0,0 +1,188 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <mipp.h>
+#include <catch.hpp>
+
+// the values are taken in a small range to have a lot of ties, the first position has to be returned
+template <typename T>
+void test_reg_argmax()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(0, 20);
+
+	for (auto j = 0; j < 100; j++)
+	{
+		for (auto i = 0; i < N; i++)
+			inputs1[i] = (T)dis(g);
+
+		mipp::reg r1 = mipp::load<T>(inputs1);
+		auto res = mipp::argmax<T>(r1);
+
+		auto ref = std::max_element(inputs1, inputs1 + N);
+
+		REQUIRE(res.first  == *ref);
+		REQUIRE(res.second == (uint32_t)(ref - inputs1));
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Argmax - mipp::reg", "[mipp::argmax]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_reg_argmax<double>(); }
+#endif
+	SECTION("datatype = float") { test_reg_argmax<float>(); }
+
+#if defined(MIPP_64BIT)
+#if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
+	SECTION("datatype = int64_t") { test_reg_argmax<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_argmax<uint64_t>(); }
+#endif
+#endif
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t") { test_reg_argmax<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_argmax<uint32_t>(); }
+#endif
+#endif
+#if defined(MIPP_BW)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
+	SECTION("datatype = int16_t") { test_reg_argmax<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_argmax<uint16_t>(); }
+#endif
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+#ifndef _MSC_VER
+	SECTION("datatype = int8_t") { test_reg_argmax<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_argmax<uint8_t>(); }
+#endif
+#endif
+#endif
+}
+#endif
+
+template <typename T>
+void test_Reg_argmax()
+{
+	constexpr int N = mipp::N<T>();
+	T inputs1[N];
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(0, 20);
+
+	for (auto j = 0; j < 100; j++)
+	{
+		for (auto i = 0; i < N; i++)
+			inputs1[i] = (T)dis(g);
+
+		mipp::Reg<T> r1 = inputs1;
+		auto res = mipp::argmax(r1);
+
+		auto ref = std::max_element(inputs1, inputs1 + N);
+
+		REQUIRE(res.first  == *ref);
+		REQUIRE(res.second == (uint32_t)(ref - inputs1));
+	}
+}
+
+template <typename T>
+void test_array_argmax()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(0, 100);
+
+	for (auto size = 1; size <= 10 * N + N -1; size++)
+	{
+		std::vector<T> inputs(size);
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+
+		auto res = mipp::argmax(inputs.data(), inputs.size());
+
+		auto ref = std::max_element(inputs.begin(), inputs.end());
+
+		REQUIRE(res.first  == *ref);
+		REQUIRE(res.second == (size_t)(ref - inputs.begin()));
+	}
+}
+
+// the reduction of data with NaNs is NaN or not depending on the instruction set: the position is the first NaN if
+// it is, the first occurrence of the extreme value otherwise (and always in the array)
+template <typename T>
+void test_nan_argmax()
+{
+	constexpr int N = mipp::N<T>();
+	const T nan = std::numeric_limits<T>::quiet_NaN();
+
+	for (auto size = 1; size <= 3 * N + N -1; size++)
+		for (auto p = 0; p < size; p++)
+		{
+			std::vector<T> inputs(size);
+			std::iota(inputs.begin(), inputs.end(), (T)1);
+			inputs[p] = nan;
+
+			auto res = mipp::argmax(inputs.data(), inputs.size());
+			REQUIRE(res.second < (size_t)size);
+			if (res.first != res.first)
+				REQUIRE(res.second == (size_t)p);
+			else
+				REQUIRE(inputs[res.second] == res.first);
+
+			if (size == N)
+			{
+				auto resr = mipp::argmax(mipp::Reg<T>(inputs.data()));
+				REQUIRE(resr.second < (uint32_t)N);
+				if (resr.first != resr.first)
+					REQUIRE(resr.second == (uint32_t)p);
+				else
+					REQUIRE(inputs[resr.second] == resr.first);
+			}
+		}
+
+	std::vector<T> inputs(2 * N + 1, nan);
+	auto res = mipp::argmax(inputs.data(), inputs.size());
+	REQUIRE(res.first != res.first);
+	REQUIRE(res.second == (size_t)0);
+	auto resr = mipp::argmax(mipp::Reg<T>(inputs.data()));
+	REQUIRE(resr.first != resr.first);
+	REQUIRE(resr.second == (uint32_t)0);
+}
+
+TEST_CASE("Argmax - mipp::Reg", "[mipp::argmax]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_Reg_argmax<double>(); test_array_argmax<double>(); test_nan_argmax<double>(); }
+#endif
+	SECTION("datatype = float") { test_Reg_argmax<float>(); test_array_argmax<float>(); test_nan_argmax<float>(); }
+
+#if defined(MIPP_64BIT)
+#if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
+	SECTION("datatype = int64_t") { test_Reg_argmax<int64_t>(); test_array_argmax<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_argmax<uint64_t>(); test_array_argmax<uint64_t>(); }
+#endif
+#endif
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t") { test_Reg_argmax<int32_t>(); test_array_argmax<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_argmax<uint32_t>(); test_array_argmax<uint32_t>(); }
+#endif
+#endif
+#if defined(MIPP_BW)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
+	SECTION("datatype = int16_t") { test_Reg_argmax<int16_t>(); test_array_argmax<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_argmax<uint16_t>(); test_array_argmax<uint16_t>(); }
+#endif
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+#ifndef _MSC_VER
+	SECTION("datatype = int8_t") { test_Reg_argmax<int8_t>(); test_array_argmax<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_argmax<uint8_t>(); test_array_argmax<uint8_t>(); }
+#endif
+#endif
+#endif
+}
@@ -0,0 +1,87 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <catch.hpp>
+
+template <typename T, typename TA>
+void test_dot(const int vmin, const int vmax)
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(vmin, vmax);
+
+	for (size_t n = 0; n <= (size_t)(9 * N + 1); n++)
+	{
+		std::vector<T> a(n), b(n);
+		TA ref = (TA)0;
+		for (size_t i = 0; i < n; i++)
+		{
+			a[i] = (T)dis(g);
+			b[i] = (T)dis(g);
+			ref += (TA)a[i] * (TA)b[i];
+		}
+
+		REQUIRE(mipp::dot<T,TA>(a.data(), b.data(), n) == ref);
+		REQUIRE(mipp::dot<T,TA,1>(a.data(), b.data(), n) == ref);
+	}
+}
+
+TEST_CASE("Dot product - mipp::dot", "[mipp::dot]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_dot<double,double>(-100, 100); }
+#endif
+	SECTION("datatype = float") { test_dot<float,float>(-100, 100); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t") { test_dot<int32_t,int32_t>(-1000, 1000); }
+#endif
+#endif
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t -> int32_t") { test_dot<int16_t,int32_t>(-3000, 3000); }
+	SECTION("datatype = int8_t -> int32_t") { test_dot<int8_t,int32_t>(-128, 127); }
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	// the products near the maximum overflow the input type (and the 16-bit products of 'uint16_t' are > INT32_MAX)
+	SECTION("datatype = uint16_t -> uint32_t") { test_dot<uint16_t,uint32_t>(60000, 65535); }
+	SECTION("datatype = uint8_t -> uint32_t") { test_dot<uint8_t,uint32_t>(200, 255); }
+#endif
+#endif
+#endif
+}
+
+template <typename T>
+void test_dot_kahan()
+{
+	constexpr int N = mipp::N<T>();
+	// the ones are lost in a naive sum next to 'big'
+	const T big = (T)std::ldexp((T)1, std::numeric_limits<T>::digits + 1);
+
+	for (size_t n = 2; n <= (size_t)(9 * N + 1); n++)
+	{
+		std::vector<T> a(n, (T)1), b(n, (T)1);
+		a[0] = big;
+		a[n -1] = -big;
+
+		REQUIRE(mipp::dot_kahan<T>(a.data(), b.data(), n) == (T)(n -2));
+	}
+
+	// the rounding errors of the products are recovered with a hardware FMA
+#if defined(MIPP_AVX512) || (defined(MIPP_AVX) && defined(__FMA__))
+	const T eps = std::numeric_limits<T>::epsilon();
+	std::vector<T> a = { (T)1 + eps, (T)-1 }, b = { (T)1 - eps, (T)1 };
+	REQUIRE(mipp::dot_kahan<T>(a.data(), b.data(), a.size()) == -eps * eps);
+#endif
+}
+
+TEST_CASE("Compensated dot product - mipp::dot_kahan", "[mipp::dot_kahan]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double") { test_dot_kahan<double>(); }
+#endif
+	SECTION("datatype = float") { test_dot_kahan<float>(); }
+}
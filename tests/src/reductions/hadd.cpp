@@ -73,8 +73,8 @@ TEST_CASE("Horizontal addition - mipp::reg", "[mipp::hadd]")
 	SECTION("datatype = int32_t") { test_reg_hadd_int<int32_t>(); }
 #endif
 #if defined(MIPP_BW)
-#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_reg_hadd_int<int16_t>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_reg_hadd_int<int8_t>(); }
 #endif
@@ -149,8 +149,8 @@ TEST_CASE("Horizontal addition - mipp::Reg", "[mipp::hadd]")
 	SECTION("datatype = int32_t") { test_Reg_hadd_int<int32_t>(); }
 #endif
 #if defined(MIPP_BW)
-#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_Reg_hadd_int<int16_t>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_Reg_hadd_int<int8_t>(); }
 #endif
@@ -65,20 +65,24 @@ TEST_CASE("Horizontal maximum - mipp::reg", "[mipp::hmax]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_reg_hmax_int<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_hmax_int<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_reg_hmax_int<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_hmax_int<uint32_t>(); }
 #endif
 #endif
 #if defined(MIPP_BW)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_reg_hmax_int<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_hmax_int<uint16_t>(); }
 #endif
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_reg_hmax_int<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_hmax_int<uint8_t>(); }
 #endif
 #endif
 #endif
@@ -143,20 +147,24 @@ TEST_CASE("Horizontal maximum - mipp::Reg", "[mipp::hmax]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_Reg_hmax_int<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_hmax_int<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_Reg_hmax_int<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_hmax_int<uint32_t>(); }
 #endif
 #endif
 #if defined(MIPP_BW)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_Reg_hmax_int<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_hmax_int<uint16_t>(); }
 #endif
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_Reg_hmax_int<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_hmax_int<uint8_t>(); }
 #endif
 #endif
 #endif
@@ -66,20 +66,24 @@ TEST_CASE("Horizontal minimum - mipp::reg", "[mipp::hmin]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_reg_hmin_int<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_reg_hmin_int<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_reg_hmin_int<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_reg_hmin_int<uint32_t>(); }
 #endif
 #endif
 #if defined(MIPP_BW)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_reg_hmin_int<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_reg_hmin_int<uint16_t>(); }
 #endif
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_reg_hmin_int<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_reg_hmin_int<uint8_t>(); }
 #endif
 #endif
 #endif
@@ -144,20 +148,24 @@ TEST_CASE("Horizontal minimum - mipp::Reg", "[mipp::hmin]")
 #if defined(MIPP_64BIT)
 #if !defined(MIPP_SSE) && !defined(MIPP_AVX) && !defined(MIPP_NEON)
 	SECTION("datatype = int64_t") { test_Reg_hmin_int<int64_t>(); }
+	SECTION("datatype = uint64_t") { test_Reg_hmin_int<uint64_t>(); }
 #endif
 #endif
 #if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 	SECTION("datatype = int32_t") { test_Reg_hmin_int<int32_t>(); }
+	SECTION("datatype = uint32_t") { test_Reg_hmin_int<uint32_t>(); }
 #endif
 #endif
 #if defined(MIPP_BW)
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 31)
 	SECTION("datatype = int16_t") { test_Reg_hmin_int<int16_t>(); }
+	SECTION("datatype = uint16_t") { test_Reg_hmin_int<uint16_t>(); }
 #endif
 #if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
 #ifndef _MSC_VER
 	SECTION("datatype = int8_t") { test_Reg_hmin_int<int8_t>(); }
+	SECTION("datatype = uint8_t") { test_Reg_hmin_int<uint8_t>(); }
 #endif
 #endif
 #endif
@@ -0,0 +1,133 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <vector>
+#include <mipp.h>
+#include <catch.hpp>
+
+// the values are small integers so the sums are exact whatever the order of the operations
+template <typename T, int K>
+void test_reg_reduction_add()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-10, 10);
+
+	for (auto size = 1; size <= 10 * N + N -1; size++)
+	{
+		std::vector<T> inputs(size);
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+
+		auto val = mipp::reduction<T,mipp::add<T>>::template apply<mipp::loadu<T>,K>(inputs.data(), inputs.size());
+
+		T res = inputs[0];
+		for (auto i = 1; i < size; i++)
+			res += inputs[i];
+
+		REQUIRE(res == val);
+	}
+}
+
+template <typename T, int K>
+void test_reg_reduction_min()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-1000, 1000);
+
+	for (auto size = 1; size <= 10 * N + N -1; size++)
+	{
+		std::vector<T> inputs(size);
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+
+		auto val = mipp::reduction<T,mipp::min<T>>::template apply<mipp::loadu<T>,K>(inputs.data(), inputs.size());
+
+		REQUIRE(*std::min_element(inputs.begin(), inputs.end()) == val);
+	}
+}
+
+#ifndef MIPP_NO
+TEST_CASE("Array reduction - mipp::reg", "[mipp::reduction]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double, K = 1") { test_reg_reduction_add<double,1>(); }
+	SECTION("datatype = double, K = 4") { test_reg_reduction_add<double,4>(); }
+#endif
+	SECTION("datatype = float, K = 1") { test_reg_reduction_add<float,1>(); }
+	SECTION("datatype = float, K = 4") { test_reg_reduction_add<float,4>(); }
+	SECTION("datatype = float, K = 8") { test_reg_reduction_add<float,8>(); }
+	SECTION("datatype = float, K = 3") { test_reg_reduction_min<float,3>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = int32_t, K = 4") { test_reg_reduction_add<int32_t,4>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t, K = 8") { test_reg_reduction_min<int32_t,8>(); }
+#endif
+#endif
+}
+#endif
+
+template <typename T, int K>
+void test_Reg_reduction_add()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-10, 10);
+
+	for (auto size = 1; size <= 10 * N + N -1; size++)
+	{
+		std::vector<T> inputs(size);
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+
+		auto val = mipp::Reduction<T,mipp::add<T>>::template apply<mipp::loadu<T>,K>(inputs.data(), inputs.size());
+
+		T res = inputs[0];
+		for (auto i = 1; i < size; i++)
+			res += inputs[i];
+
+		REQUIRE(res == val);
+	}
+}
+
+template <typename T, int K>
+void test_Reg_reduction_min()
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(-1000, 1000);
+
+	for (auto size = 1; size <= 10 * N + N -1; size++)
+	{
+		std::vector<T> inputs(size);
+		for (auto i = 0; i < size; i++)
+			inputs[i] = (T)dis(g);
+
+		auto val = mipp::Reduction<T,mipp::min<T>>::template apply<mipp::loadu<T>,K>(inputs.data(), inputs.size());
+
+		REQUIRE(*std::min_element(inputs.begin(), inputs.end()) == val);
+	}
+}
+
+TEST_CASE("Array reduction - mipp::Reg", "[mipp::reduction]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double, K = 1") { test_Reg_reduction_add<double,1>(); }
+	SECTION("datatype = double, K = 4") { test_Reg_reduction_add<double,4>(); }
+#endif
+	SECTION("datatype = float, K = 1") { test_Reg_reduction_add<float,1>(); }
+	SECTION("datatype = float, K = 4") { test_Reg_reduction_add<float,4>(); }
+	SECTION("datatype = float, K = 8") { test_Reg_reduction_add<float,8>(); }
+	SECTION("datatype = float, K = 3") { test_Reg_reduction_min<float,3>(); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+	SECTION("datatype = int32_t, K = 4") { test_Reg_reduction_add<int32_t,4>(); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t, K = 8") { test_Reg_reduction_min<int32_t,8>(); }
+#endif
+#endif
+}
@@ -0,0 +1,109 @@
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <mipp.h>
+#include <mipp_parallel.h>
+#include <catch.hpp>
+
+template <typename T, mipp::Red_op<T> OP, class F>
+void test_scan(F op, const int vmin, const int vmax, const T init)
+{
+	constexpr int N = mipp::N<T>();
+	std::mt19937 g;
+	std::uniform_int_distribution<int> dis(vmin, vmax);
+
+	T inputs[N], outputs[N];
+	for (auto i = 0; i < N; i++)
+		inputs[i] = (T)dis(g);
+
+	mipp::scan<T,OP>(mipp::Reg<T>(inputs)).storeu(outputs);
+	T acc = inputs[0];
+	for (auto i = 0; i < N; i++)
+	{
+		acc = i ? op(acc, inputs[i]) : acc;
+		REQUIRE(outputs[i] == acc);
+	}
+
+	mipp::scan_excl<T,OP>(mipp::Reg<T>(inputs), init).storeu(outputs);
+	acc = init;
+	for (auto i = 0; i < N; i++)
+	{
+		REQUIRE(outputs[i] == acc);
+		acc = op(acc, inputs[i]);
+	}
+
+	for (size_t n = 0; n <= (size_t)(3 * N + 1); n++)
+	{
+		std::vector<T> x(n), y(n + 1, (T)42), ref(n);
+		for (size_t i = 0; i < n; i++)
+			x[i] = (T)dis(g);
+
+		mipp::scan<T,OP>(x.data(), n, y.data());
+		for (size_t i = 0; i < n; i++)
+			ref[i] = i ? op(ref[i -1], x[i]) : x[0];
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == ref[i]);
+		REQUIRE(y[n] == (T)42);
+
+		mipp::scan_excl<T,OP>(x.data(), n, y.data(), init);
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(y[i] == (i ? op(init, ref[i -1]) : init));
+		REQUIRE(y[n] == (T)42);
+
+		// in place
+		mipp::scan<T,OP>(x.data(), n, x.data());
+		for (size_t i = 0; i < n; i++)
+			REQUIRE(x[i] == ref[i]);
+	}
+
+	const size_t n = 100 * N + 3;
+	std::vector<T> x(n), y(n), z(n);
+	for (size_t i = 0; i < n; i++)
+		x[i] = (T)dis(g);
+	mipp::scan<T,OP>(x.data(), n, y.data());
+	mipp::scan_excl<T,OP>(x.data(), n, z.data(), init);
+	for (size_t t = 1; t <= 4; t++)
+	{
+		std::vector<T> yt(n), zt(n);
+		mipp::scan<T,OP>(x.data(), n, yt.data(), t);
+		mipp::scan_excl<T,OP>(x.data(), n, zt.data(), init, t);
+		REQUIRE(yt == y);
+		REQUIRE(zt == z);
+	}
+}
+
+template <typename T>
+T op_add(const T a, const T b) { return a + b; }
+
+template <typename T>
+T op_max(const T a, const T b) { return std::max(a, b); }
+
+TEST_CASE("Scan - mipp::Reg", "[mipp::scan]")
+{
+#if defined(MIPP_64BIT)
+	SECTION("datatype = double, OP = add") { test_scan<double,mipp::add>(op_add<double>, -3, 3, (double)1); }
+	SECTION("datatype = double, OP = max") { test_scan<double,mipp::max>(op_max<double>, -100, 100, (double)-5); }
+#endif
+	SECTION("datatype = float, OP = add") { test_scan<float,mipp::add>(op_add<float>, -3, 3, (float)1); }
+	SECTION("datatype = float, OP = max") { test_scan<float,mipp::max>(op_max<float>, -100, 100, (float)-5); }
+
+#if !defined(MIPP_AVX) || (defined(MIPP_AVX) && MIPP_INSTR_VERSION >= 2)
+#if defined(MIPP_64BIT)
+	SECTION("datatype = int64_t, OP = add") { test_scan<int64_t,mipp::add>(op_add<int64_t>, -3, 3, (int64_t)1); }
+#endif
+	SECTION("datatype = int32_t, OP = add") { test_scan<int32_t,mipp::add>(op_add<int32_t>, -3, 3, (int32_t)1); }
+	SECTION("datatype = uint32_t, OP = add") { test_scan<uint32_t,mipp::add>(op_add<uint32_t>, 0, 3, (uint32_t)1); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int32_t, OP = max") { test_scan<int32_t,mipp::max>(op_max<int32_t>, -100, 100, (int32_t)-5); }
+#endif
+#endif
+#if defined(MIPP_BW)
+	SECTION("datatype = int16_t, OP = add") { test_scan<int16_t,mipp::add>(op_add<int16_t>, -2, 2, (int16_t)1); }
+#if !defined(MIPP_SSE) || (defined(MIPP_SSE) && MIPP_INSTR_VERSION >= 41)
+	SECTION("datatype = int8_t, OP = max") { test_scan<int8_t,mipp::max>(op_max<int8_t>, -100, 100, (int8_t)-5); }
+	SECTION("datatype = uint8_t, OP = max") { test_scan<uint8_t,mipp::max>(op_max<uint8_t>, 0, 200, (uint8_t)5); }
+#endif
+#endif
+}
@@ -0,0 +1,16 @@
+#ifndef MIPP_TESTS_TEST_DATA_HPP_
+#define MIPP_TESTS_TEST_DATA_HPP_
+
+// test data shared by the test cases
+
+// 'n' values 'first', 'first + step', 'first + 2*step', ... starting again from 'first' every 'm' values: with the 128
+// elements of the 1024-bit emulated registers, an iota overflows the 8-bit types ('m' is 100 by default, and 63 for the
+// two operands of a sum) and the shift counts exceed the element width ('m' is the width)
+template <typename T>
+void iota_mod(T *data, const int n, const T first, const int m = 100, const int step = 1)
+{
+	for (auto i = 0; i < n; i++)
+		data[i] = (T)(first + step * (i % m));
+}
+
+#endif /* MIPP_TESTS_TEST_DATA_HPP_ */